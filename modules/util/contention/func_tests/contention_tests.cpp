@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "util/contention/include/contention.hpp"
+
+using ppc::util::ContentionReport;
+using ppc::util::WaitHistogram;
+
+TEST(contention, histogram_buckets_by_powers_of_two) {
+  WaitHistogram h;
+  EXPECT_EQ(h.quantile(0.5), 0);
+  h.add(0.5e-6);  // under 1 us
+  h.add(1e-6);
+  h.add(3e-6);  // [2, 4) us
+  h.add(1e-3);  // [512, 1024) us
+  h.add(1e9);   // past the last edge
+  EXPECT_EQ(h.count(), 5u);
+  EXPECT_EQ(h.bucket(0), 1u);
+  EXPECT_EQ(h.bucket(1), 1u);
+  EXPECT_EQ(h.bucket(2), 1u);
+  EXPECT_EQ(h.bucket(10), 1u);
+  EXPECT_EQ(h.bucket(WaitHistogram::kBuckets - 1), 1u);
+  EXPECT_DOUBLE_EQ(h.max(), 1e9);
+
+  // Quantiles report the upper edge of their bucket, the top one the longest wait
+  EXPECT_DOUBLE_EQ(h.quantile(0), 1e-6);
+  EXPECT_DOUBLE_EQ(h.quantile(0.5), 4e-6);
+  EXPECT_DOUBLE_EQ(h.quantile(0.8), 1.024e-3);
+  EXPECT_DOUBLE_EQ(h.quantile(1), 1e9);
+  EXPECT_THROW((void)h.quantile(1.5), std::invalid_argument);
+
+  WaitHistogram single;
+  single.add(3e-6);
+  EXPECT_DOUBLE_EQ(single.quantile(0.99), 3e-6);  // never beyond the longest wait
+}
+
+TEST(contention, histograms_add_up_bucket_by_bucket) {
+  WaitHistogram a;
+  WaitHistogram b;
+  WaitHistogram both;
+  for (int i = 0; i < 1000; i++) {
+    const double wait = 1e-7 * (i * i % 9973);
+    (i % 3 == 0 ? a : b).add(wait);
+    both.add(wait);
+  }
+  a += b;
+  EXPECT_EQ(a.count(), both.count());
+  EXPECT_DOUBLE_EQ(a.max(), both.max());
+  EXPECT_NEAR(a.total(), both.total(), 1e-12);
+  for (int k = 0; k < WaitHistogram::kBuckets; k++) EXPECT_EQ(a.bucket(k), both.bucket(k)) << k;
+  for (double q : {0.1, 0.5, 0.9, 0.99}) EXPECT_DOUBLE_EQ(a.quantile(q), both.quantile(q));
+}
+
+TEST(contention, report_measures_throughput_fairness_and_starvation) {
+  ContentionReport report;
+  EXPECT_EQ(report.throughput(), 0);
+  EXPECT_EQ(report.fairness(), 1);
+
+  report.seconds = 2;
+  report.served = {5, 5, 5, 5};
+  report.waits.resize(4);
+  report.waits[2].add(0.25);
+  report.waits[3].add(0.5);
+  EXPECT_EQ(report.total_served(), 20u);
+  EXPECT_DOUBLE_EQ(report.throughput(), 10);
+  EXPECT_DOUBLE_EQ(report.fairness(), 1);
+  EXPECT_EQ(report.starved(), 0u);
+  EXPECT_DOUBLE_EQ(report.max_wait(), 0.5);
+  EXPECT_EQ(report.all_waits().count(), 2u);
+
+  // One agent served alone
+  report.served = {8, 0, 0, 0};
+  EXPECT_DOUBLE_EQ(report.fairness(), 0.25);
+  EXPECT_EQ(report.starved(), 3u);
+  report.served = {1, 3};
+  EXPECT_DOUBLE_EQ(report.fairness(), 0.8);
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace ppc::util {
+
+// Wait times in buckets of powers of two microseconds: bucket 0 holds waits under 1 us, bucket b waits in
+// [2^(b-1), 2^b) us, and the last one everything longer. Fixed buckets make histograms of different agents
+// (and processes) add up bucket by bucket.
+class WaitHistogram {
+ public:
+  static constexpr int kBuckets = 32;
+
+  void add(double seconds) {
+    const double us = std::max(seconds, 0.0) * 1e6;
+    const auto whole = us < 0x1p62 ? static_cast<uint64_t>(us) : uint64_t{1} << 62;
+    buckets_[std::min<int>(std::bit_width(whole), kBuckets - 1)]++;
+    count_++;
+    total_ += seconds;
+    max_ = std::max(max_, seconds);
+  }
+
+  WaitHistogram& operator+=(const WaitHistogram& other) {
+    for (int b = 0; b < kBuckets; b++) buckets_[b] += other.buckets_[b];
+    count_ += other.count_;
+    total_ += other.total_;
+    max_ = std::max(max_, other.max_);
+    return *this;
+  }
+
+  uint64_t count() const { return count_; }
+  uint64_t bucket(int b) const { return buckets_[b]; }
+  double total() const { return total_; }
+  double mean() const { return count_ > 0 ? total_ / static_cast<double>(count_) : 0; }
+  double max() const { return max_; }
+
+  // Upper edge (in seconds) of the bucket holding the q-quantile, but no more than the longest wait; 0 if empty
+  double quantile(double q) const {
+    if (q < 0 || q > 1) throw std::invalid_argument("WaitHistogram: quantile outside [0, 1]");
+    if (count_ == 0) return 0;
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(count_))));
+    uint64_t seen = 0;
+    for (int b = 0; b < kBuckets - 1; b++) {
+      seen += buckets_[b];
+      if (seen >= rank) return std::min(std::ldexp(1e-6, b), max_);
+    }
+    return max_;
+  }
+
+  // For Boost.MPI, so that the histograms of all processes can be gathered
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int /*version*/) {
+    ar & buckets_;
+    ar & count_;
+    ar & total_;
+    ar & max_;
+  }
+
+ private:
+  uint64_t buckets_[kBuckets]{};
+  uint64_t count_ = 0;
+  double total_ = 0;
+  double max_ = 0;
+};
+
+// What a run of a synchronization benchmark measured, per agent (philosopher, customer, ...): how often it was
+// served and how long it waited each time
+struct ContentionReport {
+  double seconds = 0;
+  std::vector<uint64_t> served;
+  std::vector<WaitHistogram> waits;
+
+  uint64_t total_served() const { return std::accumulate(served.begin(), served.end(), uint64_t{0}); }
+
+  double throughput() const { return seconds > 0 ? static_cast<double>(total_served()) / seconds : 0; }
+
+  // Jain's index of the served counts: 1 when every agent was served equally often, 1 / agents when one agent
+  // was served alone
+  double fairness() const {
+    double sum = 0;
+    double squares = 0;
+    for (auto s : served) {
+      sum += static_cast<double>(s);
+      squares += static_cast<double>(s) * static_cast<double>(s);
+    }
+    return squares > 0 ? sum * sum / (static_cast<double>(served.size()) * squares) : 1;
+  }
+
+  // Agents never served
+  size_t starved() const { return static_cast<size_t>(std::count(served.begin(), served.end(), uint64_t{0})); }
+
+  // The longest single wait of any agent
+  double max_wait() const {
+    double longest = 0;
+    for (const auto& w : waits) longest = std::max(longest, w.max());
+    return longest;
+  }
+
+  WaitHistogram all_waits() const {
+    WaitHistogram all;
+    for (const auto& w : waits) all += w;
+    return all;
+  }
+};
+
+}  // namespace ppc::util
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "util/contrast/include/contrast.hpp"
+
+using ppc::util::ChannelStats;
+using ppc::util::ContrastLut;
+using ppc::util::PlanarImage;
+
+namespace {
+
+std::vector<uint8_t> random_bytes(size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<uint8_t> v(n);
+  for (auto& b : v) b = static_cast<uint8_t>(dist(gen));
+  return v;
+}
+
+}  // namespace
+
+TEST(contrast, channel_stats_match_a_plain_scan) {
+  auto v = random_bytes(10007, 1);
+  auto stats = ppc::util::channel_stats(v.data(), v.size());
+  uint64_t sum = 0;
+  for (uint8_t b : v) sum += b;
+  EXPECT_EQ(stats.sum, sum);
+  EXPECT_EQ(stats.count, v.size());
+  EXPECT_EQ(stats.min, *std::min_element(v.begin(), v.end()));
+  EXPECT_EQ(stats.max, *std::max_element(v.begin(), v.end()));
+
+  // Strided: every third byte
+  auto strided = ppc::util::channel_stats(v.data() + 1, v.size() / 3, 3);
+  sum = 0;
+  for (size_t i = 0; i < v.size() / 3; i++) sum += v[1 + 3 * i];
+  EXPECT_EQ(strided.sum, sum);
+}
+
+TEST(contrast, stats_of_parts_merge_into_the_whole) {
+  auto v = random_bytes(5000, 2);
+  auto whole = ppc::util::channel_stats(v.data(), v.size());
+  ChannelStats merged;
+  for (size_t first = 0; first < v.size(); first += 777) {
+    merged.merge(ppc::util::channel_stats(v.data() + first, std::min<size_t>(777, v.size() - first)));
+  }
+  EXPECT_EQ(merged.sum, whole.sum);
+  EXPECT_EQ(merged.count, whole.count);
+  EXPECT_EQ(merged.min, whole.min);
+  EXPECT_EQ(merged.max, whole.max);
+  EXPECT_DOUBLE_EQ(ChannelStats().mean(), 0.0);
+}
+
+TEST(contrast, empty_input_has_neutral_stats) {
+  auto stats = ppc::util::channel_stats(nullptr, 0);
+  EXPECT_EQ(stats.count, 0u);
+  EXPECT_EQ(stats.min, 255);
+  EXPECT_EQ(stats.max, 0);
+}
+
+TEST(contrast, lut_reproduces_the_pixel_formula) {
+  const float factor = 1.7f;
+  auto formula = [factor](uint8_t v) { return 128 + static_cast<int>(std::round(factor * float(v - 128))); };
+  ContrastLut lut = ppc::util::make_lut(formula);
+  auto v = random_bytes(4096, 3);
+  std::vector<uint8_t> out(v.size());
+  ppc::util::apply_lut(lut, v.data(), out.data(), v.size());
+  for (size_t i = 0; i < v.size(); i++) {
+    EXPECT_EQ(out[i], static_cast<uint8_t>(std::clamp(formula(v[i]), 0, 255)));
+  }
+}
+
+TEST(contrast, planar_image_round_trips_and_collects_channel_stats) {
+  const size_t pixels = 1234;
+  auto rgb = random_bytes(pixels * 3, 4);
+  PlanarImage image;
+  auto stats = image.load(rgb.data(), pixels, 3);
+  ASSERT_EQ(stats.size(), 3u);
+  for (int c = 0; c < 3; c++) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < pixels; i++) {
+      EXPECT_EQ(image.plane(c)[i], rgb[i * 3 + c]);
+      sum += rgb[i * 3 + c];
+    }
+    EXPECT_EQ(stats[c].sum, sum);
+  }
+
+  // Identity tables give back the interleaved input
+  ContrastLut identity = ppc::util::make_lut([](uint8_t v) { return v; });
+  std::vector<uint8_t> out(rgb.size());
+  image.apply({identity, identity, identity}, out.data());
+  EXPECT_EQ(out, rgb);
+  EXPECT_THROW(image.apply({identity}, out.data()), std::invalid_argument);
+}
+
+TEST(contrast, per_channel_tables_apply_to_their_channel) {
+  std::vector<uint8_t> rgb{10, 20, 30, 40, 50, 60};
+  PlanarImage image;
+  image.load(rgb.data(), 2, 3);
+  auto constant = [](int value) { return ppc::util::make_lut([value](uint8_t) { return value; }); };
+  std::vector<uint8_t> out(6);
+  image.apply({constant(1), constant(-5), constant(300)}, out.data());
+  EXPECT_EQ(out, (std::vector<uint8_t>{1, 0, 255, 1, 0, 255}));
+}
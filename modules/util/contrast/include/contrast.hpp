@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace ppc::util {
+
+// Sum, extrema and size of one channel. Statistics of disjoint parts merge into those of the whole, so ranks
+// only exchange these few numbers, never pixels.
+struct ChannelStats {
+  uint64_t sum = 0;
+  uint64_t count = 0;
+  uint8_t min = 255;
+  uint8_t max = 0;
+
+  void merge(const ChannelStats& other) {
+    sum += other.sum;
+    count += other.count;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+  }
+  double mean() const { return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count); }
+};
+
+namespace contrast_detail {
+
+// Elements per block whose sum is kept in 32 bits: 255 * 2^24 < 2^32
+constexpr size_t kSumBlock = size_t(1) << 24;
+// Pixels split or merged per step of PlanarImage, small enough for the planes' chunks to stay in L1
+constexpr size_t kPixelChunk = 4096;
+
+// Moves pixels between interleaved and planar layout, pixel by pixel so the interleaved side streams
+// sequentially; C > 0 fixes the channel count at compile time
+template <int C>
+void to_planar(const uint8_t* interleaved, size_t n, int channels, uint8_t* const* planes) {
+  const int ch = C > 0 ? C : channels;
+  for (size_t i = 0; i < n; i++) {
+    for (int c = 0; c < ch; c++) planes[c][i] = interleaved[i * ch + c];
+  }
+}
+
+template <int C, class Map>
+void to_interleaved(const uint8_t* const* planes, size_t n, int channels, uint8_t* interleaved, Map&& map) {
+  const int ch = C > 0 ? C : channels;
+  for (size_t i = 0; i < n; i++) {
+    for (int c = 0; c < ch; c++) interleaved[i * ch + c] = map(c, planes[c][i]);
+  }
+}
+
+}  // namespace contrast_detail
+
+// Statistics of n values read with the given stride, in one pass of vectorized sum, min and max reductions
+inline ChannelStats channel_stats(const uint8_t* values, size_t n, size_t stride = 1) {
+  ChannelStats stats;
+  stats.count = n;
+  for (size_t first = 0; first < n; first += contrast_detail::kSumBlock) {
+    const size_t last = std::min(n, first + contrast_detail::kSumBlock);
+    uint32_t sum = 0;
+    uint8_t lo = 255;
+    uint8_t hi = 0;
+    // Plain comparisons rather than std::min/max, which keep the reduction from vectorizing
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : sum) reduction(min : lo) reduction(max : hi)
+#endif
+    for (size_t i = first; i < last; i++) {
+      const uint8_t v = values[i * stride];
+      sum += v;
+      lo = v < lo ? v : lo;
+      hi = v > hi ? v : hi;
+    }
+    stats.sum += sum;
+    stats.min = std::min(stats.min, lo);
+    stats.max = std::max(stats.max, hi);
+  }
+  return stats;
+}
+
+// out[v] for every input value v; a point operation on uint8 pixels is fully described by it
+using ContrastLut = std::array<uint8_t, 256>;
+
+// Tabulates f over 0..255, clamping its results to 0..255. Evaluating the task's own per-pixel formula
+// here keeps the table bit-identical to it, whatever floating-point arithmetic the formula uses.
+template <class F>
+ContrastLut make_lut(F&& f) {
+  ContrastLut lut;
+  for (int v = 0; v < 256; v++) lut[v] = static_cast<uint8_t>(std::clamp<int>(f(static_cast<uint8_t>(v)), 0, 255));
+  return lut;
+}
+
+inline void apply_lut(const ContrastLut& lut, const uint8_t* src, uint8_t* dst, size_t n) {
+  for (size_t i = 0; i < n; i++) dst[i] = lut[src[i]];
+}
+
+// An interleaved image stored channel by channel (SoA). load() gathers the statistics of each channel while
+// splitting it out, and apply() maps each channel through its table while interleaving it back, so a contrast
+// adjustment reads the pixels twice in total: load, one table per channel built from the statistics, apply.
+class PlanarImage {
+ public:
+  std::vector<ChannelStats> load(const uint8_t* interleaved, size_t pixels, int channels) {
+    if (channels < 1) throw std::invalid_argument("PlanarImage: at least one channel");
+    pixels_ = pixels;
+    channels_ = channels;
+    data_.resize(pixels * channels);
+    std::vector<ChannelStats> stats(channels);
+    std::vector<uint8_t*> planes(channels);
+    for (size_t first = 0; first < pixels; first += contrast_detail::kPixelChunk) {
+      const size_t n = std::min(contrast_detail::kPixelChunk, pixels - first);
+      for (int c = 0; c < channels; c++) planes[c] = plane(c) + first;
+      if (channels == 3) {
+        contrast_detail::to_planar<3>(interleaved + first * 3, n, 3, planes.data());
+      } else {
+        contrast_detail::to_planar<0>(interleaved + first * channels, n, channels, planes.data());
+      }
+      // The chunk of each plane is still in L1
+      for (int c = 0; c < channels; c++) stats[c].merge(channel_stats(planes[c], n));
+    }
+    return stats;
+  }
+
+  void apply(const std::vector<ContrastLut>& luts, uint8_t* interleaved) const {
+    if (luts.size() != static_cast<size_t>(channels_)) {
+      throw std::invalid_argument("PlanarImage: one table per channel");
+    }
+    std::vector<const uint8_t*> planes(channels_);
+    for (int c = 0; c < channels_; c++) planes[c] = plane(c);
+    auto map = [&](int c, uint8_t v) { return luts[c][v]; };
+    if (channels_ == 3) {
+      contrast_detail::to_interleaved<3>(planes.data(), pixels_, 3, interleaved, map);
+    } else {
+      contrast_detail::to_interleaved<0>(planes.data(), pixels_, channels_, interleaved, map);
+    }
+  }
+
+  size_t pixels() const { return pixels_; }
+  int channels() const { return channels_; }
+  uint8_t* plane(int c) { return data_.data() + static_cast<size_t>(c) * pixels_; }
+  const uint8_t* plane(int c) const { return data_.data() + static_cast<size_t>(c) * pixels_; }
+
+ private:
+  size_t pixels_ = 0;
+  int channels_ = 1;
+  std::vector<uint8_t> data_;
+};
+
+}  // namespace ppc::util
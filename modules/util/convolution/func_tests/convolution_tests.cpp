@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "util/convolution/include/convolution.hpp"
+
+using ppc::util::BorderMode;
+using ppc::util::ConvolutionKernel;
+using ppc::util::ConvolutionOptions;
+using ppc::util::convolve;
+using ppc::util::ImageShape;
+
+namespace {
+
+std::vector<uint8_t> random_image(const ImageShape& shape, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<uint8_t> image(shape.row_elements() * shape.height);
+  for (auto& v : image) v = static_cast<uint8_t>(dist(gen));
+  return image;
+}
+
+// Per-tap clamped 2D convolution, taps summed row by row as the engine's 2D path does
+template <class Acc>
+std::vector<Acc> reference(const std::vector<uint8_t>& image, const ImageShape& shape,
+                           const ConvolutionKernel<Acc>& kernel, bool zero_border) {
+  const int r = kernel.radius();
+  const int c = shape.channels;
+  std::vector<Acc> out(image.size());
+  for (int y = 0; y < shape.height; y++) {
+    for (int x = 0; x < shape.width; x++) {
+      for (int ch = 0; ch < c; ch++) {
+        Acc sum = 0;
+        for (int ky = -r; ky <= r; ky++) {
+          for (int kx = -r; kx <= r; kx++) {
+            int sy = y + ky;
+            int sx = x + kx;
+            Acc w = kernel.weights()[(ky + r) * kernel.taps() + kx + r];
+            if (sy < 0 || sy >= shape.height || sx < 0 || sx >= shape.width) {
+              if (zero_border) continue;
+              sy = std::clamp(sy, 0, shape.height - 1);
+              sx = std::clamp(sx, 0, shape.width - 1);
+            }
+            sum += w * static_cast<Acc>(image[(static_cast<size_t>(sy) * shape.width + sx) * c + ch]);
+          }
+        }
+        out[(static_cast<size_t>(y) * shape.width + x) * c + ch] = sum;
+      }
+    }
+  }
+  return out;
+}
+
+auto keep = [](auto sum, int, int) { return sum; };
+
+}  // namespace
+
+TEST(convolution, detects_separable_kernels) {
+  auto g = ppc::util::gaussian_weights(2, 1.5f);
+  EXPECT_TRUE(ConvolutionKernel<float>::outer(g, g).separable());
+
+  // Built from the full 2D table, the factors are recovered
+  std::vector<float> table;
+  for (float a : g) {
+    for (float b : g) table.push_back(a * b);
+  }
+  ConvolutionKernel<float> detected(2, table);
+  ASSERT_TRUE(detected.separable());
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 5; j++) {
+      EXPECT_NEAR(detected.column()[i] * detected.row()[j], table[i * 5 + j], 1e-7);
+    }
+  }
+
+  ConvolutionKernel<int> binomial(1, {1, 2, 1, 2, 4, 2, 1, 2, 1});
+  ASSERT_TRUE(binomial.separable());
+  EXPECT_EQ(binomial.row(), (std::vector<int>{1, 2, 1}));
+  EXPECT_EQ(binomial.column(), (std::vector<int>{1, 2, 1}));
+
+  EXPECT_FALSE(ConvolutionKernel<int>(1, {0, 1, 0, 1, -4, 1, 0, 1, 0}).separable());
+  EXPECT_FALSE(ConvolutionKernel<float>(1, {1, 1, 1, 1, 1, 1, 1, 1, 2}).separable());
+  EXPECT_THROW(ConvolutionKernel<float>(1, {1, 2, 3}), std::invalid_argument);
+}
+
+TEST(convolution, two_d_path_matches_per_tap_clamping_exactly) {
+  ImageShape shape{37, 23, 3};
+  auto image = random_image(shape, 1);
+  ConvolutionKernel<float> kernel(1, {0.1f, 0.2f, 0.05f, 0.15f, 0.3f, 0.1f, 0.02f, 0.03f, 0.05f});
+  ASSERT_FALSE(kernel.separable());
+  for (auto border : {BorderMode::kReplicate, BorderMode::kZero}) {
+    ConvolutionOptions options;
+    options.border = border;
+    std::vector<float> out(image.size());
+    convolve(image.data(), out.data(), shape, kernel, keep, options);
+    EXPECT_EQ(out, reference(image, shape, kernel, border == BorderMode::kZero));
+  }
+}
+
+TEST(convolution, separable_path_matches_two_d_sum) {
+  ImageShape shape{64, 40, 3};
+  auto image = random_image(shape, 2);
+  auto g = ppc::util::gaussian_weights(2, 1.2f);
+  auto kernel = ConvolutionKernel<float>::outer(g, g);
+  auto expected = reference(image, shape, kernel, false);
+
+  std::vector<float> out(image.size());
+  convolve(image.data(), out.data(), shape, kernel, keep);
+  for (size_t i = 0; i < out.size(); i++) EXPECT_NEAR(out[i], expected[i], 1e-3) << i;
+}
+
+TEST(convolution, integer_kernels_are_exact) {
+  ImageShape shape{19, 11, 1};
+  auto image = random_image(shape, 3);
+  ConvolutionKernel<int> binomial(1, {1, 2, 1, 2, 4, 2, 1, 2, 1});
+  ConvolutionOptions options;
+  options.border = BorderMode::kZero;
+  std::vector<int> out(image.size());
+  convolve(image.data(), out.data(), shape, binomial, keep, options);
+  EXPECT_EQ(out, reference(image, shape, binomial, true));
+}
+
+TEST(convolution, valid_border_leaves_the_frame_untouched) {
+  ImageShape shape{8, 6, 1};
+  std::vector<uint8_t> image(48, 10);
+  ConvolutionKernel<int> box(1, std::vector<int>(9, 1));
+  ConvolutionOptions options;
+  options.border = BorderMode::kValid;
+  std::vector<int> out(48, -1);
+  convolve(image.data(), out.data(), shape, box, keep, options);
+  for (int y = 0; y < 6; y++) {
+    for (int x = 0; x < 8; x++) {
+      bool inside = y >= 1 && y < 5 && x >= 1 && x < 7;
+      EXPECT_EQ(out[y * 8 + x], inside ? 90 : -1) << x << ' ' << y;
+    }
+  }
+}
+
+TEST(convolution, tiles_do_not_change_the_result) {
+  ImageShape shape{301, 17, 3};
+  auto image = random_image(shape, 4);
+  auto g = ppc::util::gaussian_weights(3, 2.0f);
+  for (bool separable : {true, false}) {
+    ConvolutionOptions wide;
+    wide.use_separable = separable;
+    ConvolutionOptions narrow = wide;
+    narrow.tile_bytes = 1;
+    std::vector<float> a(image.size());
+    std::vector<float> b(image.size());
+    auto kernel = ConvolutionKernel<float>::outer(g, g);
+    convolve(image.data(), a.data(), shape, kernel, keep, wide);
+    convolve(image.data(), b.data(), shape, kernel, keep, narrow);
+    EXPECT_EQ(a, b);
+  }
+}
+
+TEST(convolution, row_bands_with_ghost_rows_reproduce_the_whole_image) {
+  ImageShape shape{33, 29, 3};
+  auto image = random_image(shape, 5);
+  auto g = ppc::util::gaussian_weights(2, 1.0f);
+  auto kernel = ConvolutionKernel<float>::outer(g, g);
+  auto to_byte = [](float v, int, int) { return static_cast<uint8_t>(std::clamp(v + 0.5f, 0.0f, 255.0f)); };
+  std::vector<uint8_t> whole(image.size());
+  convolve(image.data(), whole.data(), shape, kernel, to_byte);
+
+  for (int parts : {2, 3, 7, 40}) {
+    std::vector<uint8_t> joined(image.size());
+    for (int p = 0; p < parts; p++) {
+      auto band = ppc::util::row_band(shape.height, p, parts, kernel.radius());
+      // Only the band and its ghost rows are visible, as on a rank
+      std::vector<uint8_t> local(image.begin() + band.halo_first * shape.row_elements(),
+                                 image.begin() + band.halo_last * shape.row_elements());
+      convolve(local.data(), band.halo_first, joined.data() + band.first * shape.row_elements(), band.first,
+               band.last, shape, kernel, to_byte);
+    }
+    EXPECT_EQ(joined, whole) << parts;
+  }
+}
+
+TEST(convolution, store_sees_pixel_coordinates) {
+  // Mean over the in-image part of a 3x3 window, normalized per position
+  ImageShape shape{5, 4, 1};
+  std::vector<uint8_t> image(20, 7);
+  ConvolutionOptions options;
+  options.border = BorderMode::kZero;
+  auto mean = [&](int sum, int x, int y) {
+    int ny = std::min(y + 1, shape.height - 1) - std::max(y - 1, 0) + 1;
+    int nx = std::min(x + 1, shape.width - 1) - std::max(x - 1, 0) + 1;
+    return sum / (nx * ny);
+  };
+  std::vector<int> out(20);
+  convolve(image.data(), out.data(), shape, ConvolutionKernel<int>(1, std::vector<int>(9, 1)), mean, options);
+  EXPECT_EQ(out, std::vector<int>(20, 7));
+}
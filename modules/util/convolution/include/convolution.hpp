@@ -0,0 +1,374 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ppc::util {
+
+// How taps that fall outside the image are fed
+enum class BorderMode {
+  // Edge pixels are repeated
+  kReplicate,
+  // Outside pixels are zero
+  kZero,
+  // Only pixels whose whole window lies inside the image are written; the rest of dst is left untouched
+  kValid
+};
+
+// Interleaved image: row y starts at element y * width * channels
+struct ImageShape {
+  int width = 0;
+  int height = 0;
+  int channels = 1;
+
+  size_t row_elements() const { return static_cast<size_t>(width) * static_cast<size_t>(channels); }
+};
+
+// Square (2r + 1) x (2r + 1) kernel with weights of the accumulator type. A rank-one kernel is detected on
+// construction and kept as a column and a row factor, so it can run as two 1D passes.
+template <class W>
+class ConvolutionKernel {
+ public:
+  ConvolutionKernel(int radius, std::vector<W> weights) : radius_(radius), weights_(std::move(weights)) {
+    const auto taps = static_cast<size_t>(2 * radius + 1);
+    if (radius < 0 || weights_.size() != taps * taps) throw std::invalid_argument("ConvolutionKernel: bad size");
+    factorize();
+  }
+
+  // column[i] * row[j], with the factors kept exactly as given
+  static ConvolutionKernel outer(const std::vector<W>& column, const std::vector<W>& row) {
+    if (column.size() != row.size() || column.size() % 2 == 0) {
+      throw std::invalid_argument("ConvolutionKernel: factors must have the same odd length");
+    }
+    std::vector<W> weights;
+    weights.reserve(column.size() * row.size());
+    for (W c : column) {
+      for (W r : row) weights.push_back(c * r);
+    }
+    ConvolutionKernel kernel(static_cast<int>(column.size() / 2), std::move(weights));
+    kernel.column_ = column;
+    kernel.row_ = row;
+    kernel.separable_ = true;
+    return kernel;
+  }
+
+  int radius() const { return radius_; }
+  int taps() const { return 2 * radius_ + 1; }
+  const std::vector<W>& weights() const { return weights_; }
+  bool separable() const { return separable_; }
+  const std::vector<W>& column() const { return column_; }
+  const std::vector<W>& row() const { return row_; }
+
+ private:
+  // Rank-one test around the largest entry K[p][q]: row p and column q must reproduce every weight. Integer
+  // kernels must factor exactly; floating kernels to a few ulps of the largest weight.
+  void factorize() {
+    const int n = taps();
+    auto at = [&](int i, int j) { return weights_[static_cast<size_t>(i * n + j)]; };
+    size_t pivot = 0;
+    for (size_t k = 1; k < weights_.size(); k++) {
+      if (std::abs(weights_[k]) > std::abs(weights_[pivot])) pivot = k;
+    }
+    const W top = weights_[pivot];
+    if (top == W(0)) return;
+    const int p = static_cast<int>(pivot) / n;
+    const int q = static_cast<int>(pivot) % n;
+
+    // The pivot row, reduced by its gcd for integer kernels so that the column can stay integral
+    std::vector<W> column(n);
+    std::vector<W> row(n);
+    W divisor = 1;
+    if constexpr (std::is_integral_v<W>) {
+      divisor = 0;
+      for (int k = 0; k < n; k++) divisor = std::gcd(divisor, at(p, k));
+    }
+    for (int k = 0; k < n; k++) row[k] = at(p, k) / divisor;
+    for (int k = 0; k < n; k++) {
+      if constexpr (std::is_integral_v<W>) {
+        if (at(k, q) % row[q] != 0) return;
+      }
+      column[k] = at(k, q) / row[q];
+    }
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        if constexpr (std::is_integral_v<W>) {
+          if (at(i, j) != column[i] * row[j]) return;
+        } else {
+          if (std::abs(at(i, j) - column[i] * row[j]) > W(16) * std::numeric_limits<W>::epsilon() * std::abs(top)) {
+            return;
+          }
+        }
+      }
+    }
+    column_ = std::move(column);
+    row_ = std::move(row);
+    separable_ = true;
+  }
+
+  int radius_;
+  std::vector<W> weights_;
+  std::vector<W> column_;
+  std::vector<W> row_;
+  bool separable_ = false;
+};
+
+// Normalized 1D Gaussian exp(-i^2 / (2 sigma^2)), i = -radius..radius
+template <class W = float>
+std::vector<W> gaussian_weights(int radius, W sigma) {
+  std::vector<W> weights(2 * radius + 1);
+  W norm = 0;
+  for (int i = -radius; i <= radius; i++) {
+    weights[i + radius] = std::exp(-static_cast<W>(i * i) / (2 * sigma * sigma));
+    norm += weights[i + radius];
+  }
+  for (W& w : weights) w /= norm;
+  return weights;
+}
+
+struct ConvolutionOptions {
+  BorderMode border = BorderMode::kReplicate;
+  // Run rank-one kernels as a horizontal and a vertical pass, 2(2r + 1) instead of (2r + 1)^2 taps per pixel.
+  // The passes round differently from the 2D sum, so callers that must match a 2D result bit for bit
+  // turn this off.
+  bool use_separable = true;
+  // Bytes of accumulator rows kept live per column tile: the 2r + 1 rows of the sliding window stay in L2
+  // while a tile of the next row is read through L1
+  size_t tile_bytes = size_t(1) << 17;
+};
+
+// Rows [first, last) of a band, and the rows [halo_first, halo_last) a radius-r filter reads to produce them
+struct RowBand {
+  int first = 0;
+  int last = 0;
+  int halo_first = 0;
+  int halo_last = 0;
+
+  int rows() const { return last - first; }
+  int halo_rows() const { return halo_last - halo_first; }
+};
+
+// Contiguous band `part` of `parts` with its ghost rows; bands differ in height by at most one row
+inline RowBand row_band(int height, int part, int parts, int radius) {
+  RowBand band;
+  band.first = static_cast<int>(static_cast<int64_t>(height) * part / parts);
+  band.last = static_cast<int>(static_cast<int64_t>(height) * (part + 1) / parts);
+  band.halo_first = std::max(0, band.first - radius);
+  band.halo_last = std::min(height, band.last + radius);
+  if (band.first == band.last) band.halo_first = band.halo_last = band.first;
+  return band;
+}
+
+namespace convolution_detail {
+
+// Loads pixels [x0 - r, x1 + r) of one source row into buf as Acc, resolving the horizontal border once here
+// instead of per tap. A null row is an all-zero row outside the image. uint8 pixels widen to Acc in this
+// single vectorizable pass, so the tap loops only see Acc.
+template <class In, class Acc>
+void load_padded(const In* row, const ImageShape& shape, int x0, int x1, int r, BorderMode border, Acc* buf) {
+  const int c = shape.channels;
+  const int lo = x0 - r;
+  const int hi = x1 + r;
+  if (row == nullptr) {
+    std::fill(buf, buf + static_cast<size_t>(hi - lo) * c, Acc(0));
+    return;
+  }
+  const int inner_lo = std::max(lo, 0);
+  const int inner_hi = std::min(hi, shape.width);
+  const In* src = row + static_cast<size_t>(inner_lo) * c;
+  Acc* dst = buf + static_cast<size_t>(inner_lo - lo) * c;
+  const int count = (inner_hi - inner_lo) * c;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+  for (int i = 0; i < count; i++) dst[i] = static_cast<Acc>(src[i]);
+
+  for (int x = lo; x < inner_lo; x++) {
+    for (int ch = 0; ch < c; ch++) {
+      buf[static_cast<size_t>(x - lo) * c + ch] = border == BorderMode::kZero ? Acc(0) : static_cast<Acc>(row[ch]);
+    }
+  }
+  const In* last = row + static_cast<size_t>(shape.width - 1) * c;
+  for (int x = inner_hi; x < hi; x++) {
+    for (int ch = 0; ch < c; ch++) {
+      buf[static_cast<size_t>(x - lo) * c + ch] = border == BorderMode::kZero ? Acc(0) : static_cast<Acc>(last[ch]);
+    }
+  }
+}
+
+// sum[i] = sum over k < N of w[k] * lines[k][i0 + i] for i < len, from zero in tap order. With the tap
+// count known at compile time the tap loop unrolls and each sum stays in a register.
+template <class Acc, size_t... K>
+void fixed_tap_sums(const Acc* const* lines, const Acc* w, int i0, int len, Acc* sum, std::index_sequence<K...>) {
+  const std::array<const Acc*, sizeof...(K)> l{(lines[K] + i0)...};
+  const std::array<Acc, sizeof...(K)> wk{w[K]...};
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+  for (int i = 0; i < len; i++) {
+    Acc s = 0;
+    ((s += wk[K] * l[K][i]), ...);
+    sum[i] = s;
+  }
+}
+
+// Sums s[i] = sum over k < count of w[k] * lines[k][i] for i < n, from zero in tap order, and hands them
+// to emit(first, s, len) in chunks, so the sums are written out once, already in their final form. The
+// usual 1-D and 3x3 tap counts are unrolled; otherwise each tap is one unit-stride vector pass over a
+// chunk held in a local accumulator.
+template <class Acc, class Emit>
+void weighted_sum(const Acc* const* lines, const Acc* w, int count, int n, Emit&& emit) {
+  constexpr int kChunk = 64;
+  std::array<Acc, kChunk> sum;
+  for (int i0 = 0; i0 < n; i0 += kChunk) {
+    const int len = std::min(kChunk, n - i0);
+    switch (count) {
+      case 3:
+        fixed_tap_sums(lines, w, i0, len, sum.data(), std::make_index_sequence<3>());
+        break;
+      case 5:
+        fixed_tap_sums(lines, w, i0, len, sum.data(), std::make_index_sequence<5>());
+        break;
+      case 7:
+        fixed_tap_sums(lines, w, i0, len, sum.data(), std::make_index_sequence<7>());
+        break;
+      case 9:
+        fixed_tap_sums(lines, w, i0, len, sum.data(), std::make_index_sequence<9>());
+        break;
+      default:
+        sum.fill(Acc(0));
+        for (int k = 0; k < count; k++) {
+          const Acc* line = lines[k] + i0;
+          const Acc wk = w[k];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+          for (int i = 0; i < len; i++) sum[i] += wk * line[i];
+        }
+    }
+    emit(i0, sum.data(), len);
+  }
+}
+
+inline int ring_slot(int y, int taps) { return ((y % taps) + taps) % taps; }
+
+}  // namespace convolution_detail
+
+// Convolves output rows [first_row, last_row) of an image of the given shape. src points at global row
+// src_first_row and must hold every row the window of those rows reads inside the image, i.e.
+// [max(0, first_row - r), min(height, last_row + r)), so a rank can pass its band with ghost rows. dst
+// points at output row first_row. Each output element is store(sum, x, y), where sum is the weighted
+// window sum in the accumulator type of the kernel; store does the rounding, clamping or normalization.
+//
+// Work goes in column tiles of options.tile_bytes: a ring of 2r + 1 rows slides down each tile, so every
+// source row is widened and padded once per tile and the tap loops run branch-free over contiguous,
+// interleaved channels.
+template <class In, class Out, class Acc, class Store>
+void convolve(const In* src, int src_first_row, Out* dst, int first_row, int last_row, const ImageShape& shape,
+              const ConvolutionKernel<Acc>& kernel, Store&& store, const ConvolutionOptions& options = {}) {
+  using convolution_detail::ring_slot;
+  if (shape.width <= 0 || shape.height <= 0 || shape.channels <= 0 || first_row < 0 || last_row > shape.height ||
+      first_row > last_row) {
+    throw std::invalid_argument("convolve: bad image shape or row range");
+  }
+  const int r = kernel.radius();
+  const int taps = kernel.taps();
+  const int c = shape.channels;
+  const size_t row_elements = shape.row_elements();
+  const bool separable = options.use_separable && kernel.separable();
+  const BorderMode border = options.border;
+
+  // Source row y, or null for a zero row outside the image
+  auto source_row = [&](int y) -> const In* {
+    if (y < 0 || y >= shape.height) {
+      if (border == BorderMode::kReplicate) {
+        y = std::clamp(y, 0, shape.height - 1);
+      } else {
+        return nullptr;
+      }
+    }
+    return src + static_cast<size_t>(y - src_first_row) * row_elements;
+  };
+
+  // With kValid only the interior is written
+  int y_lo = first_row;
+  int y_hi = last_row;
+  int x_lo = 0;
+  int x_hi = shape.width;
+  if (border == BorderMode::kValid) {
+    y_lo = std::max(y_lo, r);
+    y_hi = std::min(y_hi, shape.height - r);
+    x_lo = r;
+    x_hi = shape.width - r;
+  }
+  if (y_lo >= y_hi || x_lo >= x_hi) return;
+
+  const size_t per_pixel = static_cast<size_t>(taps) * c * sizeof(Acc);
+  const size_t fitting = std::max<size_t>(options.tile_bytes / per_pixel, 16);
+  const int tile = static_cast<int>(std::min<size_t>(fitting, shape.width));
+  std::vector<Acc> padded(static_cast<size_t>(tile + 2 * r) * c);
+  // Separable: horizontal-pass rows; 2D: padded source rows
+  const size_t ring_stride = separable ? static_cast<size_t>(tile) * c : padded.size();
+  std::vector<Acc> ring(ring_stride * taps);
+  // Start of the input each tap reads, at the first element of the tile
+  std::vector<const Acc*> lines(static_cast<size_t>(taps) * taps);
+
+  for (int x0 = x_lo; x0 < x_hi; x0 += tile) {
+    const int x1 = std::min(x0 + tile, x_hi);
+    const int n = (x1 - x0) * c;
+
+    // Puts source row y, filtered horizontally in the separable case, into its ring slot
+    auto advance = [&](int y) {
+      Acc* slot = ring.data() + ring_slot(y, taps) * ring_stride;
+      if (!separable) {
+        convolution_detail::load_padded(source_row(y), shape, x0, x1, r, border, slot);
+        return;
+      }
+      convolution_detail::load_padded(source_row(y), shape, x0, x1, r, border, padded.data());
+      for (int k = 0; k < taps; k++) lines[k] = padded.data() + k * c;
+      convolution_detail::weighted_sum(lines.data(), kernel.row().data(), taps, n,
+                                       [&](int i0, const Acc* sum, int len) { std::copy(sum, sum + len, slot + i0); });
+    };
+
+    for (int y = y_lo - r; y < y_lo + r; y++) advance(y);
+    for (int y = y_lo; y < y_hi; y++) {
+      advance(y + r);
+      for (int ky = 0; ky < taps; ky++) {
+        const Acc* line = ring.data() + ring_slot(y - r + ky, taps) * ring_stride;
+        if (separable) {
+          lines[ky] = line;
+        } else {
+          for (int kx = 0; kx < taps; kx++) lines[ky * taps + kx] = line + kx * c;
+        }
+      }
+      // The store runs on each chunk of sums as it completes; a store that ignores x drops the division
+      Out* out = dst + static_cast<size_t>(y - first_row) * row_elements + static_cast<size_t>(x0) * c;
+      auto emit = [&](int i0, const Acc* sum, int len) {
+        for (int i = 0; i < len; i++) out[i0 + i] = store(sum[i], x0 + (i0 + i) / c, y);
+      };
+      if (separable) {
+        convolution_detail::weighted_sum(lines.data(), kernel.column().data(), taps, n, emit);
+      } else {
+        convolution_detail::weighted_sum(lines.data(), kernel.weights().data(), taps * taps, n, emit);
+      }
+    }
+  }
+}
+
+// Whole-image overload
+template <class In, class Out, class Acc, class Store>
+void convolve(const In* src, Out* dst, const ImageShape& shape, const ConvolutionKernel<Acc>& kernel, Store&& store,
+              const ConvolutionOptions& options = {}) {
+  convolve(src, 0, dst, 0, shape.height, shape, kernel, std::forward<Store>(store), options);
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <barrier>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "util/cubature/include/adaptive_cubature.hpp"
+
+using ppc::util::adaptive_cubature;
+using ppc::util::CubatureOptions;
+using ppc::util::CubatureResult;
+
+namespace {
+
+// Unit-volume Gaussian peak of width 0.05 centred well inside the unit cube
+double gaussian_peak(const std::vector<double>& x) {
+  const double s = 0.05;
+  double r2 = 0.0;
+  for (double v : x) r2 += (v - 0.4) * (v - 0.4);
+  return std::exp(-r2 / (2 * s * s)) / std::pow(std::sqrt(2 * std::numbers::pi) * s, static_cast<double>(x.size()));
+}
+
+// Runs the cubature on `workers` threads that exchange estimates through a shared buffer, as ranks would
+std::vector<CubatureResult> run_workers(int workers, const std::vector<double>& lower, const std::vector<double>& upper,
+                                        const CubatureOptions& options) {
+  std::vector<CubatureResult> results(workers);
+  std::vector<double> shared;
+  std::barrier sync(workers);
+  std::vector<std::thread> threads;
+  for (int w = 0; w < workers; w++) {
+    threads.emplace_back([&, w] {
+      auto gather = [&](std::vector<double>& mine, std::vector<double>& all, const std::vector<int>& counts) {
+        size_t offset = 0;
+        size_t total = 0;
+        for (int k = 0; k < workers; k++) {
+          if (k < w) offset += counts[k];
+          total += counts[k];
+        }
+        if (w == 0) shared.assign(total, 0.0);
+        sync.arrive_and_wait();
+        std::copy(mine.begin(), mine.end(), shared.begin() + static_cast<std::ptrdiff_t>(offset));
+        sync.arrive_and_wait();
+        all = shared;
+        sync.arrive_and_wait();
+      };
+      results[w] = adaptive_cubature(gaussian_peak, lower, upper, options, w, workers, gather);
+    });
+  }
+  for (auto& t : threads) t.join();
+  return results;
+}
+
+}  // namespace
+
+TEST(cubature, gauss_kronrod_is_exact_for_polynomials_in_one_region) {
+  // Both the Kronrod and the embedded Gauss rule are exact up to degree 13
+  auto r = adaptive_cubature([](const std::vector<double>& x) { return std::pow(x[0], 12); }, {0.0}, {2.0});
+  EXPECT_TRUE(r.converged);
+  EXPECT_EQ(r.evaluations, 15u);
+  EXPECT_NEAR(r.value, std::pow(2.0, 13) / 13, 1e-9);
+}
+
+TEST(cubature, genz_malik_is_exact_for_quintics_in_one_region) {
+  auto f = [](const std::vector<double>& x) { return x[0] * x[0] * x[1] * x[1] * x[1] + x[2] * x[2]; };
+  auto r = adaptive_cubature(f, {0.0, 0.0, 0.0}, {1.0, 2.0, 3.0});
+  EXPECT_TRUE(r.converged);
+  EXPECT_EQ(r.evaluations, 8u + 18u + 6u + 1u);
+  // int x^2 y^3 = (1/3)(16/4)(3) and int z^2 = 2 * 9
+  EXPECT_NEAR(r.value, 4.0 + 18.0, 1e-12);
+}
+
+TEST(cubature, genz_malik_degree_seven_estimate) {
+  // The degree 5 rule misses x^4 y^3, so the region is refined, but the degree 7 value is already exact
+  auto f = [](const std::vector<double>& x) { return std::pow(x[0], 4) * std::pow(x[1], 3); };
+  CubatureOptions options;
+  options.max_evaluations = 1;
+  auto r = adaptive_cubature(f, {0.0, 0.0}, {1.0, 2.0}, options);
+  EXPECT_FALSE(r.converged);
+  EXPECT_NEAR(r.value, 4.0 / 5.0, 1e-12);
+}
+
+TEST(cubature, converges_on_peaked_integrand) {
+  for (size_t dim : {1, 2, 3, 4}) {
+    CubatureOptions options;
+    options.epsilon = 1e-5;
+    auto r = adaptive_cubature(gaussian_peak, std::vector<double>(dim, 0.0), std::vector<double>(dim, 1.0), options);
+    EXPECT_TRUE(r.converged) << dim;
+    EXPECT_LE(r.error, options.epsilon);
+    // The peak lies more than 7 widths from every face
+    EXPECT_NEAR(r.value, 1.0, 1e-5) << dim;
+  }
+}
+
+TEST(cubature, refinement_concentrates_on_the_singularity) {
+  // 1 / sqrt(x) has an integrable singularity at 0; uniform refinement would need far more points
+  CubatureOptions options;
+  options.epsilon = 1e-8;
+  auto r = adaptive_cubature([](const std::vector<double>& x) { return 1.0 / std::sqrt(x[0]); }, {0.0}, {1.0}, options);
+  EXPECT_TRUE(r.converged);
+  EXPECT_NEAR(r.value, 2.0, 1e-8);
+  EXPECT_LT(r.evaluations, 50000u);
+}
+
+TEST(cubature, relative_tolerance) {
+  CubatureOptions options;
+  options.epsilon = 0.0;
+  options.relative = 1e-9;
+  auto r = adaptive_cubature([](const std::vector<double>& x) { return 1e6 * std::exp(x[0] + x[1]); }, {0.0, 0.0},
+                             {1.0, 1.0}, options);
+  EXPECT_TRUE(r.converged);
+  EXPECT_NEAR(r.value, 1e6 * std::pow(std::numbers::e - 1, 2), 1e6 * 1e-9);
+}
+
+TEST(cubature, stops_at_max_evaluations) {
+  CubatureOptions options;
+  options.epsilon = 1e-14;
+  options.max_evaluations = 5000;
+  auto r = adaptive_cubature(gaussian_peak, {0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}, options);
+  EXPECT_FALSE(r.converged);
+  EXPECT_GE(r.evaluations, options.max_evaluations);
+  EXPECT_LT(r.evaluations, options.max_evaluations + 2 * options.regions_per_round * 33);
+}
+
+TEST(cubature, result_does_not_depend_on_worker_count) {
+  std::vector<double> lower{0.0, 0.0, 0.0};
+  std::vector<double> upper{1.0, 1.0, 1.0};
+  CubatureOptions options;
+  options.epsilon = 1e-6;
+  auto single = adaptive_cubature(gaussian_peak, lower, upper, options);
+  for (int workers : {2, 3, 5}) {
+    for (const auto& r : run_workers(workers, lower, upper, options)) {
+      EXPECT_EQ(r.value, single.value);
+      EXPECT_EQ(r.error, single.error);
+      EXPECT_EQ(r.evaluations, single.evaluations);
+      EXPECT_EQ(r.regions, single.regions);
+    }
+  }
+}
+
+TEST(cubature, rejects_mismatched_bounds) {
+  auto f = [](const std::vector<double>&) { return 1.0; };
+  EXPECT_THROW(adaptive_cubature(f, {0.0, 0.0}, {1.0}), std::invalid_argument);
+  EXPECT_THROW(adaptive_cubature(f, {}, {}), std::invalid_argument);
+}
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+namespace ppc::util {
+
+struct CubatureOptions {
+  // Stop once the summed error estimate is below max(epsilon, relative * |value|)
+  double epsilon = 1e-6;
+  double relative = 0.0;
+  // Integrand evaluations after which the best estimate so far is returned
+  uint64_t max_evaluations = uint64_t(1) << 26;
+  // Worst regions bisected per round; fixed so the refinement does not depend on the worker count
+  size_t regions_per_round = 16;
+};
+
+struct CubatureResult {
+  double value = 0.0;
+  double error = 0.0;
+  uint64_t evaluations = 0;
+  size_t regions = 0;
+  bool converged = false;
+};
+
+// Estimate of one region by a rule with an embedded lower-degree rule
+struct RegionEstimate {
+  double integral;
+  double error;
+  // Axis along which the region should be bisected next
+  size_t split;
+};
+
+// Genz-Malik degree 7 rule with an embedded degree 5 rule, 2^d + 2d^2 + 2d + 1 points (d >= 2).
+// The split axis is the one with the largest fourth divided difference through the centre.
+class GenzMalikRule {
+ public:
+  explicit GenzMalikRule(size_t dim) : dim_(dim) {
+    if (dim < 2) throw std::invalid_argument("Genz-Malik needs at least two dimensions");
+    auto d = static_cast<double>(dim);
+    w7_ = {(12824.0 - 9120.0 * d + 400.0 * d * d) / 19683.0, 980.0 / 6561.0, (1820.0 - 400.0 * d) / 19683.0,
+           200.0 / 19683.0, 6859.0 / 19683.0 / std::ldexp(1.0, static_cast<int>(dim))};
+    w5_ = {(729.0 - 950.0 * d + 50.0 * d * d) / 729.0, 245.0 / 486.0, (265.0 - 100.0 * d) / 1458.0, 25.0 / 729.0};
+  }
+
+  uint64_t points() const { return (uint64_t(1) << dim_) + 2 * dim_ * dim_ + 2 * dim_ + 1; }
+
+  template <class F>
+  RegionEstimate evaluate(F& f, const double* center, const double* half, std::vector<double>& x) const {
+    const double l2 = std::sqrt(9.0 / 70.0);
+    const double l3 = std::sqrt(9.0 / 10.0);
+    const double l4 = std::sqrt(9.0 / 10.0);
+    const double l5 = std::sqrt(9.0 / 19.0);
+
+    x.assign(center, center + dim_);
+    const double f0 = f(x);
+
+    double s2 = 0.0;
+    double s3 = 0.0;
+    size_t split = 0;
+    double worst = -1.0;
+    for (size_t i = 0; i < dim_; i++) {
+      x[i] = center[i] - l2 * half[i];
+      double a = f(x);
+      x[i] = center[i] + l2 * half[i];
+      double b = f(x);
+      x[i] = center[i] - l3 * half[i];
+      double c = f(x);
+      x[i] = center[i] + l3 * half[i];
+      double e = f(x);
+      x[i] = center[i];
+      s2 += a + b;
+      s3 += c + e;
+      double diff = std::abs((a + b - 2.0 * f0) - (l2 * l2) / (l3 * l3) * (c + e - 2.0 * f0));
+      if (diff > worst) {
+        worst = diff;
+        split = i;
+      }
+    }
+
+    double s4 = 0.0;
+    for (size_t i = 0; i < dim_; i++) {
+      for (size_t j = i + 1; j < dim_; j++) {
+        for (int si = -1; si <= 1; si += 2) {
+          for (int sj = -1; sj <= 1; sj += 2) {
+            x[i] = center[i] + si * l4 * half[i];
+            x[j] = center[j] + sj * l4 * half[j];
+            s4 += f(x);
+          }
+        }
+        x[i] = center[i];
+        x[j] = center[j];
+      }
+    }
+
+    // Corners of the l5 cube in Gray-code order, flipping one coordinate per point
+    double s5 = 0.0;
+    for (size_t i = 0; i < dim_; i++) x[i] = center[i] - l5 * half[i];
+    const uint64_t corners = uint64_t(1) << dim_;
+    for (uint64_t k = 0;; k++) {
+      s5 += f(x);
+      if (k + 1 == corners) break;
+      auto bit = static_cast<size_t>(std::countr_zero(k + 1));
+      x[bit] = 2.0 * center[bit] - x[bit];
+    }
+
+    double volume = 1.0;
+    for (size_t i = 0; i < dim_; i++) volume *= 2.0 * half[i];
+    double i7 = volume * (w7_[0] * f0 + w7_[1] * s2 + w7_[2] * s3 + w7_[3] * s4 + w7_[4] * s5);
+    double i5 = volume * (w5_[0] * f0 + w5_[1] * s2 + w5_[2] * s3 + w5_[3] * s4);
+    return {i7, std::abs(i7 - i5), split};
+  }
+
+ private:
+  size_t dim_;
+  std::array<double, 5> w7_;
+  std::array<double, 4> w5_;
+};
+
+// 15-point Gauss-Kronrod rule with the embedded 7-point Gauss rule, for one dimension
+class GaussKronrodRule {
+ public:
+  uint64_t points() const { return 15; }
+
+  template <class F>
+  RegionEstimate evaluate(F& f, const double* center, const double* half, std::vector<double>& x) const {
+    static constexpr std::array<double, 8> kNodes{
+        0.991455371120812639206854697526329, 0.949107912342758524526189684047851, 0.864864423359769072789712788640926,
+        0.741531185599394439863864773280788, 0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+        0.207784955007898467600689403773245, 0.0};
+    static constexpr std::array<double, 8> kKronrod{
+        0.022935322010529224963732008058970, 0.063092092629978553290700663189204, 0.104790010322250183839876322541518,
+        0.140653259715525918745189590510238, 0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+        0.204432940075298892414161999234649, 0.209482141084727828012999174891714};
+    // Gauss weights of the odd-indexed Kronrod nodes
+    static constexpr std::array<double, 4> kGauss{
+        0.129484966168869693270611432679082, 0.279705391489276667901467771423780, 0.381830050505118944950369775488975,
+        0.417959183673469387755102040816327};
+
+    x.assign(1, center[0]);
+    const double fc = f(x);
+    double kronrod = kKronrod[7] * fc;
+    double gauss = kGauss[3] * fc;
+    for (size_t k = 0; k < 7; k++) {
+      x[0] = center[0] - kNodes[k] * half[0];
+      double a = f(x);
+      x[0] = center[0] + kNodes[k] * half[0];
+      double b = f(x);
+      kronrod += kKronrod[k] * (a + b);
+      if (k % 2 == 1) gauss += kGauss[k / 2] * (a + b);
+    }
+    return {kronrod * half[0], std::abs(kronrod - gauss) * half[0], 0};
+  }
+};
+
+namespace cubature_detail {
+
+struct Region {
+  std::vector<double> center;
+  std::vector<double> half;
+  RegionEstimate estimate;
+};
+
+struct LargerError {
+  bool operator()(const Region& a, const Region& b) const { return a.estimate.error < b.estimate.error; }
+};
+
+template <class Rule, class F, class Gather>
+CubatureResult run(const Rule& rule, F& f, const std::vector<double>& lower, const std::vector<double>& upper,
+                   const CubatureOptions& options, int worker, int workers, Gather& gather) {
+  const size_t dim = lower.size();
+  std::vector<double> x(dim);
+  std::priority_queue<Region, std::vector<Region>, LargerError> heap;
+
+  std::vector<Region> children(1);
+  for (size_t i = 0; i < dim; i++) {
+    children[0].center.push_back(0.5 * (lower[i] + upper[i]));
+    children[0].half.push_back(0.5 * (upper[i] - lower[i]));
+  }
+
+  CubatureResult result;
+  std::vector<double> mine;
+  std::vector<double> all;
+  std::vector<int> counts(workers);
+  const size_t per_round = std::max<size_t>(options.regions_per_round, 1);
+  while (true) {
+    // Children are dealt out in contiguous blocks; each estimate travels as (integral, error, split)
+    size_t n = children.size();
+    for (int w = 0; w < workers; w++) {
+      counts[w] = static_cast<int>(3 * (n * (w + 1) / workers - n * w / workers));
+    }
+    mine.clear();
+    for (size_t c = n * worker / workers; c < n * (worker + 1) / workers; c++) {
+      auto e = rule.evaluate(f, children[c].center.data(), children[c].half.data(), x);
+      mine.insert(mine.end(), {e.integral, e.error, static_cast<double>(e.split)});
+    }
+    gather(mine, all, counts);
+    for (size_t c = 0; c < n; c++) {
+      children[c].estimate = {all[3 * c], all[3 * c + 1], static_cast<size_t>(all[3 * c + 2])};
+      result.value += children[c].estimate.integral;
+      result.error += children[c].estimate.error;
+      heap.push(std::move(children[c]));
+    }
+    result.evaluations += n * rule.points();
+
+    if (result.error <= std::max(options.epsilon, options.relative * std::abs(result.value))) {
+      result.converged = true;
+      break;
+    }
+    if (result.evaluations >= options.max_evaluations) break;
+
+    // Bisect the worst regions; every worker pops the same ones from its identical heap
+    children.clear();
+    for (size_t k = 0; k < per_round && !heap.empty(); k++) {
+      Region parent = heap.top();
+      heap.pop();
+      result.value -= parent.estimate.integral;
+      result.error -= parent.estimate.error;
+      size_t s = parent.estimate.split;
+      parent.half[s] *= 0.5;
+      Region left = parent;
+      left.center[s] -= parent.half[s];
+      parent.center[s] += parent.half[s];
+      children.push_back(std::move(left));
+      children.push_back(std::move(parent));
+    }
+  }
+
+  // Running sums drift over many rounds, so the final figures are summed afresh
+  result.regions = heap.size();
+  result.value = 0.0;
+  result.error = 0.0;
+  while (!heap.empty()) {
+    result.value += heap.top().estimate.integral;
+    result.error += heap.top().estimate.error;
+    heap.pop();
+  }
+  return result;
+}
+
+}  // namespace cubature_detail
+
+// Globally adaptive cubature over the box [lower, upper]: the region with the largest error estimate is
+// bisected until the total error estimate meets the tolerance. F is called as f(x) with x a
+// std::vector<double>& holding the point, so a lambda or functor inlines into the rule.
+//
+// Several workers cooperate by keeping identical region heaps: every round they split the same worst
+// regions and each evaluates a contiguous block of the children. gather(mine, all, counts) must concatenate
+// the workers' blocks (counts[w] doubles from worker w) into all, on every worker. The refinement, and so
+// the result, is the same for any number of workers.
+template <class F, class Gather>
+CubatureResult adaptive_cubature(F&& f, const std::vector<double>& lower, const std::vector<double>& upper,
+                                 const CubatureOptions& options, int worker, int workers, Gather&& gather) {
+  if (lower.empty() || lower.size() != upper.size()) throw std::invalid_argument("adaptive_cubature: bad bounds");
+  if (lower.size() == 1) {
+    return cubature_detail::run(GaussKronrodRule(), f, lower, upper, options, worker, workers, gather);
+  }
+  return cubature_detail::run(GenzMalikRule(lower.size()), f, lower, upper, options, worker, workers, gather);
+}
+
+template <class F>
+CubatureResult adaptive_cubature(F&& f, const std::vector<double>& lower, const std::vector<double>& upper,
+                                 const CubatureOptions& options = {}) {
+  auto copy = [](std::vector<double>& mine, std::vector<double>& all, const std::vector<int>&) { all = mine; };
+  return adaptive_cubature(f, lower, upper, options, 0, 1, copy);
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "util/geometry/include/geometry.hpp"
+
+using ppc::util::Point2;
+
+namespace {
+
+std::vector<Point2<double>> random_points(size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> coordinate(-100.0, 100.0);
+  std::vector<Point2<double>> points(n);
+  for (auto& p : points) p = {coordinate(gen), coordinate(gen)};
+  return points;
+}
+
+// Every point on or left of every hull edge, every hull turn strictly left
+template <class T>
+void expect_convex_hull_of(const std::vector<Point2<T>>& hull, const std::vector<Point2<T>>& points) {
+  ASSERT_GE(hull.size(), 3u);
+  for (size_t i = 0; i < hull.size(); i++) {
+    const auto& a = hull[i];
+    const auto& b = hull[(i + 1) % hull.size()];
+    EXPECT_GT(ppc::util::orientation(a, b, hull[(i + 2) % hull.size()]), 0);
+    for (const auto& p : points) EXPECT_GE(ppc::util::orientation(a, b, p), 0);
+  }
+}
+
+}  // namespace
+
+TEST(geometry, orientation_is_exact_near_degeneracy) {
+  EXPECT_EQ(ppc::util::orientation<double>({0, 0}, {1, 0}, {0, 1}), 1);
+  EXPECT_EQ(ppc::util::orientation<double>({0, 0}, {0, 1}, {1, 0}), -1);
+  EXPECT_EQ(ppc::util::orientation<double>({0, 0}, {1, 1}, {3, 3}), 0);
+
+  // Classic failure of the plain determinant: points a few ulps off the line y = x, far from the origin
+  const double base = 0.5;
+  const double ulp = std::nextafter(base, 1.0) - base;
+  for (int i = 0; i < 64; i++) {
+    for (int j = 0; j < 64; j++) {
+      Point2<double> p{base + i * ulp, base + j * ulp};
+      int expected = (j > i) - (j < i);
+      EXPECT_EQ(ppc::util::orientation<double>({12.0, 12.0}, {24.0, 24.0}, p), expected) << i << ' ' << j;
+    }
+  }
+}
+
+TEST(geometry, orientation_handles_large_integers) {
+  // Determinant 1 between products near 4e18: the plain double determinant rounds it to 0
+  Point2<int> a{-2000000000, -2000000000};
+  Point2<int> b{1091130615, 1387682509};
+  Point2<int> c{-1090374879, -1003108734};
+  EXPECT_EQ(ppc::util::orientation(a, b, c), 1);
+  EXPECT_EQ(ppc::util::orientation(a, c, b), -1);
+  EXPECT_EQ(ppc::util::orientation(a, Point2<int>{1000000000, 1000000000}, Point2<int>{-500000000, -500000000}), 0);
+}
+
+TEST(geometry, monotone_chain_orders_counter_clockwise_from_the_lowest_point) {
+  std::vector<Point2<double>> square{{1, 1}, {-1, 1}, {0, 0}, {-1, -1}, {1, -1}, {0.5, 0.2}};
+  auto hull = ppc::util::monotone_chain(square);
+  EXPECT_EQ(hull, (std::vector<Point2<double>>{{-1, -1}, {1, -1}, {1, 1}, {-1, 1}}));
+}
+
+TEST(geometry, collinear_points_are_kept_on_request) {
+  std::vector<Point2<int>> points{{0, 0}, {2, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 2}, {2, 2}, {4, 0}};
+  EXPECT_EQ(ppc::util::monotone_chain(points), (std::vector<Point2<int>>{{0, 0}, {4, 0}, {4, 4}, {0, 4}}));
+  EXPECT_EQ(ppc::util::monotone_chain(points, true),
+            (std::vector<Point2<int>>{{0, 0}, {2, 0}, {4, 0}, {4, 4}, {0, 4}, {0, 2}}));
+
+  std::vector<Point2<int>> line{{3, 3}, {1, 1}, {2, 2}, {0, 0}};
+  EXPECT_EQ(ppc::util::monotone_chain(line), (std::vector<Point2<int>>{{0, 0}, {3, 3}}));
+  EXPECT_EQ(ppc::util::monotone_chain(line, true), (std::vector<Point2<int>>{{0, 0}, {1, 1}, {2, 2}, {3, 3}}));
+}
+
+TEST(geometry, quickhull_matches_monotone_chain) {
+  for (unsigned seed = 1; seed <= 5; seed++) {
+    auto points = random_points(2000, seed);
+    auto hull = ppc::util::monotone_chain(points);
+    expect_convex_hull_of(hull, points);
+    EXPECT_EQ(ppc::util::quickhull(points), hull);
+  }
+  // Points on a circle are all hull vertices
+  std::vector<Point2<double>> circle;
+  for (int i = 0; i < 360; i++) {
+    const double angle = i * std::numbers::pi / 180;
+    circle.push_back({std::cos(angle), std::sin(angle)});
+  }
+  EXPECT_EQ(ppc::util::quickhull(circle), ppc::util::monotone_chain(circle));
+  EXPECT_EQ(ppc::util::quickhull(circle).size(), 360u);
+}
+
+TEST(geometry, akl_toussaint_keeps_the_hull) {
+  auto points = random_points(20000, 7);
+  auto kept = ppc::util::akl_toussaint(points);
+  EXPECT_LT(kept.size(), points.size() / 4);
+  EXPECT_EQ(ppc::util::monotone_chain(kept), ppc::util::monotone_chain(points));
+
+  // Points on the octagon's edges may lie on hull edges and survive
+  std::vector<Point2<int>> square{{0, 0}, {1, 0}, {2, 0}, {2, 2}, {0, 2}, {1, 1}};
+  auto filtered = ppc::util::akl_toussaint(square);
+  EXPECT_EQ(filtered.size(), 5u);
+  EXPECT_EQ(ppc::util::monotone_chain(filtered, true), ppc::util::monotone_chain(square, true));
+
+  ppc::util::PointCloud<double> cloud;
+  for (const auto& p : points) {
+    cloud.x.push_back(p.x);
+    cloud.y.push_back(p.y);
+  }
+  EXPECT_EQ(ppc::util::akl_toussaint(cloud), kept);
+}
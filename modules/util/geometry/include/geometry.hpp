@@ -0,0 +1,274 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace ppc::util {
+
+// A point packed as two coordinates, 16 bytes for double: sorting and scanning move values, never allocations
+template <class T>
+struct Point2 {
+  T x;
+  T y;
+
+  friend bool operator==(const Point2&, const Point2&) = default;
+};
+
+// By x, then y: the sweep order of the monotone chain
+template <class T>
+bool lex_less(const Point2<T>& a, const Point2<T>& b) {
+  return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+// Points with their coordinates in separate arrays (SoA), as the tasks receive them
+template <class T>
+struct PointCloud {
+  std::vector<T> x;
+  std::vector<T> y;
+
+  size_t size() const { return x.size(); }
+  Point2<T> operator[](size_t i) const { return {x[i], y[i]}; }
+};
+
+namespace geometry_detail {
+
+// a + b = s + e exactly
+inline void two_sum(double a, double b, double& s, double& e) {
+  s = a + b;
+  double b_virtual = s - a;
+  double a_virtual = s - b_virtual;
+  e = (a - a_virtual) + (b - b_virtual);
+}
+
+// a * b = p + e exactly
+inline void two_product(double a, double b, double& p, double& e) {
+  p = a * b;
+  e = std::fma(a, b, -p);
+}
+
+// Sign of the exact sum of n <= 16 terms. The terms are accumulated into a nonoverlapping expansion
+// (Shewchuk's grow-expansion with zero elimination), whose largest component carries the sign.
+inline int exact_sign(const double* terms, size_t n) {
+  double expansion[16];
+  size_t size = 0;
+  for (size_t i = 0; i < n; i++) {
+    double q = terms[i];
+    size_t kept = 0;
+    for (size_t j = 0; j < size; j++) {
+      double sum;
+      double error;
+      two_sum(q, expansion[j], sum, error);
+      if (error != 0.0) expansion[kept++] = error;
+      q = sum;
+    }
+    if (q != 0.0) expansion[kept++] = q;
+    size = kept;
+  }
+  if (size == 0) return 0;
+  return expansion[size - 1] > 0.0 ? 1 : -1;
+}
+
+// Relative error bound of the floating-point determinant below (Shewchuk's ccwerrboundA)
+constexpr double kEpsilon = std::numeric_limits<double>::epsilon() / 2;
+constexpr double kOrientationBound = (3.0 + 16.0 * kEpsilon) * kEpsilon;
+
+}  // namespace geometry_detail
+
+// +1 if c lies to the left of the directed line a->b (a, b, c counter-clockwise), -1 if to the right, 0 if
+// collinear. Exact for coordinates representable in double, which covers float and 32-bit integers: the
+// floating-point determinant decides whenever it is safely away from zero, and only near-degenerate triples
+// fall back to exact expansion arithmetic.
+template <class T>
+int orientation(const Point2<T>& a, const Point2<T>& b, const Point2<T>& c) {
+  const auto ax = static_cast<double>(a.x);
+  const auto ay = static_cast<double>(a.y);
+  const auto bx = static_cast<double>(b.x);
+  const auto by = static_cast<double>(b.y);
+  const auto cx = static_cast<double>(c.x);
+  const auto cy = static_cast<double>(c.y);
+  const double left = (ax - cx) * (by - cy);
+  const double right = (ay - cy) * (bx - cx);
+  const double det = left - right;
+  const double bound = geometry_detail::kOrientationBound * (std::abs(left) + std::abs(right));
+  if (det > bound) return 1;
+  if (-det > bound) return -1;
+  if (bound == 0.0) return 0;
+
+  // det = ax*by - ax*cy - cx*by - ay*bx + ay*cx + cy*bx, each product split into two exact terms
+  const double factors[6][2] = {{ax, by}, {-ax, cy}, {-cx, by}, {-ay, bx}, {ay, cx}, {cy, bx}};
+  double terms[12];
+  for (int i = 0; i < 6; i++) {
+    geometry_detail::two_product(factors[i][0], factors[i][1], terms[2 * i], terms[2 * i + 1]);
+  }
+  return geometry_detail::exact_sign(terms, 12);
+}
+
+// Convex hull by Andrew's monotone chain, counter-clockwise from the lexicographically smallest point.
+// Duplicates are dropped; points in the middle of hull edges are kept only with keep_collinear. Input of
+// collinear points yields its two ends, or all of them in order with keep_collinear.
+template <class T>
+std::vector<Point2<T>> monotone_chain(std::vector<Point2<T>> points, bool keep_collinear = false) {
+  std::sort(points.begin(), points.end(), lex_less<T>);
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+  const size_t n = points.size();
+  if (n < 3) return points;
+
+  // Whether a turn at the middle point removes it: right turns always, straight ones unless collinear are kept
+  auto removes = [keep_collinear](int turn) { return keep_collinear ? turn < 0 : turn <= 0; };
+  std::vector<Point2<T>> hull(2 * n);
+  size_t k = 0;
+  for (size_t i = 0; i < n; i++) {
+    while (k >= 2 && removes(orientation(hull[k - 2], hull[k - 1], points[i]))) k--;
+    hull[k++] = points[i];
+  }
+  const size_t lower = k + 1;
+  for (size_t i = n - 1; i-- > 0;) {
+    while (k >= lower && removes(orientation(hull[k - 2], hull[k - 1], points[i]))) k--;
+    hull[k++] = points[i];
+  }
+  // The last point closes the loop. With keep_collinear, a collinear input walks the upper chain back over
+  // the lower one; the lower chain alone is then the answer.
+  hull.resize(std::min(k - 1, n));
+  return hull;
+}
+
+namespace geometry_detail {
+
+// Appends the hull vertices strictly right of p->q, in order from p to q (p and q excluded)
+template <class T>
+void quickhull_side(const Point2<T>& p, const Point2<T>& q, const std::vector<Point2<T>>& side,
+                    std::vector<Point2<T>>& hull) {
+  if (side.empty()) return;
+  // Farthest from the line: a hull vertex. The distance only ranks candidates, the split below is exact.
+  auto distance = [&](const Point2<T>& r) {
+    return (static_cast<double>(q.x) - p.x) * (static_cast<double>(p.y) - r.y) -
+           (static_cast<double>(q.y) - p.y) * (static_cast<double>(p.x) - r.x);
+  };
+  const Point2<T> far = *std::max_element(side.begin(), side.end(), [&](const Point2<T>& a, const Point2<T>& b) {
+    return distance(a) < distance(b);
+  });
+  std::vector<Point2<T>> before;
+  std::vector<Point2<T>> after;
+  for (const auto& r : side) {
+    if (orientation(p, far, r) < 0) {
+      before.push_back(r);
+    } else if (orientation(far, q, r) < 0) {
+      after.push_back(r);
+    }
+  }
+  quickhull_side(p, far, before, hull);
+  hull.push_back(far);
+  quickhull_side(far, q, after, hull);
+}
+
+}  // namespace geometry_detail
+
+// Convex hull by QuickHull, in the same order as monotone_chain without collinear points. Expected
+// O(n log h); it discards interior points early, which pays off when few points lie on the hull.
+template <class T>
+std::vector<Point2<T>> quickhull(const std::vector<Point2<T>>& points) {
+  if (points.empty()) return {};
+  const auto [lo, hi] = std::minmax_element(points.begin(), points.end(), lex_less<T>);
+  const Point2<T> a = *lo;
+  const Point2<T> b = *hi;
+  if (a == b) return {a};
+  std::vector<Point2<T>> below;
+  std::vector<Point2<T>> above;
+  for (const auto& r : points) {
+    int turn = orientation(a, b, r);
+    if (turn < 0) below.push_back(r);
+    if (turn > 0) above.push_back(r);
+  }
+  std::vector<Point2<T>> hull{a};
+  geometry_detail::quickhull_side(a, b, below, hull);
+  hull.push_back(b);
+  geometry_detail::quickhull_side(b, a, above, hull);
+  return hull;
+}
+
+namespace geometry_detail {
+
+template <class T, class Get>
+std::vector<Point2<T>> akl_toussaint(size_t n, Get&& get) {
+  if (n == 0) return {};
+  // Extremes in the eight directions W, SW, S, SE, E, NE, N, NW: hull points in counter-clockwise order.
+  // Sums are taken in double so that integer coordinates cannot overflow.
+  auto key = [](const Point2<T>& p, int d) {
+    const auto x = static_cast<double>(p.x);
+    const auto y = static_cast<double>(p.y);
+    switch (d) {
+      case 0:
+        return x;
+      case 1:
+        return x + y;
+      case 2:
+        return y;
+      case 3:
+        return y - x;
+      case 4:
+        return -x;
+      case 5:
+        return -x - y;
+      case 6:
+        return -y;
+      default:
+        return x - y;
+    }
+  };
+  Point2<T> extremes[8];
+  double best[8];
+  for (int d = 0; d < 8; d++) {
+    extremes[d] = get(0);
+    best[d] = key(extremes[d], d);
+  }
+  for (size_t i = 1; i < n; i++) {
+    const Point2<T> p = get(i);
+    for (int d = 0; d < 8; d++) {
+      double v = key(p, d);
+      if (v < best[d]) {
+        best[d] = v;
+        extremes[d] = p;
+      }
+    }
+  }
+  std::vector<Point2<T>> polygon;
+  for (const auto& e : extremes) {
+    if (polygon.empty() || !(polygon.back() == e)) polygon.push_back(e);
+  }
+  while (polygon.size() > 1 && polygon.back() == polygon.front()) polygon.pop_back();
+
+  std::vector<Point2<T>> kept;
+  if (polygon.size() < 3) {
+    for (size_t i = 0; i < n; i++) kept.push_back(get(i));
+    return kept;
+  }
+  for (size_t i = 0; i < n; i++) {
+    const Point2<T> p = get(i);
+    bool inside = true;
+    for (size_t e = 0; e < polygon.size() && inside; e++) {
+      inside = orientation(polygon[e], polygon[(e + 1) % polygon.size()], p) > 0;
+    }
+    if (!inside) kept.push_back(p);
+  }
+  return kept;
+}
+
+}  // namespace geometry_detail
+
+// Akl-Toussaint heuristic: drops the points strictly inside the octagon spanned by the extreme points in eight
+// directions. Those are neither hull vertices nor on hull edges, so any hull of the result, with or without
+// collinear points, equals that of the input. On uniform data most points go in one O(n) pass.
+template <class T>
+std::vector<Point2<T>> akl_toussaint(const std::vector<Point2<T>>& points) {
+  return geometry_detail::akl_toussaint<T>(points.size(), [&](size_t i) { return points[i]; });
+}
+
+template <class T>
+std::vector<Point2<T>> akl_toussaint(const PointCloud<T>& cloud) {
+  return geometry_detail::akl_toussaint<T>(cloud.size(), [&](size_t i) { return cloud[i]; });
+}
+
+}  // namespace ppc::util
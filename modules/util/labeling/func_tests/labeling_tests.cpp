@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "util/labeling/include/labeling.hpp"
+
+using ppc::util::BandLabels;
+
+namespace {
+
+std::vector<int> random_image(int width, int height, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::bernoulli_distribution bit(density);
+  std::vector<int> image(static_cast<size_t>(width) * height);
+  for (auto& p : image) p = bit(gen) ? 1 : 0;
+  return image;
+}
+
+// Flood fill with an explicit stack: component label of every pixel, -1 for background
+std::vector<int> reference_labels(const std::vector<int>& image, int width, int height, int* count) {
+  std::vector<int> labels(image.size(), -1);
+  *count = 0;
+  std::vector<int> stack;
+  for (int start = 0; start < width * height; start++) {
+    if (image[start] == 0 || labels[start] >= 0) continue;
+    labels[start] = *count;
+    stack.push_back(start);
+    while (!stack.empty()) {
+      int p = stack.back();
+      stack.pop_back();
+      int x = p % width;
+      int y = p / width;
+      const int neighbours[4][2] = {{x - 1, y}, {x + 1, y}, {x, y - 1}, {x, y + 1}};
+      for (const auto& n : neighbours) {
+        if (n[0] < 0 || n[0] >= width || n[1] < 0 || n[1] >= height) continue;
+        int q = n[1] * width + n[0];
+        if (image[q] != 0 && labels[q] < 0) {
+          labels[q] = *count;
+          stack.push_back(q);
+        }
+      }
+    }
+    (*count)++;
+  }
+  return labels;
+}
+
+std::vector<int> paint(const std::vector<BandLabels>& bands, int width, int height) {
+  std::vector<int> labels(static_cast<size_t>(width) * height, -1);
+  for (const auto& band : bands) {
+    for (const auto& run : band.runs) {
+      for (int x = run.first; x <= run.last; x++) labels[run.row * width + x] = run.label;
+    }
+  }
+  return labels;
+}
+
+}  // namespace
+
+TEST(labeling, single_band_matches_flood_fill) {
+  const int width = 57;
+  const int height = 41;
+  for (double density : {0.2, 0.5, 0.7}) {
+    auto image = random_image(width, height, density, 1);
+    int expected_count = 0;
+    auto expected = reference_labels(image, width, height, &expected_count);
+    auto band = ppc::util::label_band(image.data(), width, 0, height);
+    EXPECT_EQ(band.count, expected_count);
+    // Both number components in raster order of their first pixel
+    EXPECT_EQ(paint({band}, width, height), expected) << density;
+  }
+}
+
+TEST(labeling, u_shapes_join_below_their_arms) {
+  const std::vector<int> image = {1, 0, 1, 0, 1,  //
+                                  1, 0, 1, 0, 1,  //
+                                  1, 1, 1, 0, 1,  //
+                                  1, 0, 0, 0, 1,  //
+                                  1, 1, 1, 1, 1};
+  auto band = ppc::util::label_band(image.data(), 5, 0, 5);
+  EXPECT_EQ(band.count, 1);
+  for (const auto& run : band.runs) EXPECT_EQ(run.label, 0);
+}
+
+TEST(labeling, bands_merge_into_the_whole_image_labels) {
+  const int width = 64;
+  const int height = 37;
+  auto image = random_image(width, height, 0.55, 2);
+  int expected_count = 0;
+  auto expected = reference_labels(image, width, height, &expected_count);
+  for (int blocks : {1, 2, 3, 8, 37, 100}) {
+    int count = 0;
+    auto bands = ppc::util::label_image(image.data(), width, height, blocks, &count);
+    EXPECT_EQ(count, expected_count) << blocks;
+    EXPECT_EQ(paint(bands, width, height), expected) << blocks;
+  }
+}
+
+TEST(labeling, empty_bands_do_not_break_the_chain) {
+  // A vertical bar crossing three bands, the middle one holding no rows
+  std::vector<int> image(4 * 3, 0);
+  for (int y = 0; y < 4; y++) image[y * 3 + 1] = 1;
+  std::vector<ppc::util::BandBorder> borders = {
+      ppc::util::border_of(ppc::util::label_band(image.data(), 3, 0, 2)),
+      ppc::util::border_of(ppc::util::label_band(image.data() + 6, 3, 2, 2)),
+      ppc::util::border_of(ppc::util::label_band(image.data() + 6, 3, 2, 4)),
+  };
+  int count = 0;
+  auto ids = ppc::util::merge_bands(borders, &count);
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(ids, (std::vector<int>{0, 0}));
+}
+
+TEST(labeling, border_runs_are_the_first_and_last_rows) {
+  const std::vector<int> image = {1, 0, 1,  //
+                                  0, 1, 0,  //
+                                  1, 1, 0};
+  auto band = ppc::util::label_band(image.data(), 3, 4, 7);
+  ASSERT_EQ(band.top().size(), 2u);
+  EXPECT_EQ(band.top()[1].first, 2);
+  ASSERT_EQ(band.bottom().size(), 1u);
+  EXPECT_EQ(band.bottom()[0].row, 6);
+  EXPECT_EQ(band.bottom()[0].last, 1);
+  EXPECT_EQ(band.count, 3);
+}
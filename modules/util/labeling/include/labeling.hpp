@@ -0,0 +1,207 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace ppc::util {
+
+// Horizontal run of foreground pixels [first, last] in one row. Its two ends are boundary pixels of the
+// component, and the ends of all runs contain every extreme point of the component.
+struct PixelRun {
+  int row;
+  int first;
+  int last;
+  int label;  // component within the band that produced the run
+};
+
+// Union-find with path halving; the smaller index becomes the root, so labels are deterministic
+class DisjointSets {
+ public:
+  explicit DisjointSets(size_t n = 0) : parent_(n) { std::iota(parent_.begin(), parent_.end(), 0); }
+
+  int find(int x) {
+    while (parent_[x] != x) {
+      parent_[x] = parent_[parent_[x]];
+      x = parent_[x];
+    }
+    return x;
+  }
+
+  int add() {
+    parent_.push_back(static_cast<int>(parent_.size()));
+    return parent_.back();
+  }
+
+  void unite(int a, int b) {
+    a = find(a);
+    b = find(b);
+    if (a != b) parent_[std::max(a, b)] = std::min(a, b);
+  }
+
+  // Relabels every element with the rank of its root among the roots, 0..count-1; returns count
+  int compress(std::vector<int>& ids) {
+    ids.assign(parent_.size(), -1);
+    int count = 0;
+    for (size_t i = 0; i < parent_.size(); i++) {
+      int root = find(static_cast<int>(i));
+      if (ids[root] < 0) ids[root] = count++;
+      ids[i] = ids[root];
+    }
+    return count;
+  }
+
+ private:
+  std::vector<int> parent_;
+};
+
+namespace labeling_detail {
+
+// Calls join(a, b) for every pair of 4-connected runs from two consecutive rows; both lists are sorted by first
+template <class Join>
+void overlapping_runs(const PixelRun* upper, size_t nu, const PixelRun* lower, size_t nl, Join&& join) {
+  size_t i = 0;
+  size_t j = 0;
+  while (i < nu && j < nl) {
+    if (upper[i].first <= lower[j].last && lower[j].first <= upper[i].last) join(upper[i], lower[j]);
+    // Advance whichever run ends first; the other may still overlap the next one
+    if (upper[i].last < lower[j].last) {
+      i++;
+    } else {
+      j++;
+    }
+  }
+}
+
+}  // namespace labeling_detail
+
+// 4-connected components of the nonzero pixels of rows [first_row, last_row), as labelled runs in row order
+struct BandLabels {
+  int first_row = 0;
+  int last_row = 0;
+  int count = 0;
+  std::vector<PixelRun> runs;
+
+  // Runs of the band's first and last row: all a neighbouring band needs to join components across the border
+  std::vector<PixelRun> top() const {
+    auto end = std::find_if(runs.begin(), runs.end(), [&](const PixelRun& r) { return r.row != first_row; });
+    return {runs.begin(), end};
+  }
+  std::vector<PixelRun> bottom() const {
+    auto begin = std::find_if(runs.rbegin(), runs.rend(), [&](const PixelRun& r) { return r.row != last_row - 1; });
+    return {begin.base(), runs.end()};
+  }
+};
+
+// Labels one band of a row-major image; rows points at row first_row. Only runs are stored, so memory and the
+// union-find scale with the number of runs rather than pixels.
+template <class T>
+BandLabels label_band(const T* rows, int width, int first_row, int last_row) {
+  BandLabels band;
+  band.first_row = first_row;
+  band.last_row = last_row;
+  DisjointSets sets;
+  // Run ends of the current row, written unconditionally and kept by advancing the count: on noisy images a
+  // branch per pixel mispredicts about every other pixel
+  std::vector<int> starts(width / 2 + 1);
+  std::vector<int> ends(width / 2 + 1);
+  size_t prev_begin = 0;
+  size_t prev_end = 0;
+  for (int y = first_row; y < last_row; y++) {
+    const T* row = rows + static_cast<size_t>(y - first_row) * width;
+    const size_t begin = band.runs.size();
+    size_t n = 0;
+    size_t m = 0;
+    int prev = 0;
+    for (int x = 0; x < width; x++) {
+      const int cur = row[x] != 0 ? 1 : 0;
+      starts[n] = x;
+      n += cur & (prev ^ 1);
+      ends[m] = x - 1;
+      m += prev & (cur ^ 1);
+      prev = cur;
+    }
+    ends[m] = width - 1;
+    for (size_t r = 0; r < n; r++) band.runs.push_back({y, starts[r], ends[r], sets.add()});
+    const auto* runs = band.runs.data();
+    labeling_detail::overlapping_runs(runs + prev_begin, prev_end - prev_begin, runs + begin,
+                                      band.runs.size() - begin, [&](const PixelRun& up, const PixelRun& down) {
+                                        sets.unite(up.label, down.label);
+                                      });
+    prev_begin = begin;
+    prev_end = band.runs.size();
+  }
+  std::vector<int> ids;
+  band.count = sets.compress(ids);
+  for (auto& run : band.runs) run.label = ids[run.label];
+  return band;
+}
+
+// What a band contributes to the merge: its rows, its component count and its border runs
+struct BandBorder {
+  int first_row = 0;
+  int last_row = 0;
+  int count = 0;
+  std::vector<PixelRun> top;
+  std::vector<PixelRun> bottom;
+};
+
+inline BandBorder border_of(const BandLabels& band) {
+  return {band.first_row, band.last_row, band.count, band.top(), band.bottom()};
+}
+
+// Joins the components of consecutive bands that touch across band borders. Component l of band k gets the
+// global label result[offset_k + l], where offset_k is the sum of the counts of the bands before it; global
+// labels are 0..count-1 in order of first appearance. Bands without rows are skipped.
+inline std::vector<int> merge_bands(const std::vector<BandBorder>& bands, int* count = nullptr) {
+  std::vector<int> offsets(bands.size() + 1, 0);
+  for (size_t k = 0; k < bands.size(); k++) offsets[k + 1] = offsets[k] + bands[k].count;
+  DisjointSets sets(offsets.back());
+  const BandBorder* prev = nullptr;
+  int prev_offset = 0;
+  for (size_t k = 0; k < bands.size(); k++) {
+    const auto& band = bands[k];
+    if (band.first_row == band.last_row) continue;
+    if (prev != nullptr && prev->last_row == band.first_row) {
+      labeling_detail::overlapping_runs(prev->bottom.data(), prev->bottom.size(), band.top.data(), band.top.size(),
+                                        [&](const PixelRun& up, const PixelRun& down) {
+                                          sets.unite(prev_offset + up.label, offsets[k] + down.label);
+                                        });
+    }
+    prev = &band;
+    prev_offset = offsets[k];
+  }
+  std::vector<int> ids;
+  int total = sets.compress(ids);
+  if (count != nullptr) *count = total;
+  return ids;
+}
+
+// Labels a whole image as `blocks` row bands labelled independently (in parallel with OpenMP) and joined at
+// their borders. Run labels are rewritten to global component labels.
+template <class T>
+std::vector<BandLabels> label_image(const T* image, int width, int height, int blocks, int* count = nullptr) {
+  blocks = std::max(1, std::min(blocks, std::max(height, 1)));
+  std::vector<BandLabels> bands(blocks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int k = 0; k < blocks; k++) {
+    int first = static_cast<int>(static_cast<long long>(height) * k / blocks);
+    int last = static_cast<int>(static_cast<long long>(height) * (k + 1) / blocks);
+    bands[k] = label_band(image + static_cast<size_t>(first) * width, width, first, last);
+  }
+  std::vector<BandBorder> borders;
+  borders.reserve(bands.size());
+  for (const auto& band : bands) borders.push_back(border_of(band));
+  auto ids = merge_bands(borders, count);
+  int offset = 0;
+  for (auto& band : bands) {
+    for (auto& run : band.runs) run.label = ids[offset + run.label];
+    offset += band.count;
+  }
+  return bands;
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+#include "util/qmc/include/low_discrepancy.hpp"
+#include "util/qmc/include/qmc_integrator.hpp"
+
+using ppc::util::HaltonSequence;
+using ppc::util::QmcOptions;
+using ppc::util::SamplingMethod;
+using ppc::util::SobolSequence;
+
+namespace {
+
+// Every one-dimensional projection of the first 2^m points has one point per interval of width 2^-m
+template <class Sequence>
+bool projections_stratified(Sequence& seq, int m) {
+  size_t dim = seq.dimension();
+  size_t n = size_t(1) << m;
+  std::vector<std::vector<int>> hits(dim, std::vector<int>(n, 0));
+  std::vector<double> p(dim);
+  seq.seek(0);
+  for (size_t i = 0; i < n; i++) {
+    seq.next(p.data());
+    for (size_t k = 0; k < dim; k++) hits[k][static_cast<size_t>(p[k] * n)]++;
+  }
+  for (const auto& h : hits) {
+    for (int c : h) {
+      if (c != 1) return false;
+    }
+  }
+  return true;
+}
+
+// prod_k (pi / 2) sin(pi x_k) integrates to 1 over the unit cube
+double sine_product(const double* x, size_t dim) {
+  double r = 1.0;
+  for (size_t k = 0; k < dim; k++) r *= std::numbers::pi / 2 * std::sin(std::numbers::pi * x[k]);
+  return r;
+}
+
+}  // namespace
+
+TEST(qmc, sobol_first_points) {
+  SobolSequence sobol(2);
+  const double expected[][2] = {{0.0, 0.0}, {0.5, 0.5}, {0.75, 0.25}, {0.25, 0.75}, {0.375, 0.375}};
+  double p[2];
+  for (const auto& e : expected) {
+    sobol.next(p);
+    EXPECT_NEAR(p[0], e[0], 1e-9);
+    EXPECT_NEAR(p[1], e[1], 1e-9);
+  }
+}
+
+TEST(qmc, halton_first_points) {
+  HaltonSequence halton(2);
+  const double expected[][2] = {{0.0, 0.0}, {0.5, 1.0 / 3}, {0.25, 2.0 / 3}, {0.75, 1.0 / 9}, {0.125, 4.0 / 9}};
+  double p[2];
+  for (const auto& e : expected) {
+    halton.next(p);
+    EXPECT_NEAR(p[0], e[0], 1e-12);
+    EXPECT_NEAR(p[1], e[1], 1e-12);
+  }
+}
+
+TEST(qmc, sobol_nets_survive_scrambling) {
+  SobolSequence plain(SobolSequence::kMaxDimension);
+  SobolSequence scrambled(SobolSequence::kMaxDimension, 7);
+  EXPECT_TRUE(projections_stratified(plain, 10));
+  EXPECT_TRUE(projections_stratified(scrambled, 10));
+}
+
+TEST(qmc, seek_matches_sequential_generation) {
+  SobolSequence a(5, 3);
+  SobolSequence b(5, 3);
+  HaltonSequence c(5, 3);
+  HaltonSequence d(5, 3);
+  std::vector<double> pa(5);
+  std::vector<double> pb(5);
+  for (int i = 0; i < 1000; i++) {
+    a.next(pa.data());
+    c.next(pb.data());
+  }
+  b.seek(1000);
+  d.seek(1000);
+  for (int i = 0; i < 10; i++) {
+    a.next(pa.data());
+    b.next(pb.data());
+    EXPECT_EQ(pa, pb);
+    c.next(pa.data());
+    d.next(pb.data());
+    EXPECT_EQ(pa, pb);
+  }
+}
+
+TEST(qmc, scrambled_points_stay_in_unit_cube) {
+  HaltonSequence halton(HaltonSequence::kMaxDimension, 11);
+  std::vector<double> p(HaltonSequence::kMaxDimension);
+  for (int i = 0; i < 2000; i++) {
+    halton.next(p.data());
+    for (double x : p) {
+      ASSERT_GE(x, 0.0);
+      ASSERT_LT(x, 1.0);
+    }
+  }
+}
+
+TEST(qmc, every_method_reaches_tolerance) {
+  const size_t dim = 3;
+  std::vector<double> lower(dim, 0.0);
+  std::vector<double> upper(dim, 1.0);
+  auto f = [&](const double* x) { return sine_product(x, dim); };
+  for (auto method : {SamplingMethod::kMonteCarlo, SamplingMethod::kAntithetic, SamplingMethod::kStratified,
+                      SamplingMethod::kHalton, SamplingMethod::kSobol}) {
+    QmcOptions options;
+    options.method = method;
+    options.epsilon = 2e-3;
+    auto result = ppc::util::qmc_integrate(f, lower, upper, options);
+    EXPECT_TRUE(result.converged);
+    EXPECT_LE(result.error, options.epsilon);
+    // Five standard errors
+    EXPECT_NEAR(result.value, 1.0, 5 * options.epsilon);
+  }
+}
+
+TEST(qmc, quasi_random_needs_fewer_samples_than_monte_carlo) {
+  const size_t dim = 4;
+  std::vector<double> lower(dim, 0.0);
+  std::vector<double> upper(dim, 1.0);
+  auto f = [&](const double* x) { return sine_product(x, dim); };
+  QmcOptions options;
+  options.epsilon = 1e-3;
+  options.method = SamplingMethod::kMonteCarlo;
+  auto mc = ppc::util::qmc_integrate(f, lower, upper, options);
+  options.method = SamplingMethod::kSobol;
+  auto sobol = ppc::util::qmc_integrate(f, lower, upper, options);
+  ASSERT_TRUE(mc.converged);
+  ASSERT_TRUE(sobol.converged);
+  EXPECT_LT(sobol.samples * 4, mc.samples);
+}
+
+TEST(qmc, workers_split_batches_without_changing_the_estimate) {
+  std::vector<double> lower{-1.0, 0.0};
+  std::vector<double> upper{2.0, 0.5};
+  auto f = [](const double* x) { return std::exp(-x[0] * x[0]) * (1.0 + x[1]); };
+  for (auto method : {SamplingMethod::kMonteCarlo, SamplingMethod::kStratified, SamplingMethod::kSobol}) {
+    QmcOptions options;
+    options.method = method;
+    options.epsilon = 1e-3;
+    auto whole = ppc::util::qmc_integrate(f, lower, upper, options);
+
+    // Emulate three workers: run each slice and reduce by summing their contributions
+    const int workers = 3;
+    std::vector<std::vector<std::vector<double>>> contributions(workers);
+    for (int w = 0; w < workers; w++) {
+      QmcOptions fixed = options;
+      fixed.epsilon = 0.0;
+      fixed.max_samples = whole.samples;
+      ppc::util::qmc_integrate(f, lower, upper, fixed, w, workers,
+                               [&](std::vector<double>& v) { contributions[w].push_back(v); });
+    }
+    size_t rounds = contributions[0].size();
+    size_t step = 0;
+    auto summed = [&](std::vector<double>& v) {
+      for (int w = 1; w < workers; w++) {
+        for (size_t i = 0; i < v.size(); i++) v[i] += contributions[w][step][i];
+      }
+      step++;
+    };
+    QmcOptions fixed = options;
+    fixed.epsilon = 0.0;
+    fixed.max_samples = whole.samples;
+    auto split = ppc::util::qmc_integrate(f, lower, upper, fixed, 0, workers, summed);
+    EXPECT_EQ(step, rounds);
+    EXPECT_EQ(split.samples, whole.samples);
+    EXPECT_NEAR(split.value, whole.value, 1e-12);
+    EXPECT_NEAR(split.error, whole.error, 1e-12);
+  }
+}
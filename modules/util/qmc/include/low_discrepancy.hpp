@@ -0,0 +1,204 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "util/rng/include/counter_rng.hpp"
+
+namespace ppc::util {
+
+namespace qmc_detail {
+
+// Random 32-bit words for scrambling, one independent Philox block per (seed, dim, word)
+inline uint32_t scramble_word(uint64_t seed, uint32_t dim, uint32_t word, uint32_t tag) {
+  return Philox4x32::generate({word, dim, tag, 0}, {uint32_t(seed), uint32_t(seed >> 32)})[0];
+}
+
+}  // namespace qmc_detail
+
+// Sobol sequence in Gray-code order with 32-bit resolution (Joe-Kuo direction numbers).
+// The scrambled form applies a random lower-triangular matrix and a digital shift per dimension
+// (Matousek's linear scrambling), which keeps the net structure and makes every point uniform.
+class SobolSequence {
+ public:
+  static constexpr size_t kMaxDimension = 16;
+  static constexpr int kBits = 32;
+
+  explicit SobolSequence(size_t dim) : dim_(dim), v_(dim), shift_(dim, 0), x_(dim, 0) {
+    if (dim == 0 || dim > kMaxDimension) throw std::invalid_argument("Sobol dimension out of range");
+    for (size_t k = 0; k < dim; k++) v_[k] = direction_numbers(k);
+  }
+
+  SobolSequence(size_t dim, uint64_t scramble_seed) : SobolSequence(dim) {
+    for (size_t k = 0; k < dim; k++) {
+      std::array<uint32_t, kBits> rows;
+      for (int i = 0; i < kBits; i++) {
+        // Row i produces output bit (31 - i) from input bits at or above it
+        uint32_t diagonal = 1U << (kBits - 1 - i);
+        uint32_t above = i == 0 ? 0U : ~((diagonal << 1) - 1U);
+        rows[i] = diagonal | (qmc_detail::scramble_word(scramble_seed, k, i, 0) & above);
+      }
+      for (auto& v : v_[k]) {
+        uint32_t out = 0;
+        for (int i = 0; i < kBits; i++) {
+          out |= static_cast<uint32_t>(std::popcount(rows[i] & v) & 1) << (kBits - 1 - i);
+        }
+        v = out;
+      }
+      shift_[k] = qmc_detail::scramble_word(scramble_seed, k, kBits, 1);
+    }
+    seek(0);
+  }
+
+  size_t dimension() const { return dim_; }
+  uint64_t index() const { return index_; }
+
+  // Direct evaluation of point index, O(kBits * dim)
+  void seek(uint64_t index) {
+    index_ = index;
+    uint64_t gray = index ^ (index >> 1);
+    for (size_t k = 0; k < dim_; k++) {
+      uint32_t x = 0;
+      for (int j = 0; j < kBits && (gray >> j) != 0; j++) {
+        if (((gray >> j) & 1) != 0) x ^= v_[k][j];
+      }
+      x_[k] = x;
+    }
+  }
+
+  // Writes the current point and advances; consecutive points differ in one direction number
+  void next(double* point) {
+    for (size_t k = 0; k < dim_; k++) point[k] = to_unit(x_[k] ^ shift_[k]);
+    int c = std::countr_one(index_);
+    if (c < kBits) {
+      for (size_t k = 0; k < dim_; k++) x_[k] ^= v_[k][c];
+    }
+    index_++;
+  }
+
+ private:
+  // Half-way into the 2^-32 cell, so no coordinate is exactly 0
+  static double to_unit(uint32_t x) { return (double(x) + 0.5) * 0x1.0p-32; }
+
+  static std::array<uint32_t, kBits> direction_numbers(size_t k) {
+    struct Primitive {
+      int degree;
+      uint32_t coefficients;
+      std::array<uint32_t, 6> m;
+    };
+    // new-joe-kuo-6.21201, dimensions 2..16
+    static constexpr std::array<Primitive, kMaxDimension - 1> kTable{{
+        {1, 0, {1}},
+        {2, 1, {1, 3}},
+        {3, 1, {1, 3, 1}},
+        {3, 2, {1, 1, 1}},
+        {4, 1, {1, 1, 3, 3}},
+        {4, 4, {1, 3, 5, 13}},
+        {5, 2, {1, 1, 5, 5, 17}},
+        {5, 4, {1, 1, 5, 5, 5}},
+        {5, 7, {1, 1, 7, 11, 19}},
+        {5, 11, {1, 1, 5, 1, 1}},
+        {5, 13, {1, 1, 1, 3, 11}},
+        {5, 14, {1, 3, 5, 5, 31}},
+        {6, 1, {1, 3, 3, 9, 7, 49}},
+        {6, 13, {1, 1, 1, 15, 21, 21}},
+        {6, 16, {1, 3, 1, 13, 27, 49}},
+    }};
+
+    std::array<uint32_t, kBits> v{};
+    if (k == 0) {
+      for (int j = 0; j < kBits; j++) v[j] = 1U << (kBits - 1 - j);
+      return v;
+    }
+    const auto& p = kTable[k - 1];
+    int s = p.degree;
+    for (int j = 0; j < s; j++) v[j] = p.m[j] << (kBits - 1 - j);
+    for (int j = s; j < kBits; j++) {
+      v[j] = v[j - s] ^ (v[j - s] >> s);
+      for (int i = 1; i < s; i++) {
+        if (((p.coefficients >> (s - 1 - i)) & 1) != 0) v[j] ^= v[j - i];
+      }
+    }
+    return v;
+  }
+
+  size_t dim_;
+  std::vector<std::array<uint32_t, kBits>> v_;
+  std::vector<uint32_t> shift_;
+  std::vector<uint32_t> x_;
+  uint64_t index_ = 0;
+};
+
+// Halton sequence over the first primes. The scrambled form replaces every digit of the radical
+// inverse by a random permutation drawn per (dimension, digit position), so the digits past the
+// index's own also come out random and the points are uniform on the whole cell.
+class HaltonSequence {
+ public:
+  static constexpr size_t kMaxDimension = 32;
+
+  explicit HaltonSequence(size_t dim) : dim_(dim), perm_(dim), digits_(dim) {
+    if (dim == 0 || dim > kMaxDimension) throw std::invalid_argument("Halton dimension out of range");
+    for (size_t k = 0; k < dim; k++) {
+      uint32_t b = kPrimes[k];
+      // Enough digits to exhaust double precision
+      digits_[k] = static_cast<int>(std::ceil(53.0 / std::log2(double(b))));
+    }
+  }
+
+  HaltonSequence(size_t dim, uint64_t scramble_seed) : HaltonSequence(dim) {
+    for (size_t k = 0; k < dim; k++) {
+      uint32_t b = kPrimes[k];
+      perm_[k].resize(size_t(digits_[k]) * b);
+      for (int d = 0; d < digits_[k]; d++) {
+        uint32_t* p = perm_[k].data() + size_t(d) * b;
+        std::iota(p, p + b, 0U);
+        for (uint32_t i = b - 1; i > 0; i--) {
+          uint32_t r = qmc_detail::scramble_word(scramble_seed, k, d * b + i, 2);
+          std::swap(p[i], p[r % (i + 1)]);
+        }
+      }
+    }
+  }
+
+  size_t dimension() const { return dim_; }
+  uint64_t index() const { return index_; }
+  void seek(uint64_t index) { index_ = index; }
+
+  void next(double* point) {
+    for (size_t k = 0; k < dim_; k++) point[k] = radical_inverse(k, index_);
+    index_++;
+  }
+
+ private:
+  static constexpr std::array<uint32_t, kMaxDimension> kPrimes{2,  3,  5,  7,  11, 13, 17, 19, 23,  29,  31,
+                                                               37, 41, 43, 47, 53, 59, 61, 67, 71,  73,  79,
+                                                               83, 89, 97, 101, 103, 107, 109, 113, 127, 131};
+
+  double radical_inverse(size_t k, uint64_t n) const {
+    uint32_t b = kPrimes[k];
+    double inv_b = 1.0 / b;
+    double scale = inv_b;
+    double x = 0.0;
+    if (perm_[k].empty()) {
+      for (; n != 0; n /= b, scale *= inv_b) x += double(n % b) * scale;
+      return x;
+    }
+    const uint32_t* p = perm_[k].data();
+    for (int d = 0; d < digits_[k]; d++, n /= b, scale *= inv_b, p += b) x += double(p[n % b]) * scale;
+    return x;
+  }
+
+  size_t dim_;
+  std::vector<std::vector<uint32_t>> perm_;
+  std::vector<int> digits_;
+  uint64_t index_ = 0;
+};
+
+}  // namespace ppc::util
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "util/qmc/include/low_discrepancy.hpp"
+#include "util/rng/include/counter_rng.hpp"
+
+namespace ppc::util {
+
+enum class SamplingMethod { kMonteCarlo, kAntithetic, kStratified, kHalton, kSobol };
+
+struct QmcOptions {
+  SamplingMethod method = SamplingMethod::kSobol;
+  // Target for the estimated standard error of the result
+  double epsilon = 1e-3;
+  // Upper bound on integrand evaluations
+  uint64_t max_samples = uint64_t(1) << 26;
+  // Points per replicate (or samples) added between two error checks; a power of two suits Sobol
+  uint64_t batch = 1024;
+  // Independently scrambled copies of the sequence used by the quasi-random methods
+  int replicates = 16;
+  uint64_t seed = 0;
+};
+
+struct QmcResult {
+  double value = 0.0;
+  double error = 0.0;
+  uint64_t samples = 0;
+  bool converged = false;
+};
+
+// Integrates f over the box [lower, upper] in batches until the standard error drops to epsilon.
+//
+// Every batch is a fixed range of global sample indices. Worker w of workers evaluates its slice of
+// that range (the quasi-random sequences seek() straight to it, the pseudo-random ones seek the
+// counter-based stream), then reduce(values) has to sum the vector element-wise over all workers.
+// All workers see the same sums and so agree on when to stop; with a single worker reduce can be a no-op.
+//
+// Error estimates: sample variance for Monte Carlo and antithetic pairs, per-stratum variances for
+// stratified sampling (each worker owns whole strata), and the spread between independently scrambled
+// replicates for Sobol and Halton.
+template <class F, class Reduce>
+QmcResult qmc_integrate(F&& f, const std::vector<double>& lower, const std::vector<double>& upper,
+                        const QmcOptions& options, int worker, int workers, Reduce&& reduce) {
+  size_t dim = lower.size();
+  if (dim == 0 || upper.size() != dim) throw std::invalid_argument("qmc_integrate: bad bounds");
+
+  double volume = 1.0;
+  for (size_t k = 0; k < dim; k++) volume *= upper[k] - lower[k];
+  std::vector<double> u(dim);
+  std::vector<double> x(dim);
+  auto eval_unit = [&](const double* unit) {
+    for (size_t k = 0; k < dim; k++) x[k] = lower[k] + (upper[k] - lower[k]) * unit[k];
+    return f(x.data());
+  };
+  auto slice = [&](uint64_t count, uint64_t& begin, uint64_t& end) {
+    begin = count * worker / workers;
+    end = count * (worker + 1) / workers;
+  };
+
+  // Shifting by the value at the centre keeps sum-of-squares variance formulas well conditioned
+  std::vector<double> centre(dim, 0.5);
+  const double shift = eval_unit(centre.data());
+
+  QmcResult result;
+  const uint64_t batch = std::max<uint64_t>(options.batch, 2);
+  std::vector<double> sums;
+
+  switch (options.method) {
+    case SamplingMethod::kMonteCarlo:
+    case SamplingMethod::kAntithetic: {
+      const bool antithetic = options.method == SamplingMethod::kAntithetic;
+      const uint64_t per_sample = antithetic ? 2 : 1;
+      CounterRng rng(options.seed);
+      std::vector<double> mirrored(dim);
+      double total = 0.0;
+      double total_sq = 0.0;
+      uint64_t n = 0;
+      while (result.samples < options.max_samples) {
+        uint64_t begin;
+        uint64_t end;
+        slice(batch, begin, end);
+        rng.seek((n + begin) * dim);
+        sums.assign(2, 0.0);
+        for (uint64_t i = begin; i < end; i++) {
+          rng.fill_uniform(u.data(), dim);
+          double g = eval_unit(u.data());
+          if (antithetic) {
+            for (size_t k = 0; k < dim; k++) mirrored[k] = 1.0 - u[k];
+            g = 0.5 * (g + eval_unit(mirrored.data()));
+          }
+          sums[0] += g - shift;
+          sums[1] += (g - shift) * (g - shift);
+        }
+        reduce(sums);
+        total += sums[0];
+        total_sq += sums[1];
+        n += batch;
+        result.samples = n * per_sample;
+
+        double mean = total / n;
+        double variance = std::max(0.0, (total_sq - total * mean) / (n - 1));
+        result.value = volume * (shift + mean);
+        result.error = volume * std::sqrt(variance / n);
+        if (result.error <= options.epsilon) {
+          result.converged = true;
+          break;
+        }
+      }
+      break;
+    }
+
+    case SamplingMethod::kStratified: {
+      // s^strata_dims equal cells over the leading dimensions, with s >= 2 as large as the batch allows;
+      // every round draws per_cell uniform samples in each cell
+      size_t strata_dims = std::min<size_t>(dim, std::max<size_t>(1, std::bit_width(batch) - 1));
+      auto s = static_cast<uint64_t>(std::floor(std::pow(double(batch), 1.0 / double(strata_dims)) + 1e-9));
+      uint64_t cells = 1;
+      for (size_t k = 0; k < strata_dims; k++) cells *= s;
+      const uint64_t per_cell = std::max<uint64_t>(batch / cells, 1);
+
+      uint64_t begin;
+      uint64_t end;
+      slice(cells, begin, end);
+      std::vector<double> cell_sum(end - begin, 0.0);
+      std::vector<double> cell_sq(end - begin, 0.0);
+      CounterRng rng(options.seed);
+      uint64_t n = 0;
+      while (result.samples < options.max_samples) {
+        rng.seek((n * cells + begin * per_cell) * dim);
+        for (uint64_t h = begin; h < end; h++) {
+          for (uint64_t j = 0; j < per_cell; j++) {
+            rng.fill_uniform(u.data(), dim);
+            uint64_t index = h;
+            for (size_t k = 0; k < strata_dims; k++) {
+              u[k] = (double(index % s) + u[k]) / double(s);
+              index /= s;
+            }
+            double g = eval_unit(u.data()) - shift;
+            cell_sum[h - begin] += g;
+            cell_sq[h - begin] += g * g;
+          }
+        }
+        n += per_cell;
+        result.samples = n * cells;
+        if (n < 2) continue;
+
+        // Sum over this worker's cells of the cell means and of the variances of those means
+        sums.assign(2, 0.0);
+        for (size_t c = 0; c < cell_sum.size(); c++) {
+          double mean = cell_sum[c] / n;
+          sums[0] += mean;
+          sums[1] += std::max(0.0, (cell_sq[c] - cell_sum[c] * mean) / (n - 1)) / n;
+        }
+        reduce(sums);
+        result.value = volume * (shift + sums[0] / cells);
+        result.error = volume * std::sqrt(sums[1]) / cells;
+        if (result.error <= options.epsilon) {
+          result.converged = true;
+          break;
+        }
+      }
+      break;
+    }
+
+    case SamplingMethod::kHalton:
+    case SamplingMethod::kSobol: {
+      const int replicates = std::max(options.replicates, 2);
+      std::vector<SobolSequence> sobol;
+      std::vector<HaltonSequence> halton;
+      for (int r = 0; r < replicates; r++) {
+        uint64_t seed = options.seed * 1000003ULL + r;
+        if (options.method == SamplingMethod::kSobol) {
+          sobol.emplace_back(dim, seed);
+        } else {
+          halton.emplace_back(dim, seed);
+        }
+      }
+      std::vector<double> totals(replicates, 0.0);
+      uint64_t n = 0;
+      while (result.samples < options.max_samples) {
+        uint64_t begin;
+        uint64_t end;
+        slice(batch, begin, end);
+        sums.assign(replicates, 0.0);
+        for (int r = 0; r < replicates; r++) {
+          for (uint64_t i = begin; i < end; i++) {
+            if (!sobol.empty()) {
+              if (i == begin) sobol[r].seek(n + begin);
+              sobol[r].next(u.data());
+            } else {
+              if (i == begin) halton[r].seek(n + begin);
+              halton[r].next(u.data());
+            }
+            sums[r] += eval_unit(u.data()) - shift;
+          }
+        }
+        reduce(sums);
+        n += batch;
+        result.samples = n * replicates;
+
+        double mean = 0.0;
+        for (int r = 0; r < replicates; r++) {
+          totals[r] += sums[r];
+          mean += totals[r] / n;
+        }
+        mean /= replicates;
+        double variance = 0.0;
+        for (int r = 0; r < replicates; r++) variance += (totals[r] / n - mean) * (totals[r] / n - mean);
+        variance /= replicates - 1;
+        result.value = volume * (shift + mean);
+        result.error = volume * std::sqrt(variance / replicates);
+        if (result.error <= options.epsilon) {
+          result.converged = true;
+          break;
+        }
+      }
+      break;
+    }
+  }
+  return result;
+}
+
+template <class F>
+QmcResult qmc_integrate(F&& f, const std::vector<double>& lower, const std::vector<double>& upper,
+                        const QmcOptions& options) {
+  return qmc_integrate(f, lower, upper, options, 0, 1, [](std::vector<double>&) {});
+}
+
+}  // namespace ppc::util
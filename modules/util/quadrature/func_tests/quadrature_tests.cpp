@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <barrier>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <numbers>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "util/quadrature/include/quadrature.hpp"
+
+using ppc::util::composite_quadrature;
+using ppc::util::QuadratureRule;
+using ppc::util::romberg;
+using ppc::util::RombergOptions;
+using ppc::util::RombergResult;
+
+namespace {
+
+double exp_integral(double a, double b) { return std::exp(b) - std::exp(a); }
+
+// Romberg on `workers` threads whose reduce hook sums through a shared slot, as an all_reduce would
+std::vector<RombergResult> romberg_on_workers(int workers, const RombergOptions& options) {
+  std::vector<RombergResult> results(workers);
+  std::vector<double> slots(workers);
+  std::barrier sync(workers);
+  std::vector<std::thread> threads;
+  for (int w = 0; w < workers; w++) {
+    threads.emplace_back([&, w] {
+      auto reduce = [&](std::vector<double>& sums) {
+        slots[w] = sums[0];
+        sync.arrive_and_wait();
+        sums[0] = 0.0;
+        for (double v : slots) sums[0] += v;
+        sync.arrive_and_wait();
+      };
+      results[w] = romberg([](double x) { return std::exp(x); }, 0.0, 3.0, options, w, workers, reduce);
+    });
+  }
+  for (auto& t : threads) t.join();
+  return results;
+}
+
+}  // namespace
+
+TEST(quadrature, rules_reach_their_order) {
+  // Halving h divides the error by 2^order
+  const std::pair<QuadratureRule, double> rules[] = {{QuadratureRule::kLeftRectangle, 1.0},
+                                                     {QuadratureRule::kMidpoint, 2.0},
+                                                     {QuadratureRule::kTrapezoid, 2.0},
+                                                     {QuadratureRule::kSimpson, 4.0}};
+  auto f = [](double x) { return std::exp(x); };
+  for (const auto& [rule, order] : rules) {
+    double e1 = std::abs(composite_quadrature(f, 0.0, 1.0, 16, rule) - exp_integral(0.0, 1.0));
+    double e2 = std::abs(composite_quadrature(f, 0.0, 1.0, 32, rule) - exp_integral(0.0, 1.0));
+    EXPECT_NEAR(std::log2(e1 / e2), order, 0.1);
+  }
+}
+
+TEST(quadrature, gauss_legendre_is_exact_to_degree_2p_minus_1) {
+  for (int p = 1; p <= 5; p++) {
+    auto f = [p](double x) { return std::pow(x, 2 * p - 1) + std::pow(x, 2 * p - 2); };
+    double exact = std::pow(2.0, 2 * p) / (2 * p) + std::pow(2.0, 2 * p - 1) / (2 * p - 1);
+    EXPECT_NEAR(composite_quadrature(f, 0.0, 2.0, 1, QuadratureRule::kGaussLegendre, p), exact, 1e-12 * exact) << p;
+  }
+}
+
+TEST(quadrature, simpson_is_exact_for_cubics) {
+  auto f = [](double x) { return x * x * x - 2 * x + 1; };
+  EXPECT_NEAR(composite_quadrature(f, -1.0, 3.0, 3, QuadratureRule::kSimpson), 20.0 - 8.0 + 4.0, 1e-12);
+}
+
+TEST(quadrature, ranges_add_up_to_the_full_rule) {
+  auto f = [](double x) { return std::sin(x) * x; };
+  const size_t n = 1001;
+  for (auto rule : {QuadratureRule::kLeftRectangle, QuadratureRule::kMidpoint, QuadratureRule::kTrapezoid,
+                    QuadratureRule::kSimpson, QuadratureRule::kGaussLegendre}) {
+    double full = composite_quadrature(f, 0.0, std::numbers::pi, n, rule);
+    double parts = 0.0;
+    const size_t pieces = 7;
+    for (size_t p = 0; p < pieces; p++) {
+      parts += composite_quadrature(f, 0.0, std::numbers::pi, n, rule, n * p / pieces, n * (p + 1) / pieces);
+    }
+    EXPECT_NEAR(parts, full, 1e-13);
+  }
+}
+
+TEST(quadrature, trapezoid_matches_textbook_formula) {
+  auto f = [](double x) { return 1.0 / (1.0 + x * x); };
+  const size_t n = 100;
+  const double h = 2.0 / n;
+  double sum = 0.5 * (f(-1.0) + f(1.0));
+  for (size_t i = 1; i < n; i++) sum += f(-1.0 + static_cast<double>(i) * h);
+  EXPECT_NEAR(composite_quadrature(f, -1.0, 1.0, n, QuadratureRule::kTrapezoid), sum * h, 1e-14);
+}
+
+TEST(quadrature, batch_and_type_erased_integrands_agree) {
+  auto f = [](double x) { return std::cos(3 * x); };
+  std::function<double(double)> erased = f;
+  ppc::util::BatchIntegrand batch = ppc::util::make_batch_integrand(f);
+  double direct = composite_quadrature(f, 0.0, 2.0, 1000, QuadratureRule::kMidpoint);
+  EXPECT_EQ(composite_quadrature(erased, 0.0, 2.0, 1000, QuadratureRule::kMidpoint), direct);
+  EXPECT_EQ(composite_quadrature(batch, 0.0, 2.0, 1000, QuadratureRule::kMidpoint), direct);
+}
+
+TEST(quadrature, compensated_sums) {
+  // 1 + 1e-16 * n loses every small term in naive summation
+  std::vector<double> v(1 << 16, 1e-16);
+  v[0] = 1.0;
+  ppc::util::KahanSum kahan;
+  for (double x : v) kahan.add(x);
+  double exact = 1.0 + 1e-16 * static_cast<double>(v.size() - 1);
+  EXPECT_NEAR(kahan.value(), exact, 1e-16);
+  EXPECT_NEAR(ppc::util::pairwise_sum(v.data(), v.size()), exact, 1e-15);
+
+  // A 2^24-point midpoint rule of a constant is exact only when the sums are compensated
+  double area = composite_quadrature([](double) { return 0.1; }, 0.0, 1.0, size_t(1) << 24, QuadratureRule::kMidpoint);
+  EXPECT_NEAR(area, 0.1, 1e-15);
+}
+
+TEST(quadrature, rejects_bad_arguments) {
+  auto f = [](double x) { return x; };
+  EXPECT_THROW(composite_quadrature(f, 0.0, 1.0, 0, QuadratureRule::kTrapezoid), std::invalid_argument);
+  EXPECT_THROW(composite_quadrature(f, 0.0, 1.0, 10, QuadratureRule::kTrapezoid, 5, 11), std::invalid_argument);
+  EXPECT_THROW(composite_quadrature(f, 0.0, 1.0, 10, QuadratureRule::kGaussLegendre, 6), std::invalid_argument);
+  EXPECT_EQ(composite_quadrature(f, 0.0, 1.0, 10, QuadratureRule::kTrapezoid, 4, 4), 0.0);
+}
+
+TEST(quadrature, romberg_reaches_tolerance_with_few_evaluations) {
+  RombergOptions options;
+  options.epsilon = 1e-12;
+  auto r = romberg([](double x) { return std::exp(x); }, 0.0, 3.0, options);
+  EXPECT_TRUE(r.converged);
+  EXPECT_NEAR(r.value, exp_integral(0.0, 3.0), 1e-11);
+  // Every node is evaluated once across all levels
+  EXPECT_EQ(r.evaluations, r.intervals + 1);
+  // The plain trapezoid rule needs about 2e6 subintervals for the same accuracy
+  EXPECT_LE(r.evaluations, 257u);
+}
+
+TEST(quadrature, romberg_without_extrapolation_is_the_trapezoid_rule) {
+  RombergOptions options;
+  options.extrapolate = false;
+  options.max_intervals = 1024;
+  auto f = [](double x) { return 1.0 / (1.0 + x * x); };
+  auto r = romberg(f, 0.0, 1.0, options);
+  EXPECT_FALSE(r.converged);
+  EXPECT_EQ(r.intervals, 1024u);
+  EXPECT_NEAR(r.value, composite_quadrature(f, 0.0, 1.0, 1024, QuadratureRule::kTrapezoid), 1e-15);
+}
+
+TEST(quadrature, romberg_min_levels_skip_early_coincidences) {
+  // The 1- and 2-interval trapezoid rules of sin^2 over full periods agree exactly at 0
+  auto f = [](double x) { return std::sin(x) * std::sin(x); };
+  auto r = romberg(f, 0.0, 2 * std::numbers::pi);
+  EXPECT_TRUE(r.converged);
+  EXPECT_NEAR(r.value, std::numbers::pi, 1e-10);
+}
+
+TEST(quadrature, romberg_block_cyclic_workers_agree) {
+  RombergOptions options;
+  options.epsilon = 1e-13;
+  options.block = 4;
+  auto single = romberg([](double x) { return std::exp(x); }, 0.0, 3.0, options);
+  for (int workers : {2, 3}) {
+    for (const auto& r : romberg_on_workers(workers, options)) {
+      EXPECT_NEAR(r.value, single.value, 1e-12);
+      EXPECT_EQ(r.evaluations, single.evaluations);
+      EXPECT_EQ(r.levels, single.levels);
+    }
+  }
+}
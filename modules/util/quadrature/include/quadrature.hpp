@@ -0,0 +1,294 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ppc::util {
+
+// f(x) for a single abscissa
+template <class F>
+concept ScalarIntegrand = std::invocable<F&, double> && std::convertible_to<std::invoke_result_t<F&, double>, double>;
+
+// f(x, y, n) fills y[k] = f(x[k]) for k < n
+template <class F>
+concept BatchIntegrandLike = std::invocable<F&, const double*, double*, size_t>;
+
+// Type-erased batch integrand: one indirect call per block of points instead of one per point
+using BatchIntegrand = std::function<void(const double* x, double* y, size_t n)>;
+
+// Evaluates a compile-time integrand over a block; once f is inlined the loop vectorizes
+template <ScalarIntegrand F>
+void evaluate_batch(F& f, const double* x, double* y, size_t n) {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+  for (size_t k = 0; k < n; k++) {
+    y[k] = static_cast<double>(f(x[k]));
+  }
+}
+
+template <ScalarIntegrand F>
+BatchIntegrand make_batch_integrand(F f) {
+  return [f = std::move(f)](const double* x, double* y, size_t n) mutable { evaluate_batch(f, x, y, n); };
+}
+
+// Neumaier's variant of Kahan summation, exact to within a couple of ulps of the true sum
+class KahanSum {
+ public:
+  void add(double v) {
+    double t = sum_ + v;
+    if (std::abs(sum_) >= std::abs(v)) {
+      comp_ += (sum_ - t) + v;
+    } else {
+      comp_ += (v - t) + sum_;
+    }
+    sum_ = t;
+  }
+  double value() const { return sum_ + comp_; }
+
+ private:
+  double sum_ = 0.0;
+  double comp_ = 0.0;
+};
+
+// Pairwise summation: O(log n) error growth, with four independent accumulators at the leaves
+inline double pairwise_sum(const double* v, size_t n) {
+  if (n <= 32) {
+    std::array<double, 4> acc{};
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+      for (size_t j = 0; j < 4; j++) acc[j] += v[k + j];
+    }
+    for (; k < n; k++) acc[0] += v[k];
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+  }
+  size_t half = n / 2;
+  return pairwise_sum(v, half) + pairwise_sum(v + half, n - half);
+}
+
+enum class QuadratureRule { kLeftRectangle, kMidpoint, kTrapezoid, kSimpson, kGaussLegendre };
+
+namespace quadrature_detail {
+
+constexpr size_t kBlock = 256;
+
+template <class F>
+void evaluate(F& f, const double* x, double* y, size_t n) {
+  if constexpr (BatchIntegrandLike<F>) {
+    f(x, y, n);
+  } else {
+    evaluate_batch(f, x, y, n);
+  }
+}
+
+// h * sum over subintervals i in [first, last) of sum_k w[k] f(a + (i + t[k]) h). Each block holds the
+// abscissae node by node, so the abscissa and integrand loops are unit-stride and vectorize.
+template <class F>
+double pattern_sum(F& f, double a, double h, size_t first, size_t last, const double* t, const double* w, size_t m) {
+  std::array<double, kBlock> x;
+  std::array<double, kBlock> y;
+  const size_t per_block = kBlock / m;
+  KahanSum total;
+  for (size_t i0 = first; i0 < last; i0 += per_block) {
+    const auto count = static_cast<int>(std::min(per_block, last - i0));
+    for (size_t k = 0; k < m; k++) {
+      const double base = static_cast<double>(i0) + t[k];
+      double* xk = x.data() + k * count;
+      for (int i = 0; i < count; i++) xk[i] = a + (base + static_cast<double>(i)) * h;
+    }
+    evaluate(f, x.data(), y.data(), count * m);
+    double block = 0.0;
+    for (size_t k = 0; k < m; k++) block += w[k] * pairwise_sum(y.data() + k * count, count);
+    total.add(block);
+  }
+  return total.value() * h;
+}
+
+// Gauss-Legendre nodes and weights on [-1, 1], nonnegative half; the rule with p points is row p - 1
+constexpr std::array<std::array<double, 3>, 5> kLegendreNodes{{{0.0, 0.0, 0.0},
+                                                               {0.5773502691896257645, 0.0, 0.0},
+                                                               {0.0, 0.7745966692414833770, 0.0},
+                                                               {0.3399810435848562648, 0.8611363115940525752, 0.0},
+                                                               {0.0, 0.5384693101056830910, 0.9061798459386639928}}};
+constexpr std::array<std::array<double, 3>, 5> kLegendreWeights{{{2.0, 0.0, 0.0},
+                                                                 {1.0, 0.0, 0.0},
+                                                                 {8.0 / 9.0, 5.0 / 9.0, 0.0},
+                                                                 {0.6521451548625461427, 0.3478548451374538574, 0.0},
+                                                                 {0.5688888888888888889, 0.4786286704993664680,
+                                                                  0.2369268850561890875}}};
+
+}  // namespace quadrature_detail
+
+// Contribution of subintervals [first, last) of the n-interval composite rule on [a, b]. Splitting
+// [0, n) into contiguous ranges and adding the parts gives the full rule, so ranks or threads can each
+// take a range. F is either a ScalarIntegrand, inlined into the block loop, or a BatchIntegrandLike.
+// gauss_points (1..5) is the number of Gauss-Legendre nodes per subinterval.
+template <class F>
+double composite_quadrature(F&& f, double a, double b, size_t n, QuadratureRule rule, size_t first, size_t last,
+                            int gauss_points = 3) {
+  if (n == 0 || first > last || last > n) throw std::invalid_argument("composite_quadrature: bad subinterval range");
+  if (first == last) return 0.0;
+  const double h = (b - a) / static_cast<double>(n);
+
+  // Both ends of the range, for the rules that share nodes between neighbouring subintervals
+  auto ends = [&](double& left, double& right) {
+    std::array<double, 2> x{a + static_cast<double>(first) * h, a + static_cast<double>(last) * h};
+    std::array<double, 2> y;
+    quadrature_detail::evaluate(f, x.data(), y.data(), 2);
+    left = y[0];
+    right = y[1];
+  };
+
+  switch (rule) {
+    case QuadratureRule::kLeftRectangle: {
+      const double t = 0.0;
+      const double w = 1.0;
+      return quadrature_detail::pattern_sum(f, a, h, first, last, &t, &w, 1);
+    }
+    case QuadratureRule::kMidpoint: {
+      const double t = 0.5;
+      const double w = 1.0;
+      return quadrature_detail::pattern_sum(f, a, h, first, last, &t, &w, 1);
+    }
+    case QuadratureRule::kTrapezoid: {
+      // Left nodes at full weight, then shift half a weight from the first node to the last
+      const double t = 0.0;
+      const double w = 1.0;
+      double left;
+      double right;
+      ends(left, right);
+      return quadrature_detail::pattern_sum(f, a, h, first, last, &t, &w, 1) + 0.5 * h * (right - left);
+    }
+    case QuadratureRule::kSimpson: {
+      // h / 6 (f_i + 4 f_mid + f_{i+1}), written as left nodes and midpoints plus the same end correction
+      const std::array<double, 2> t{0.0, 0.5};
+      const std::array<double, 2> w{1.0 / 3.0, 2.0 / 3.0};
+      double left;
+      double right;
+      ends(left, right);
+      return quadrature_detail::pattern_sum(f, a, h, first, last, t.data(), w.data(), 2) + h * (right - left) / 6.0;
+    }
+    case QuadratureRule::kGaussLegendre: {
+      if (gauss_points < 1 || gauss_points > 5) throw std::invalid_argument("composite_quadrature: 1..5 Gauss points");
+      const auto& nodes = quadrature_detail::kLegendreNodes[gauss_points - 1];
+      const auto& weights = quadrature_detail::kLegendreWeights[gauss_points - 1];
+      std::array<double, 5> t{};
+      std::array<double, 5> w{};
+      size_t m = 0;
+      for (size_t k = 0; k < 3; k++) {
+        if (weights[k] == 0.0) break;
+        t[m] = 0.5 * (1.0 - nodes[k]);
+        w[m++] = 0.5 * weights[k];
+        if (nodes[k] != 0.0) {
+          t[m] = 0.5 * (1.0 + nodes[k]);
+          w[m++] = 0.5 * weights[k];
+        }
+      }
+      return quadrature_detail::pattern_sum(f, a, h, first, last, t.data(), w.data(), m);
+    }
+  }
+  throw std::invalid_argument("composite_quadrature: unknown rule");
+}
+
+template <class F>
+double composite_quadrature(F&& f, double a, double b, size_t n, QuadratureRule rule, int gauss_points = 3) {
+  return composite_quadrature(std::forward<F>(f), a, b, n, rule, 0, n, gauss_points);
+}
+
+struct RombergOptions {
+  // Stop once successive extrapolated values differ by at most max(epsilon, relative * |value|)
+  double epsilon = 1e-10;
+  double relative = 0.0;
+  // The trapezoid levels stop refining before they would exceed this many subintervals
+  size_t max_intervals = size_t(1) << 24;
+  // Levels refined before the tolerance test is trusted, so early coincidences cannot stop the iteration
+  int min_levels = 4;
+  // Richardson extrapolation of the trapezoid sequence; without it the plain halving iteration is returned
+  bool extrapolate = true;
+  // New midpoints per block; blocks are dealt to the workers cyclically on every level
+  size_t block = 256;
+};
+
+struct RombergResult {
+  double value = 0.0;
+  double error = 0.0;
+  uint64_t evaluations = 0;
+  size_t intervals = 0;
+  int levels = 0;
+  bool converged = false;
+};
+
+// Romberg integration on [a, b]. Level k is the trapezoid rule with 2^k subintervals, built from level
+// k - 1 by evaluating only the 2^(k-1) new midpoints; the Richardson table over the levels converges like
+// h^(2k) for smooth f. The new midpoints of a level are split into blocks dealt out cyclically, worker
+// w taking blocks w, w + workers, ..., so every level stays balanced. reduce(sums) must replace sums with
+// their element-wise total over the workers; it is called once per level with a single double.
+template <class F, class Reduce>
+RombergResult romberg(F&& f, double a, double b, const RombergOptions& options, int worker, int workers,
+                      Reduce&& reduce) {
+  if (workers < 1 || worker < 0 || worker >= workers || options.block == 0) {
+    throw std::invalid_argument("romberg: bad worker layout");
+  }
+  RombergResult result;
+  std::vector<double> sums(1, 0.0);
+  if (worker == 0) {
+    std::array<double, 2> x{a, b};
+    std::array<double, 2> y;
+    quadrature_detail::evaluate(f, x.data(), y.data(), 2);
+    sums[0] = 0.5 * (b - a) * (y[0] + y[1]);
+  }
+  reduce(sums);
+  std::vector<double> prev{sums[0]};
+  std::vector<double> cur;
+  result.value = prev[0];
+  result.evaluations = 2;
+  result.intervals = 1;
+
+  const size_t stride = options.block * static_cast<size_t>(workers);
+  while (2 * result.intervals <= options.max_intervals) {
+    // Midpoint rule on the current subintervals, i.e. the new nodes of the next level
+    const size_t n = result.intervals;
+    sums[0] = 0.0;
+    for (size_t q = options.block * worker; q < n; q += stride) {
+      sums[0] += composite_quadrature(f, a, b, n, QuadratureRule::kMidpoint, q, std::min(q + options.block, n));
+    }
+    reduce(sums);
+    result.evaluations += n;
+    result.intervals = 2 * n;
+    result.levels++;
+
+    cur.assign(1, 0.5 * (prev[0] + sums[0]));
+    if (options.extrapolate) {
+      double factor = 1.0;
+      for (size_t j = 1; j <= prev.size(); j++) {
+        factor *= 4.0;
+        cur.push_back(cur[j - 1] + (cur[j - 1] - prev[j - 1]) / (factor - 1.0));
+      }
+    }
+    result.error = std::abs(cur.back() - prev.back());
+    result.value = cur.back();
+    prev.swap(cur);
+    if (result.levels >= options.min_levels &&
+        result.error <= std::max(options.epsilon, options.relative * std::abs(result.value))) {
+      result.converged = true;
+      break;
+    }
+  }
+  return result;
+}
+
+template <class F>
+RombergResult romberg(F&& f, double a, double b, const RombergOptions& options = {}) {
+  return romberg(std::forward<F>(f), a, b, options, 0, 1, [](std::vector<double>&) {});
+}
+
+}  // namespace ppc::util
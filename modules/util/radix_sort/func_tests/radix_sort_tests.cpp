@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "util/radix_sort/include/radix_sort.hpp"
+
+namespace {
+
+template <class T>
+std::vector<T> random_keys(size_t n, T lo, T hi, unsigned seed = 42) {
+  std::mt19937_64 gen(seed);
+  std::vector<T> keys(n);
+  if constexpr (std::is_integral_v<T>) {
+    std::uniform_int_distribution<T> dist(lo, hi);
+    for (auto& k : keys) k = dist(gen);
+  } else {
+    std::uniform_real_distribution<T> dist(lo, hi);
+    for (auto& k : keys) k = dist(gen);
+  }
+  return keys;
+}
+
+template <class T>
+void expect_sorted_like_std(std::vector<T> keys) {
+  auto expected = keys;
+  std::sort(expected.begin(), expected.end());
+  ppc::util::radix_sort(keys);
+  EXPECT_EQ(keys, expected);
+}
+
+template <class T>
+void expect_parallel_sorted_like_std(std::vector<T> keys, int threads) {
+  auto expected = keys;
+  std::sort(expected.begin(), expected.end());
+  ppc::util::parallel_radix_sort(keys, threads);
+  EXPECT_EQ(keys, expected);
+}
+
+}  // namespace
+
+TEST(radix_sort, empty_and_single) {
+  std::vector<double> empty;
+  ppc::util::radix_sort(empty);
+  EXPECT_TRUE(empty.empty());
+  std::vector<double> one{-3.5};
+  ppc::util::radix_sort(one);
+  EXPECT_EQ(one, std::vector<double>{-3.5});
+}
+
+TEST(radix_sort, int32_keys) {
+  expect_sorted_like_std(random_keys<int32_t>(5000, std::numeric_limits<int32_t>::min(),
+                                              std::numeric_limits<int32_t>::max()));
+}
+
+TEST(radix_sort, int64_keys) {
+  expect_sorted_like_std(random_keys<int64_t>(5000, std::numeric_limits<int64_t>::min(),
+                                              std::numeric_limits<int64_t>::max()));
+}
+
+TEST(radix_sort, float_keys) { expect_sorted_like_std(random_keys<float>(5000, -1e6F, 1e6F)); }
+
+TEST(radix_sort, double_keys) { expect_sorted_like_std(random_keys<double>(5000, -1e300, 1e300)); }
+
+TEST(radix_sort, double_special_values) {
+  const double inf = std::numeric_limits<double>::infinity();
+  std::vector<double> keys{0.0, -0.0, inf, -inf, std::numeric_limits<double>::denorm_min(), -1.0, 1.0,
+                           -1e-300, std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max()};
+  ppc::util::radix_sort(keys);
+  EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+  EXPECT_TRUE(std::signbit(keys[4]));
+  EXPECT_FALSE(std::signbit(keys[5]));
+}
+
+TEST(radix_sort, small_range_keys_skip_constant_digits) {
+  // Only the low digit varies, every other pass is skipped
+  expect_sorted_like_std(random_keys<int64_t>(20000, 0, 200));
+  expect_sorted_like_std(random_keys<int32_t>(20000, -100, 100));
+}
+
+TEST(radix_sort, all_equal_keys) { expect_sorted_like_std(std::vector<double>(1000, 2.5)); }
+
+TEST(radix_sort, large_input_uses_combining_scatter) {
+  expect_sorted_like_std(random_keys<double>(100000, -1000.0, 1000.0));
+  expect_sorted_like_std(random_keys<int32_t>(100000, -1000000, 1000000));
+}
+
+TEST(radix_sort, pairs_are_permuted_together_and_stable) {
+  auto keys = random_keys<int32_t>(10000, -50, 50);
+  std::vector<size_t> values(keys.size());
+  for (size_t i = 0; i < values.size(); i++) values[i] = i;
+
+  std::vector<std::pair<int32_t, size_t>> expected(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) expected[i] = {keys[i], i};
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const auto& l, const auto& r) { return l.first < r.first; });
+
+  ppc::util::radix_sort_pairs(keys, values);
+  for (size_t i = 0; i < keys.size(); i++) {
+    ASSERT_EQ(keys[i], expected[i].first);
+    ASSERT_EQ(values[i], expected[i].second);
+  }
+}
+
+TEST(radix_sort, double_keys_with_float_values) {
+  auto keys = random_keys<double>(3000, -10.0, 10.0);
+  std::vector<float> values(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) values[i] = static_cast<float>(keys[i]) * 2.0F;
+  ppc::util::radix_sort_pairs(keys, values);
+  EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+  for (size_t i = 0; i < keys.size(); i++) EXPECT_EQ(values[i], static_cast<float>(keys[i]) * 2.0F);
+}
+
+TEST(radix_sort, parallel_matches_std_sort) {
+  for (int threads : {1, 2, 3, 4}) {
+    expect_parallel_sorted_like_std(random_keys<double>(200000, -1e9, 1e9, threads), threads);
+    expect_parallel_sorted_like_std(random_keys<int64_t>(200000, -5000, 5000, threads), threads);
+    expect_parallel_sorted_like_std(random_keys<float>(100000, -1.0F, 1.0F, threads), threads);
+  }
+}
+
+TEST(radix_sort, parallel_small_input_falls_back) {
+  expect_parallel_sorted_like_std(random_keys<int32_t>(100, -100, 100), 8);
+}
@@ -0,0 +1,312 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ppc::util {
+
+// Order-preserving mapping of a key onto an unsigned integer of the same width,
+// so that comparing the images as unsigned values gives the order of the keys.
+template <class Key>
+struct RadixTraits;
+
+template <>
+struct RadixTraits<int32_t> {
+  using Bits = uint32_t;
+  static Bits encode(int32_t key) { return static_cast<Bits>(key) ^ 0x80000000U; }
+  static int32_t decode(Bits bits) { return static_cast<int32_t>(bits ^ 0x80000000U); }
+};
+
+template <>
+struct RadixTraits<int64_t> {
+  using Bits = uint64_t;
+  static Bits encode(int64_t key) { return static_cast<Bits>(key) ^ 0x8000000000000000ULL; }
+  static int64_t decode(Bits bits) { return static_cast<int64_t>(bits ^ 0x8000000000000000ULL); }
+};
+
+template <class Float, class UInt>
+struct FloatRadixTraits {
+  using Bits = UInt;
+  static constexpr Bits sign = Bits(1) << (8 * sizeof(Bits) - 1);
+  // Negative values have all bits inverted, non-negative ones only get the sign bit set
+  static Bits encode(Float key) {
+    Bits bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    return (bits & sign) != 0 ? ~bits : bits | sign;
+  }
+  static Float decode(Bits bits) {
+    bits = (bits & sign) != 0 ? bits & ~sign : ~bits;
+    Float key;
+    std::memcpy(&key, &bits, sizeof(key));
+    return key;
+  }
+};
+
+template <>
+struct RadixTraits<float> : FloatRadixTraits<float, uint32_t> {};
+
+template <>
+struct RadixTraits<double> : FloatRadixTraits<double, uint64_t> {};
+
+namespace radix_detail {
+
+constexpr int kRadixBits = 8;
+constexpr size_t kBuckets = size_t(1) << kRadixBits;
+// One 64-byte cache line of keys per bucket in the write-combining buffers
+constexpr size_t kWcBytes = 64;
+// Below this size the staging buffers cost more than the scattered stores they save
+constexpr size_t kWcThreshold = 1 << 14;
+
+template <class Bits>
+constexpr int digit_count() {
+  return static_cast<int>(sizeof(Bits));
+}
+
+template <class Bits>
+inline size_t digit(Bits bits, int d) {
+  return static_cast<size_t>((bits >> (d * kRadixBits)) & (kBuckets - 1));
+}
+
+template <class Bits>
+using Histograms = std::vector<std::array<size_t, kBuckets>>;
+
+// All digit histograms are built in a single read of the keys
+template <class Bits>
+void build_histograms(const Bits* bits, size_t n, Histograms<Bits>& hist) {
+  hist.assign(digit_count<Bits>(), std::array<size_t, kBuckets>{});
+  for (size_t i = 0; i < n; i++) {
+    for (int d = 0; d < digit_count<Bits>(); d++) {
+      hist[d][digit(bits[i], d)]++;
+    }
+  }
+}
+
+// A pass whose digit is the same for every key would only copy the array
+template <class Bits>
+bool trivial_pass(const std::array<size_t, kBuckets>& count, Bits first, int d, size_t n) {
+  return count[digit(first, d)] == n;
+}
+
+inline void exclusive_scan(const std::array<size_t, kBuckets>& count, size_t* offset) {
+  size_t sum = 0;
+  for (size_t b = 0; b < kBuckets; b++) {
+    offset[b] = sum;
+    sum += count[b];
+  }
+}
+
+template <class Bits>
+void scatter(const Bits* src, Bits* dst, size_t begin, size_t end, int d, size_t* offset) {
+  for (size_t i = begin; i < end; i++) {
+    dst[offset[digit(src[i], d)]++] = src[i];
+  }
+}
+
+// Keys are staged in per-bucket cache-line buffers and written out a line at a time,
+// which keeps the number of destination streams touched per store low.
+template <class Bits>
+void scatter_combining(const Bits* src, Bits* dst, size_t begin, size_t end, int d, size_t* offset) {
+  constexpr size_t line = kWcBytes / sizeof(Bits);
+  std::vector<Bits> staging(kBuckets * line);
+  std::array<uint8_t, kBuckets> fill{};
+  for (size_t i = begin; i < end; i++) {
+    size_t b = digit(src[i], d);
+    Bits* slot = staging.data() + b * line;
+    slot[fill[b]++] = src[i];
+    if (fill[b] == line) {
+      std::memcpy(dst + offset[b], slot, sizeof(slot[0]) * line);
+      offset[b] += line;
+      fill[b] = 0;
+    }
+  }
+  for (size_t b = 0; b < kBuckets; b++) {
+    std::memcpy(dst + offset[b], staging.data() + b * line, sizeof(Bits) * fill[b]);
+    offset[b] += fill[b];
+  }
+}
+
+template <class Bits, class Value>
+void scatter_pairs(const Bits* src, const Value* src_values, Bits* dst, Value* dst_values, size_t n, int d,
+                   size_t* offset) {
+  for (size_t i = 0; i < n; i++) {
+    size_t pos = offset[digit(src[i], d)]++;
+    dst[pos] = src[i];
+    dst_values[pos] = src_values[i];
+  }
+}
+
+}  // namespace radix_detail
+
+// Stable LSD radix sort of [first, last) for int32_t, int64_t, float and double keys.
+// Digit passes that would not move anything are skipped, and the passes ping-pong
+// between two scratch buffers instead of copying back after each one.
+template <class Key>
+void radix_sort(Key* first, Key* last) {
+  using Traits = RadixTraits<Key>;
+  using Bits = typename Traits::Bits;
+  using namespace radix_detail;
+
+  size_t n = static_cast<size_t>(last - first);
+  if (n < 2) return;
+
+  std::vector<Bits> a(n);
+  std::vector<Bits> b(n);
+  for (size_t i = 0; i < n; i++) a[i] = Traits::encode(first[i]);
+
+  Histograms<Bits> hist;
+  build_histograms(a.data(), n, hist);
+
+  Bits* src = a.data();
+  Bits* dst = b.data();
+  std::array<size_t, kBuckets> offset;
+  for (int d = 0; d < digit_count<Bits>(); d++) {
+    if (trivial_pass(hist[d], src[0], d, n)) continue;
+    exclusive_scan(hist[d], offset.data());
+    if (n >= kWcThreshold) {
+      scatter_combining(src, dst, 0, n, d, offset.data());
+    } else {
+      scatter(src, dst, 0, n, d, offset.data());
+    }
+    std::swap(src, dst);
+  }
+
+  for (size_t i = 0; i < n; i++) first[i] = Traits::decode(src[i]);
+}
+
+template <class Key>
+void radix_sort(std::vector<Key>& keys) {
+  radix_sort(keys.data(), keys.data() + keys.size());
+}
+
+// Stable sort of values[0, n) by keys[0, n); both arrays are permuted together
+template <class Key, class Value>
+void radix_sort_pairs(Key* keys, Value* values, size_t n) {
+  using Traits = RadixTraits<Key>;
+  using Bits = typename Traits::Bits;
+  using namespace radix_detail;
+  static_assert(std::is_copy_assignable_v<Value>, "values must be copy assignable");
+
+  if (n < 2) return;
+
+  std::vector<Bits> a(n);
+  std::vector<Bits> b(n);
+  std::vector<Value> va(values, values + n);
+  std::vector<Value> vb(n);
+  for (size_t i = 0; i < n; i++) a[i] = Traits::encode(keys[i]);
+
+  Histograms<Bits> hist;
+  build_histograms(a.data(), n, hist);
+
+  Bits* src = a.data();
+  Bits* dst = b.data();
+  Value* vsrc = va.data();
+  Value* vdst = vb.data();
+  std::array<size_t, kBuckets> offset;
+  for (int d = 0; d < digit_count<Bits>(); d++) {
+    if (trivial_pass(hist[d], src[0], d, n)) continue;
+    exclusive_scan(hist[d], offset.data());
+    scatter_pairs(src, vsrc, dst, vdst, n, d, offset.data());
+    std::swap(src, dst);
+    std::swap(vsrc, vdst);
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    keys[i] = Traits::decode(src[i]);
+    values[i] = vsrc[i];
+  }
+}
+
+template <class Key, class Value>
+void radix_sort_pairs(std::vector<Key>& keys, std::vector<Value>& values) {
+  radix_sort_pairs(keys.data(), values.data(), std::min(keys.size(), values.size()));
+}
+
+// Multithreaded variant: every thread histograms and scatters its own contiguous block,
+// and the per-thread histograms are scanned bucket-major so the result stays stable.
+// num_threads <= 0 uses the OpenMP default; without OpenMP this is radix_sort.
+template <class Key>
+void parallel_radix_sort(Key* first, Key* last, int num_threads = 0) {
+#ifdef _OPENMP
+  using Traits = RadixTraits<Key>;
+  using Bits = typename Traits::Bits;
+  using namespace radix_detail;
+
+  size_t n = static_cast<size_t>(last - first);
+  int threads = num_threads > 0 ? num_threads : omp_get_max_threads();
+  threads = static_cast<int>(std::min<size_t>(threads, n / kWcThreshold));
+  if (threads < 2) {
+    radix_sort(first, last);
+    return;
+  }
+
+  std::vector<Bits> a(n);
+  std::vector<Bits> b(n);
+  Histograms<Bits> hist(digit_count<Bits>(), std::array<size_t, kBuckets>{});
+  std::vector<std::array<size_t, kBuckets>> local(threads);
+  Bits* src = a.data();
+  Bits* dst = b.data();
+
+#pragma omp parallel num_threads(threads)
+  {
+    int t = omp_get_thread_num();
+    size_t begin = n * t / threads;
+    size_t end = n * (t + 1) / threads;
+
+    Histograms<Bits> mine(digit_count<Bits>(), std::array<size_t, kBuckets>{});
+    for (size_t i = begin; i < end; i++) {
+      a[i] = Traits::encode(first[i]);
+      for (int d = 0; d < digit_count<Bits>(); d++) mine[d][digit(a[i], d)]++;
+    }
+#pragma omp critical
+    for (int d = 0; d < digit_count<Bits>(); d++) {
+      for (size_t k = 0; k < kBuckets; k++) hist[d][k] += mine[d][k];
+    }
+#pragma omp barrier
+
+    for (int d = 0; d < digit_count<Bits>(); d++) {
+      // src, dst and the pass outcome are shared, so every thread takes the same branch
+      if (trivial_pass(hist[d], src[0], d, n)) continue;
+
+      local[t].fill(0);
+      for (size_t i = begin; i < end; i++) local[t][digit(src[i], d)]++;
+#pragma omp barrier
+#pragma omp single
+      {
+        size_t sum = 0;
+        for (size_t k = 0; k < kBuckets; k++) {
+          for (int j = 0; j < threads; j++) {
+            size_t c = local[j][k];
+            local[j][k] = sum;
+            sum += c;
+          }
+        }
+      }
+      scatter_combining(src, dst, begin, end, d, local[t].data());
+#pragma omp barrier
+#pragma omp single
+      std::swap(src, dst);
+    }
+
+    for (size_t i = begin; i < end; i++) first[i] = Traits::decode(src[i]);
+  }
+#else
+  (void)num_threads;
+  radix_sort(first, last);
+#endif
+}
+
+template <class Key>
+void parallel_radix_sort(std::vector<Key>& keys, int num_threads = 0) {
+  parallel_radix_sort(keys.data(), keys.data() + keys.size(), num_threads);
+}
+
+}  // namespace ppc::util
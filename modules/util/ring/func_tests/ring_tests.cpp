@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "util/ring/include/ring.hpp"
+
+using ppc::util::MpmcRing;
+
+TEST(ring, keeps_fifo_order_and_reports_full_and_empty) {
+  EXPECT_THROW(MpmcRing<int>(0), std::invalid_argument);
+  MpmcRing<int> ring(5);
+  EXPECT_EQ(ring.capacity(), 8u);
+  int item = 0;
+  EXPECT_FALSE(ring.try_pop(item));
+  // Many laps around the ring, in batches that straddle the wrap point
+  int next_in = 0;
+  int next_out = 0;
+  for (int lap = 0; lap < 50; lap++) {
+    std::vector<int> batch(lap % 7 + 1);
+    for (auto& x : batch) x = next_in++;
+    const size_t pushed = ring.try_push_n(batch.data(), batch.size());
+    next_in -= static_cast<int>(batch.size() - pushed);
+    std::vector<int> out(lap % 5 + 1);
+    const size_t popped = ring.try_pop_n(out.data(), out.size());
+    for (size_t i = 0; i < popped; i++) EXPECT_EQ(out[i], next_out++);
+  }
+  while (ring.try_pop(item)) EXPECT_EQ(item, next_out++);
+  EXPECT_EQ(next_out, next_in);
+
+  for (int i = 0; i < 8; i++) EXPECT_TRUE(ring.try_push(i));
+  item = 42;
+  EXPECT_FALSE(ring.try_push(item));
+  EXPECT_EQ(item, 42);
+  EXPECT_EQ(ring.size_approx(), 8u);
+
+  // A single slot alternates between full and free
+  MpmcRing<int> one(1);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_TRUE(one.try_push(i));
+    EXPECT_FALSE(one.try_push(i));
+    EXPECT_TRUE(one.try_pop(item));
+    EXPECT_EQ(item, i);
+    EXPECT_FALSE(one.try_pop(item));
+  }
+}
+
+TEST(ring, moves_move_only_items) {
+  MpmcRing<std::unique_ptr<int>> ring(2);
+  auto p = std::make_unique<int>(7);
+  EXPECT_TRUE(ring.try_push(p));
+  EXPECT_EQ(p, nullptr);
+  std::unique_ptr<int> q;
+  EXPECT_TRUE(ring.try_pop(q));
+  EXPECT_EQ(*q, 7);
+}
+
+TEST(ring, delivers_every_item_once_across_thread_ratios) {
+  const int per_producer = 20000;
+  for (auto [producers, consumers, capacity] : {std::tuple{1, 1, 64}, {1, 3, 64}, {2, 2, 64}, {3, 1, 64}, {4, 4, 64},
+                                                {2, 2, 1}}) {
+    MpmcRing<int> ring(capacity);
+    const int total = producers * per_producer;
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<int> consumed{0};
+    std::atomic<bool> ordered{true};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+      threads.emplace_back([&, p] {
+        std::vector<int> batch;
+        for (int i = 0; i < per_producer;) {
+          batch.clear();
+          for (int j = i; j < per_producer && j < i + 1 + i % 16; j++) batch.push_back(p * per_producer + j);
+          const auto pushed = ring.try_push_n(batch.data(), batch.size());
+          if (pushed == 0) std::this_thread::yield();
+          i += static_cast<int>(pushed);
+        }
+      });
+    }
+    for (int c = 0; c < consumers; c++) {
+      threads.emplace_back([&, c] {
+        // Items of one producer reach any one consumer in the order they were pushed
+        std::vector<int> last(producers, -1);
+        std::vector<int> batch(c + 1);
+        while (consumed.load() < total) {
+          const auto popped = ring.try_pop_n(batch.data(), batch.size());
+          if (popped == 0) std::this_thread::yield();
+          for (size_t i = 0; i < popped; i++) {
+            const int item = batch[i];
+            if (item <= last[item / per_producer]) ordered = false;
+            last[item / per_producer] = item;
+            seen[item]++;
+          }
+          consumed += static_cast<int>(popped);
+        }
+      });
+    }
+    for (auto& t : threads) t.join();
+    EXPECT_TRUE(ordered.load()) << producers << ':' << consumers << ' ' << capacity;
+    int once = 0;
+    for (const auto& s : seen) once += s.load() == 1 ? 1 : 0;
+    EXPECT_EQ(once, total) << producers << ':' << consumers << ' ' << capacity;
+  }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ppc::util {
+
+// Bounded multi-producer multi-consumer queue without locks (after Vyukov's ring). Every slot carries a sequence
+// number that says whose turn it is: ticket t may write slot t % capacity once its sequence is 2t, and read it
+// once the sequence is 2t + 1; the reader then hands the slot on to ticket t + capacity. (With sequences t and
+// t + 1 instead, as in the original, a ring of one slot could not tell a full slot from one free for the next
+// lap.) Producers and consumers meet only on their own counter and on the slots they claimed, so neither side
+// waits for the other unless the ring is full or empty.
+template <class T>
+class MpmcRing {
+  static_assert(std::is_nothrow_move_assignable_v<T> && std::is_default_constructible_v<T>,
+                "MpmcRing: items are moved in and out of default-constructed slots");
+
+ public:
+  // The capacity is rounded up to a power of two so that slots are found with a mask
+  explicit MpmcRing(size_t capacity) {
+    if (capacity == 0 || capacity > (size_t{1} << 62)) throw std::invalid_argument("MpmcRing: bad capacity");
+    mask_ = std::bit_ceil(capacity) - 1;
+    slots_ = std::make_unique<Slot[]>(mask_ + 1);
+    for (size_t i = 0; i <= mask_; i++) slots_[i].sequence.store(2 * i, std::memory_order_relaxed);
+  }
+
+  size_t capacity() const { return mask_ + 1; }
+
+  // False if the ring is full; the item is left untouched then
+  bool try_push(T& item) { return try_push_n(&item, 1) == 1; }
+  bool try_push(T&& item) { return try_push_n(&item, 1) == 1; }
+
+  // False if the ring is empty
+  bool try_pop(T& item) { return try_pop_n(&item, 1) == 1; }
+
+  // Moves up to n items from items, in order; returns how many went in. A batch claims all its tickets with one
+  // compare-exchange, so the shared counter is touched once per batch rather than once per item.
+  size_t try_push_n(T* items, size_t n) {
+    return transfer(tail_, 0, n, [&](Slot& slot, size_t i) { slot.item = std::move(items[i]); });
+  }
+
+  // Moves up to n items into items, in order; returns how many came out
+  size_t try_pop_n(T* items, size_t n) {
+    return transfer(head_, 1, n, [&](Slot& slot, size_t i) { items[i] = std::move(slot.item); });
+  }
+
+  // Only a snapshot while other threads are pushing or popping
+  size_t size_approx() const {
+    const size_t head = head_.value.load(std::memory_order_relaxed);
+    const size_t tail = tail_.value.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+  }
+
+ private:
+  // Counters and slots on their own cache lines: the producers' counter never shares a line with the consumers'
+  static constexpr size_t kLine = 64;
+
+  struct alignas(kLine) Slot {
+    std::atomic<size_t> sequence;
+    T item{};
+  };
+
+  struct alignas(kLine) Counter {
+    std::atomic<size_t> value{0};
+  };
+
+  // Claims the longest run of up to n consecutive tickets whose slots are ready, i.e. have the sequence
+  // 2 ticket + ready, calls move on each and hands the slot on: to the reader (2 ticket + 1) after a write, to the
+  // writer one lap later (2 (ticket + capacity)) after a read.
+  template <class Move>
+  size_t transfer(Counter& counter, size_t ready, size_t n, Move&& move) {
+    if (n == 0) return 0;
+    size_t ticket = counter.value.load(std::memory_order_relaxed);
+    size_t claimed = 0;
+    while (true) {
+      claimed = 0;
+      auto lag = std::ptrdiff_t{0};
+      while (claimed < n && claimed <= mask_) {
+        const size_t sequence = slots_[(ticket + claimed) & mask_].sequence.load(std::memory_order_acquire);
+        lag = static_cast<std::ptrdiff_t>(sequence - (2 * (ticket + claimed) + ready));
+        if (lag != 0) break;
+        claimed++;
+      }
+      if (claimed > 0) {
+        if (counter.value.compare_exchange_weak(ticket, ticket + claimed, std::memory_order_relaxed)) break;
+      } else if (lag < 0) {
+        return 0;  // full for writers (the slot still holds the item from one lap ago), empty for readers
+      } else {
+        ticket = counter.value.load(std::memory_order_relaxed);  // another thread took this ticket
+      }
+    }
+    const size_t handed = ready == 0 ? 1 : 2 * (mask_ + 1);
+    for (size_t i = 0; i < claimed; i++) {
+      Slot& slot = slots_[(ticket + i) & mask_];
+      move(slot, i);
+      slot.sequence.store(2 * (ticket + i) + handed, std::memory_order_release);
+    }
+    return claimed;
+  }
+
+  Counter tail_;
+  Counter head_;
+  size_t mask_ = 0;
+  std::unique_ptr<Slot[]> slots_;
+};
+
+}  // namespace ppc::util
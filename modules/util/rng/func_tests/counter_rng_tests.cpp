@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "util/rng/include/counter_rng.hpp"
+#include "util/rng/include/hit_or_miss.hpp"
+
+using ppc::util::CounterRng;
+using ppc::util::Philox4x32;
+
+TEST(counter_rng, philox_known_answers) {
+  // Known-answer vectors from the Random123 distribution
+  EXPECT_EQ(Philox4x32::generate({0, 0, 0, 0}, {0, 0}),
+            (Philox4x32::Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+  EXPECT_EQ(Philox4x32::generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+            (Philox4x32::Counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(Philox4x32::generate({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+            (Philox4x32::Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(counter_rng, lanes_match_scalar_blocks) {
+  std::array<std::array<uint32_t, 8>, 4> words;
+  Philox4x32::generate_lanes<8>(0xfffffffcULL, 7, 9, {1, 2}, words);
+  for (uint64_t l = 0; l < 8; l++) {
+    uint64_t c = 0xfffffffcULL + l;
+    auto out = Philox4x32::generate({uint32_t(c), uint32_t(c >> 32), 7, 9}, {1, 2});
+    for (int w = 0; w < 4; w++) EXPECT_EQ(words[w][l], out[w]);
+  }
+}
+
+TEST(counter_rng, bulk_fill_matches_scalar_draws) {
+  CounterRng scalar(123, 4, 5);
+  CounterRng bulk(123, 4, 5);
+  std::vector<double> expected(1001);
+  for (auto& u : expected) u = scalar.uniform();
+  std::vector<double> got(1001);
+  bulk.fill_uniform(got.data(), 1);
+  bulk.fill_uniform(got.data() + 1, 1000);
+  EXPECT_EQ(got, expected);
+  EXPECT_EQ(bulk.position(), scalar.position());
+}
+
+TEST(counter_rng, seek_gives_same_values_for_any_chunking) {
+  const size_t n = 10000;
+  CounterRng whole(2024);
+  std::vector<double> expected(n);
+  whole.fill_uniform(expected.data(), n);
+
+  for (size_t workers : {2, 3, 7}) {
+    std::vector<double> got(n);
+    for (size_t w = 0; w < workers; w++) {
+      size_t begin = n * w / workers;
+      size_t end = n * (w + 1) / workers;
+      CounterRng part(2024);
+      part.seek(begin);
+      part.fill_uniform(got.data() + begin, end - begin);
+    }
+    EXPECT_EQ(got, expected);
+  }
+}
+
+TEST(counter_rng, streams_differ_by_seed_rank_and_thread) {
+  CounterRng base(1, 0, 0);
+  CounterRng other_seed(2, 0, 0);
+  CounterRng other_rank(1, 1, 0);
+  CounterRng other_thread(1, 0, 1);
+  double u = base.uniform();
+  EXPECT_NE(u, other_seed.uniform());
+  EXPECT_NE(u, other_rank.uniform());
+  EXPECT_NE(u, other_thread.uniform());
+}
+
+TEST(counter_rng, uniform_moments) {
+  CounterRng rng(7);
+  std::vector<double> u(200000);
+  rng.fill_uniform(u.data(), u.size(), -1.0, 3.0);
+  double mean = 0.0;
+  double var = 0.0;
+  for (double x : u) {
+    ASSERT_GE(x, -1.0);
+    ASSERT_LT(x, 3.0);
+    mean += x;
+  }
+  mean /= u.size();
+  for (double x : u) var += (x - mean) * (x - mean);
+  var /= u.size();
+  EXPECT_NEAR(mean, 1.0, 0.02);
+  EXPECT_NEAR(var, 16.0 / 12.0, 0.02);
+}
+
+TEST(counter_rng, normal_moments) {
+  CounterRng rng(11, 3);
+  std::vector<double> z(200001);
+  rng.fill_normal(z.data(), z.size(), 2.0, 0.5);
+  double mean = 0.0;
+  double var = 0.0;
+  for (double x : z) {
+    ASSERT_TRUE(std::isfinite(x));
+    mean += x;
+  }
+  mean /= z.size();
+  for (double x : z) var += (x - mean) * (x - mean);
+  var /= z.size();
+  EXPECT_NEAR(mean, 2.0, 0.01);
+  EXPECT_NEAR(var, 0.25, 0.01);
+  EXPECT_EQ(rng.position(), 200002U);
+}
+
+TEST(counter_rng, hit_or_miss_is_independent_of_the_split) {
+  auto parabola = [](double x) { return x * x; };
+  const int64_t n = 100000;
+  int64_t whole = ppc::util::count_hits(parabola, 5, 0, n, 0.0, 1.0, 0.0, 1.0);
+  EXPECT_NEAR(static_cast<double>(whole) / n, 1.0 / 3.0, 0.01);
+
+  for (int64_t workers : {2, 3, 7}) {
+    int64_t sum = 0;
+    for (int64_t w = 0; w < workers; w++) {
+      sum += ppc::util::count_hits(parabola, 5, n * w / workers, n * (w + 1) / workers, 0.0, 1.0, 0.0, 1.0);
+    }
+    EXPECT_EQ(sum, whole);
+  }
+}
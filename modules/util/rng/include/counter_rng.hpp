@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+
+namespace ppc::util {
+
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3"):
+// a keyed bijection of a 128-bit counter, so any block of the stream is computed directly.
+class Philox4x32 {
+ public:
+  using Counter = std::array<uint32_t, 4>;
+  using Key = std::array<uint32_t, 2>;
+
+  static constexpr int kRounds = 10;
+  static constexpr uint32_t kMul0 = 0xD2511F53U;
+  static constexpr uint32_t kMul1 = 0xCD9E8D57U;
+  static constexpr uint32_t kWeyl0 = 0x9E3779B9U;
+  static constexpr uint32_t kWeyl1 = 0xBB67AE85U;
+
+  static Counter generate(Counter ctr, Key key) {
+    for (int r = 0; r < kRounds; r++) {
+      if (r > 0) {
+        key[0] += kWeyl0;
+        key[1] += kWeyl1;
+      }
+      uint64_t p0 = uint64_t(kMul0) * ctr[0];
+      uint64_t p1 = uint64_t(kMul1) * ctr[2];
+      ctr = {uint32_t(p1 >> 32) ^ ctr[1] ^ key[0], uint32_t(p1), uint32_t(p0 >> 32) ^ ctr[3] ^ key[1], uint32_t(p0)};
+    }
+    return ctr;
+  }
+
+  // Same as generate() for lanes consecutive counters {first + i, hi, c2, c3}, written
+  // lane-major so the compiler can keep one counter word of all lanes in a vector register.
+  template <size_t Lanes>
+  static void generate_lanes(uint64_t first, uint32_t c2, uint32_t c3, Key key,
+                             std::array<std::array<uint32_t, Lanes>, 4>& out) {
+    auto& x0 = out[0];
+    auto& x1 = out[1];
+    auto& x2 = out[2];
+    auto& x3 = out[3];
+    for (size_t i = 0; i < Lanes; i++) {
+      x0[i] = uint32_t(first + i);
+      x1[i] = uint32_t((first + i) >> 32);
+      x2[i] = c2;
+      x3[i] = c3;
+    }
+    for (int r = 0; r < kRounds; r++) {
+      if (r > 0) {
+        key[0] += kWeyl0;
+        key[1] += kWeyl1;
+      }
+      for (size_t i = 0; i < Lanes; i++) {
+        uint64_t p0 = uint64_t(kMul0) * x0[i];
+        uint64_t p1 = uint64_t(kMul1) * x2[i];
+        uint32_t y0 = uint32_t(p1 >> 32) ^ x1[i] ^ key[0];
+        uint32_t y2 = uint32_t(p0 >> 32) ^ x3[i] ^ key[1];
+        x1[i] = uint32_t(p1);
+        x3[i] = uint32_t(p0);
+        x0[i] = y0;
+        x2[i] = y2;
+      }
+    }
+  }
+};
+
+// Stream of doubles keyed by (seed, rank, thread). Every Philox block yields two doubles,
+// and position() counts doubles, so seek() gives O(1) skip-ahead anywhere in the stream.
+//
+// Results do not depend on the worker count when the work is indexed by sample rather than
+// by worker: give every worker the same (seed) stream and seek() to its first sample.
+// Distinct (rank, thread) pairs are for independent, non-overlapping streams.
+class CounterRng {
+ public:
+  explicit CounterRng(uint64_t seed, uint32_t rank = 0, uint32_t thread = 0)
+      : key_{uint32_t(seed), uint32_t(seed >> 32)}, rank_(rank), thread_(thread) {}
+
+  void seek(uint64_t position) { position_ = position; }
+  uint64_t position() const { return position_; }
+
+  // Uniform on [0, 1) with 53 random bits
+  double uniform() {
+    uint64_t block = position_ / 2;
+    if (block != cached_block_) {
+      auto out = Philox4x32::generate({uint32_t(block), uint32_t(block >> 32), rank_, thread_}, key_);
+      cached_[0] = to_unit((uint64_t(out[1]) << 32) | out[0]);
+      cached_[1] = to_unit((uint64_t(out[3]) << 32) | out[2]);
+      cached_block_ = block;
+    }
+    return cached_[position_++ % 2];
+  }
+
+  double uniform(double lo, double hi) { return lo + (hi - lo) * uniform(); }
+
+  // Consumes two uniforms and returns one Box-Muller deviate
+  double normal(double mean = 0.0, double stddev = 1.0) {
+    double u1 = uniform();
+    double u2 = uniform();
+    return mean + stddev * box_muller_radius(u1) * std::cos(2.0 * std::numbers::pi * u2);
+  }
+
+  void fill_uniform(double* out, size_t n) {
+    size_t i = 0;
+    while (i < n && position_ % 2 != 0) out[i++] = uniform();
+
+    constexpr size_t kLanes = 8;
+    std::array<std::array<uint32_t, kLanes>, 4> words;
+    while (n - i >= 2 * kLanes) {
+      Philox4x32::generate_lanes<kLanes>(position_ / 2, rank_, thread_, key_, words);
+      for (size_t l = 0; l < kLanes; l++) {
+        out[i + 2 * l] = to_unit((uint64_t(words[1][l]) << 32) | words[0][l]);
+        out[i + 2 * l + 1] = to_unit((uint64_t(words[3][l]) << 32) | words[2][l]);
+      }
+      i += 2 * kLanes;
+      position_ += 2 * kLanes;
+    }
+
+    while (i < n) out[i++] = uniform();
+  }
+
+  void fill_uniform(double* out, size_t n, double lo, double hi) {
+    fill_uniform(out, n);
+    for (size_t i = 0; i < n; i++) out[i] = lo + (hi - lo) * out[i];
+  }
+
+  // Box-Muller on consecutive uniform pairs; an odd n still consumes a whole pair at the end
+  void fill_normal(double* out, size_t n, double mean = 0.0, double stddev = 1.0) {
+    fill_uniform(out, n);
+    for (size_t i = 0; i + 1 < n; i += 2) {
+      double r = box_muller_radius(out[i]);
+      double t = 2.0 * std::numbers::pi * out[i + 1];
+      out[i] = mean + stddev * r * std::cos(t);
+      out[i + 1] = mean + stddev * r * std::sin(t);
+    }
+    if (n % 2 != 0) {
+      double u1 = out[n - 1];
+      out[n - 1] = mean + stddev * box_muller_radius(u1) * std::cos(2.0 * std::numbers::pi * uniform());
+    }
+  }
+
+ private:
+  static double to_unit(uint64_t bits) { return double(bits >> 11) * 0x1.0p-53; }
+  // u is in [0, 1); 1 - u keeps the logarithm finite
+  static double box_muller_radius(double u) { return std::sqrt(-2.0 * std::log(1.0 - u)); }
+
+  Philox4x32::Key key_;
+  uint32_t rank_;
+  uint32_t thread_;
+  uint64_t position_ = 0;
+  uint64_t cached_block_ = UINT64_MAX;
+  std::array<double, 2> cached_{};
+};
+
+}  // namespace ppc::util
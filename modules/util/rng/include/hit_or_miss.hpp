@@ -0,0 +1,36 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include "util/rng/include/counter_rng.hpp"
+
+namespace ppc::util {
+
+// Hit-or-miss Monte Carlo: counts the samples with index in [begin, end) whose point, uniform in
+// [xmin, xmax) x [ymin, ymax), lies under f. Sample i is drawn from uniforms 2i and 2i + 1 of the
+// seed's stream, so the total does not depend on how the index range is split between workers.
+template <class F>
+int64_t count_hits(const F& f, uint64_t seed, int64_t begin, int64_t end, double xmin, double xmax, double ymin,
+                   double ymax) {
+  constexpr int64_t batch = 512;
+  std::array<double, 2 * batch> u;
+  CounterRng rng(seed);
+  rng.seek(2 * static_cast<uint64_t>(begin));
+  int64_t hits = 0;
+  for (int64_t first = begin; first < end; first += batch) {
+    int64_t count = std::min(batch, end - first);
+    rng.fill_uniform(u.data(), 2 * count);
+    for (int64_t i = 0; i < count; i++) {
+      double x = ((xmax - xmin) * u[2 * i]) + xmin;
+      double y = ((ymax - ymin) * u[2 * i + 1]) + ymin;
+      if (f(x) > y) {
+        ++hits;
+      }
+    }
+  }
+  return hits;
+}
+
+}  // namespace ppc::util
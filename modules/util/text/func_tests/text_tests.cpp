@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "util/text/include/text.hpp"
+
+using ppc::util::ByteClass;
+
+namespace {
+
+// Every byte value, and lengths around the 16-, 32- and 64-byte steps of the kernels
+std::string random_text(size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::string text(n, ' ');
+  for (auto& c : text) c = static_cast<char>(byte(gen));
+  return text;
+}
+
+size_t reference_runs(const std::string& text, const ByteClass& cls, bool before_in_class) {
+  size_t runs = 0;
+  bool prev = before_in_class;
+  for (char c : text) {
+    bool in = cls.contains(c);
+    runs += (in && !prev) ? 1 : 0;
+    prev = in;
+  }
+  return runs;
+}
+
+}  // namespace
+
+TEST(text, classes_match_the_c_library) {
+  const auto alpha = ByteClass::ascii_alpha();
+  const auto space = ByteClass::whitespace();
+  const auto digit = ByteClass::ascii_digit();
+  for (int b = 0; b < 256; b++) {
+    const auto c = static_cast<char>(b);
+    EXPECT_EQ(alpha.contains(c), std::isalpha(b) != 0) << b;
+    EXPECT_EQ(space.contains(c), std::isspace(b) != 0) << b;
+    EXPECT_EQ(digit.contains(c), std::isdigit(b) != 0) << b;
+    EXPECT_EQ((~alpha).contains(c), std::isalpha(b) == 0) << b;
+  }
+  EXPECT_THROW((void)(~alpha | space), std::invalid_argument);
+  EXPECT_THROW((void)ByteClass::of("abcdefghi"), std::invalid_argument);
+}
+
+TEST(text, count_class_matches_a_byte_loop) {
+  const ByteClass classes[] = {ByteClass::ascii_alpha(), ByteClass::sentence_end(), ~ByteClass::of(" "),
+                               ByteClass::of("\x80\xff") | ByteClass::range('\x90', '\xa0')};
+  for (size_t n : {0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1000}) {
+    auto text = random_text(n, static_cast<unsigned>(n));
+    for (const auto& cls : classes) {
+      size_t expected = 0;
+      for (char c : text) expected += cls.contains(c) ? 1 : 0;
+      EXPECT_EQ(ppc::util::count_class(text.data(), n, cls), expected) << n;
+    }
+  }
+}
+
+TEST(text, count_runs_counts_words_across_blocks) {
+  const auto word = ByteClass::ascii_alpha();
+  EXPECT_EQ(ppc::util::count_runs("", 0, word), 0u);
+  const std::string line = "  Hello, world!  It's 2024 ";
+  EXPECT_EQ(ppc::util::count_runs(line.data(), line.size(), word), 4u);
+  EXPECT_EQ(ppc::util::count_runs(line.data() + 3, line.size() - 3, word, true), 3u);
+
+  // Runs crossing the 64-byte blocks, and a run continued from before the text
+  std::string text;
+  for (int i = 0; i < 100; i++) text += std::string(i % 7 + 1, 'x') + std::string(i % 3 + 1, ' ');
+  for (bool before : {false, true}) {
+    EXPECT_EQ(ppc::util::count_runs(text.data(), text.size(), word, before), reference_runs(text, word, before));
+  }
+  auto noise = random_text(777, 3);
+  EXPECT_EQ(ppc::util::count_runs(noise.data(), noise.size(), ~ByteClass::whitespace()),
+            reference_runs(noise, ~ByteClass::whitespace(), false));
+}
+
+TEST(text, count_preceded_skips_whitespace_runs_of_any_length) {
+  const auto end = ByteClass::sentence_end();
+  const auto space = ByteClass::whitespace();
+  const auto content = ~(end | space);
+  std::mt19937 gen(5);
+  const std::string alphabet = "ab .!?\n\t";
+  std::uniform_int_distribution<size_t> letter(0, alphabet.size() - 1);
+  for (size_t n : {0, 1, 2, 63, 64, 65, 200, 1000}) {
+    for (int spaces : {0, 1, 100}) {
+      // Long whitespace runs carry the reach across whole blocks
+      std::string text;
+      while (text.size() < n) {
+        text += (letter(gen) % 4 == 0) ? std::string(spaces, ' ') : alphabet.substr(letter(gen), 1);
+      }
+      text.resize(n);
+      for (bool before : {false, true}) {
+        // Sentence ends that close a sentence, by the usual state machine
+        size_t expected = 0;
+        bool inside = before;
+        for (char c : text) {
+          if (end.contains(c)) {
+            expected += inside ? 1 : 0;
+            inside = false;
+          } else if (!space.contains(c)) {
+            inside = true;
+          }
+        }
+        EXPECT_EQ(ppc::util::count_preceded(text.data(), n, end, content, space, before), expected)
+            << n << ' ' << spaces;
+      }
+    }
+  }
+}
+
+TEST(text, tallies_join_chunks_cut_at_any_byte) {
+  const auto end = ByteClass::sentence_end();
+  const auto space = ByteClass::whitespace();
+  const auto word = ~space;
+  std::mt19937 gen(11);
+  const std::string alphabet = "ab .!?  \n";
+  std::uniform_int_distribution<size_t> letter(0, alphabet.size() - 1);
+  std::string text(300, ' ');
+  for (auto& c : text) c = alphabet[letter(gen)];
+  text.replace(100, 80, std::string(80, ' '));
+
+  for (bool before : {false, true}) {
+    const size_t runs = ppc::util::count_runs(text.data(), text.size(), word, before);
+    const size_t ends = ppc::util::count_preceded(text.data(), text.size(), end, ~(end | space), space, before);
+    // Cut points at random, including empty chunks and chunks of whitespace only
+    for (int trial = 0; trial < 200; trial++) {
+      std::uniform_int_distribution<size_t> cut(0, text.size());
+      std::vector<size_t> cuts{0, text.size(), cut(gen), cut(gen), cut(gen), cut(gen), cut(gen)};
+      std::sort(cuts.begin(), cuts.end());
+      ppc::util::RunTally run_tally;
+      ppc::util::PrecededTally end_tally;
+      for (size_t i = 0; i + 1 < cuts.size(); i++) {
+        const char* chunk = text.data() + cuts[i];
+        const size_t n = cuts[i + 1] - cuts[i];
+        run_tally = run_tally + ppc::util::tally_runs(chunk, n, word);
+        end_tally = end_tally + ppc::util::tally_preceded(chunk, n, end, ~(end | space), space);
+      }
+      EXPECT_EQ(run_tally.count(before), runs);
+      EXPECT_EQ(end_tally.count(before), ends);
+    }
+  }
+  // Associativity: pairs joined in either grouping give the same tally
+  const auto a = ppc::util::tally_preceded("x  ", 3, end, ~(end | space), space);
+  const auto b = ppc::util::tally_preceded("   ", 3, end, ~(end | space), space);
+  const auto c = ppc::util::tally_preceded(" .a", 3, end, ~(end | space), space);
+  EXPECT_EQ(((a + b) + c).count(), 1u);
+  EXPECT_EQ((a + (b + c)).count(), 1u);
+}
+
+TEST(text, first_mismatch_finds_the_earliest_difference) {
+  EXPECT_EQ(ppc::util::first_mismatch("", "", 0), 0u);
+  EXPECT_EQ(ppc::util::first_mismatch("abc", "abd", 3), 2u);
+  EXPECT_EQ(ppc::util::first_mismatch("abc", "abd", 2), 2u);
+  for (size_t n : {1, 63, 64, 65, 127, 128, 200}) {
+    const auto a = random_text(n, static_cast<unsigned>(n) + 40);
+    EXPECT_EQ(ppc::util::first_mismatch(a.data(), a.data(), n), n);
+    // A difference at every offset, with a later one that must not be reported
+    for (size_t at = 0; at < n; at++) {
+      auto b = a;
+      b[at] = static_cast<char>(b[at] ^ 0x80);
+      b[n - 1] = static_cast<char>(b[n - 1] ^ 1);
+      EXPECT_EQ(ppc::util::first_mismatch(a.data(), b.data(), n), at) << n;
+    }
+  }
+}
+
+TEST(text, hamming_distance_counts_bytes_and_bits) {
+  for (size_t n : {0, 1, 63, 64, 65, 1000}) {
+    const auto a = random_text(n, static_cast<unsigned>(n) + 60);
+    auto b = random_text(n, static_cast<unsigned>(n) + 61);
+    // About half the bytes shared, so that both outcomes occur in every block
+    for (size_t i = 0; i < n; i += 2) b[i] = a[i];
+    size_t bytes = 0;
+    size_t bits = 0;
+    for (size_t i = 0; i < n; i++) {
+      bytes += a[i] != b[i] ? 1 : 0;
+      bits += std::popcount(static_cast<unsigned>(static_cast<uint8_t>(a[i] ^ b[i])));
+    }
+    EXPECT_EQ(ppc::util::count_mismatches(a.data(), b.data(), n), bytes) << n;
+    EXPECT_EQ(ppc::util::hamming_distance(a.data(), n, b.data(), n), bytes) << n;
+    const auto* pa = reinterpret_cast<const uint8_t*>(a.data());
+    const auto* pb = reinterpret_cast<const uint8_t*>(b.data());
+    EXPECT_EQ(ppc::util::count_bit_mismatches(pa, pb, 8 * n), bits) << n;
+    if (n > 0) {
+      // A bit count that ends inside a byte sees only that byte's low bits
+      const auto last = static_cast<unsigned>(static_cast<uint8_t>(a[n - 1] ^ b[n - 1]));
+      EXPECT_EQ(ppc::util::count_bit_mismatches(pa, pb, 8 * n - 5), bits - std::popcount(last >> 3)) << n;
+    }
+  }
+  // Positions past the shorter string all count
+  EXPECT_EQ(ppc::util::hamming_distance("karolin", 7, "kathrin", 7), 3u);
+  EXPECT_EQ(ppc::util::hamming_distance("abc", 3, "abxdef", 6), 4u);
+  EXPECT_EQ(ppc::util::hamming_distance("abxdef", 6, "", 0), 6u);
+}
+
+TEST(text, histogram_answers_any_query) {
+  for (size_t n : {0, 1, 7, 8, 9, 63, 64, 1000}) {
+    auto text = random_text(n, static_cast<unsigned>(n) + 20);
+    const ppc::util::ByteHistogram histogram(text.data(), n);
+    uint64_t total = 0;
+    for (int b = 0; b < 256; b++) {
+      const auto c = static_cast<char>(b);
+      EXPECT_EQ(histogram.count(c), static_cast<uint64_t>(std::count(text.begin(), text.end(), c))) << n;
+      total += histogram.count(c);
+    }
+    EXPECT_EQ(total, n);
+    const auto alpha = ByteClass::ascii_alpha();
+    EXPECT_EQ(histogram.count(alpha), ppc::util::count_class(text.data(), n, alpha));
+    EXPECT_EQ(histogram.count(~alpha), n - histogram.count(alpha));
+  }
+  // Runs of one byte, and parts that add up to the whole
+  const std::string same(1001, 'z');
+  ppc::util::ByteHistogram parts(same.data(), 500);
+  parts += ppc::util::ByteHistogram(same.data() + 500, 501);
+  EXPECT_EQ(parts.count('z'), 1001u);
+  const ppc::util::ByteHistogram whole(same.data(), same.size());
+  EXPECT_TRUE(std::equal(parts.data(), parts.data() + 256, whole.data()));
+}
@@ -0,0 +1,506 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PPC_TEXT_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace ppc::util {
+
+// A set of byte values described the way SIMD code tests it: up to kMaxChars single bytes and kMaxRanges
+// inclusive ranges, optionally complemented. Every byte is then classified with a few compares, without a
+// table lookup, 16 or 32 bytes per instruction.
+class ByteClass {
+ public:
+  static constexpr int kMaxChars = 8;
+  static constexpr int kMaxRanges = 4;
+
+  static ByteClass of(std::string_view chars) {
+    ByteClass c;
+    for (char ch : chars) c.add_char(static_cast<uint8_t>(ch));
+    return c;
+  }
+  static ByteClass range(char lo, char hi) {
+    ByteClass c;
+    c.add_range(static_cast<uint8_t>(lo), static_cast<uint8_t>(hi));
+    return c;
+  }
+
+  // Letters of the "C" locale, the set std::isalpha tests unless a program switches locales
+  static ByteClass ascii_alpha() { return range('a', 'z') | range('A', 'Z'); }
+  static ByteClass ascii_digit() { return range('0', '9'); }
+  // The set of std::isspace in the "C" locale
+  static ByteClass whitespace() { return of(" ") | range('\t', '\r'); }
+  static ByteClass sentence_end() { return of(".!?"); }
+
+  ByteClass operator|(const ByteClass& other) const {
+    if (inverted_ || other.inverted_) throw std::invalid_argument("ByteClass: union of a complemented class");
+    ByteClass c = *this;
+    for (int i = 0; i < other.num_chars_; i++) c.add_char(other.chars_[i]);
+    for (int i = 0; i < other.num_ranges_; i++) c.add_range(other.lo_[i], other.hi_[i]);
+    return c;
+  }
+  ByteClass operator~() const {
+    ByteClass c = *this;
+    c.inverted_ = !inverted_;
+    return c;
+  }
+
+  bool contains(char ch) const {
+    const auto b = static_cast<uint8_t>(ch);
+    bool in = false;
+    for (int i = 0; i < num_chars_; i++) in = in || b == chars_[i];
+    for (int i = 0; i < num_ranges_; i++) in = in || (b >= lo_[i] && b <= hi_[i]);
+    return in != inverted_;
+  }
+
+  int num_chars() const { return num_chars_; }
+  int num_ranges() const { return num_ranges_; }
+  uint8_t char_at(int i) const { return chars_[i]; }
+  uint8_t range_lo(int i) const { return lo_[i]; }
+  uint8_t range_hi(int i) const { return hi_[i]; }
+  bool inverted() const { return inverted_; }
+
+ private:
+  void add_char(uint8_t b) {
+    if (num_chars_ == kMaxChars) throw std::invalid_argument("ByteClass: too many single bytes");
+    chars_[num_chars_++] = b;
+  }
+  void add_range(uint8_t lo, uint8_t hi) {
+    if (lo > hi) throw std::invalid_argument("ByteClass: empty range");
+    if (num_ranges_ == kMaxRanges) throw std::invalid_argument("ByteClass: too many ranges");
+    lo_[num_ranges_] = lo;
+    hi_[num_ranges_++] = hi;
+  }
+
+  std::array<uint8_t, kMaxChars> chars_{};
+  std::array<uint8_t, kMaxRanges> lo_{};
+  std::array<uint8_t, kMaxRanges> hi_{};
+  int num_chars_ = 0;
+  int num_ranges_ = 0;
+  bool inverted_ = false;
+};
+
+namespace text_detail {
+
+// Bytes classified per step: one bit each in a 64-bit mask
+constexpr size_t kBlock = 64;
+
+// The class with its bytes broadcast to vector registers once per scan rather than once per block
+class Classifier {
+ public:
+  explicit Classifier(const ByteClass& cls) : cls_(cls) {
+    for (int i = 0; i < cls.num_chars(); i++) chars_[i] = splat(cls.char_at(i));
+    for (int i = 0; i < cls.num_ranges(); i++) {
+      lo_[i] = splat(cls.range_lo(i));
+      span_[i] = splat(static_cast<uint8_t>(cls.range_hi(i) - cls.range_lo(i)));
+    }
+  }
+
+  // Bit i set when p[i] is in the class, for the 64 bytes at p
+  uint64_t classify(const uint8_t* p) const {
+    uint64_t mask = 0;
+    for (size_t offset = 0; offset < kBlock; offset += kWidth) mask |= bits(p + offset) << offset;
+    return cls_.inverted() ? ~mask : mask;
+  }
+
+ private:
+#if defined(__AVX2__)
+  using Vec = __m256i;
+  static constexpr size_t kWidth = 32;
+  static Vec splat(uint8_t b) { return _mm256_set1_epi8(static_cast<char>(b)); }
+  uint64_t bits(const uint8_t* p) const {
+    const Vec x = _mm256_loadu_si256(reinterpret_cast<const Vec*>(p));
+    Vec in = _mm256_setzero_si256();
+    for (int i = 0; i < cls_.num_chars(); i++) in = _mm256_or_si256(in, _mm256_cmpeq_epi8(x, chars_[i]));
+    // lo <= x <= hi as the unsigned (x - lo) <= (hi - lo), tested as min(x - lo, hi - lo) == x - lo
+    for (int i = 0; i < cls_.num_ranges(); i++) {
+      const Vec d = _mm256_sub_epi8(x, lo_[i]);
+      in = _mm256_or_si256(in, _mm256_cmpeq_epi8(_mm256_min_epu8(d, span_[i]), d));
+    }
+    return static_cast<uint32_t>(_mm256_movemask_epi8(in));
+  }
+#elif defined(PPC_TEXT_SSE2)
+  using Vec = __m128i;
+  static constexpr size_t kWidth = 16;
+  static Vec splat(uint8_t b) { return _mm_set1_epi8(static_cast<char>(b)); }
+  uint64_t bits(const uint8_t* p) const {
+    const Vec x = _mm_loadu_si128(reinterpret_cast<const Vec*>(p));
+    Vec in = _mm_setzero_si128();
+    for (int i = 0; i < cls_.num_chars(); i++) in = _mm_or_si128(in, _mm_cmpeq_epi8(x, chars_[i]));
+    for (int i = 0; i < cls_.num_ranges(); i++) {
+      const Vec d = _mm_sub_epi8(x, lo_[i]);
+      in = _mm_or_si128(in, _mm_cmpeq_epi8(_mm_min_epu8(d, span_[i]), d));
+    }
+    return static_cast<uint32_t>(_mm_movemask_epi8(in));
+  }
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+  using Vec = uint8x16_t;
+  static constexpr size_t kWidth = 16;
+  static Vec splat(uint8_t b) { return vdupq_n_u8(b); }
+  uint64_t bits(const uint8_t* p) const {
+    const Vec x = vld1q_u8(p);
+    Vec in = vdupq_n_u8(0);
+    for (int i = 0; i < cls_.num_chars(); i++) in = vorrq_u8(in, vceqq_u8(x, chars_[i]));
+    for (int i = 0; i < cls_.num_ranges(); i++) in = vorrq_u8(in, vcleq_u8(vsubq_u8(x, lo_[i]), span_[i]));
+    // No movemask on NEON: narrow each 0x00/0xff byte to a nibble, then keep one bit per nibble
+    const uint64_t nibbles = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(in), 4)), 0);
+    uint64_t mask = 0;
+    for (int i = 0; i < 16; i++) mask |= ((nibbles >> (4 * i)) & 1) << i;
+    return mask;
+  }
+#else
+  using Vec = uint8_t;
+  static constexpr size_t kWidth = kBlock;
+  static Vec splat(uint8_t b) { return b; }
+  uint64_t bits(const uint8_t* p) const {
+    uint64_t mask = 0;
+    for (size_t i = 0; i < kBlock; i++) {
+      bool in = false;
+      for (int c = 0; c < cls_.num_chars(); c++) in = in || p[i] == chars_[c];
+      for (int r = 0; r < cls_.num_ranges(); r++) in = in || static_cast<uint8_t>(p[i] - lo_[r]) <= span_[r];
+      mask |= static_cast<uint64_t>(in) << i;
+    }
+    return mask;
+  }
+#endif
+
+  ByteClass cls_;
+  Vec chars_[ByteClass::kMaxChars]{};
+  Vec lo_[ByteClass::kMaxRanges]{};
+  Vec span_[ByteClass::kMaxRanges]{};
+};
+
+// Calls f(bits, masks...) for consecutive blocks of the n bytes at text, with one mask per class whose bit i
+// is set when byte i of the block is in the class. bits = 64 except for the last, shorter block, whose masks are
+// cleared above its bits.
+template <class F, class... Classes>
+void for_each_mask(const char* text, size_t n, F&& f, const Classes&... classes) {
+  const std::tuple classifiers{Classifier(classes)...};
+  const auto* p = reinterpret_cast<const uint8_t*>(text);
+  size_t i = 0;
+  for (; i + kBlock <= n; i += kBlock) {
+    std::apply([&](const auto&... c) { f(kBlock, c.classify(p + i)...); }, classifiers);
+  }
+  if (i < n) {
+    uint8_t tail[kBlock] = {};
+    std::memcpy(tail, p + i, n - i);
+    const uint64_t valid = (uint64_t(1) << (n - i)) - 1;
+    std::apply([&](const auto&... c) { f(n - i, c.classify(tail) & valid...); }, classifiers);
+  }
+}
+
+// Bit i set when a[i] != b[i], for the 64 bytes at a and b
+inline uint64_t differ_mask(const uint8_t* a, const uint8_t* b) {
+  uint64_t equal = 0;
+#if defined(__AVX2__)
+  for (size_t offset = 0; offset < kBlock; offset += 32) {
+    const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + offset));
+    const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + offset));
+    equal |= uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)))) << offset;
+  }
+#elif defined(PPC_TEXT_SSE2)
+  for (size_t offset = 0; offset < kBlock; offset += 16) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + offset));
+    const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + offset));
+    equal |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)))) << offset;
+  }
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+  for (size_t offset = 0; offset < kBlock; offset += 16) {
+    const uint8x16_t same = vceqq_u8(vld1q_u8(a + offset), vld1q_u8(b + offset));
+    const uint64_t nibbles = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(same), 4)), 0);
+    for (int i = 0; i < 16; i++) equal |= ((nibbles >> (4 * i)) & 1) << (offset + i);
+  }
+#else
+  for (size_t i = 0; i < kBlock; i++) equal |= uint64_t(a[i] == b[i]) << i;
+#endif
+  return ~equal;
+}
+
+}  // namespace text_detail
+
+// Offset of the first byte at which the n bytes at a and b differ, or n if there is none: the search behind
+// memcmp, 64 bytes per step, returning the position rather than only the sign. It stops at the first block
+// with a difference, so strings that differ early are decided without reading the rest.
+inline size_t first_mismatch(const char* a, const char* b, size_t n) {
+  const auto* p = reinterpret_cast<const uint8_t*>(a);
+  const auto* q = reinterpret_cast<const uint8_t*>(b);
+  size_t i = 0;
+  for (; i + text_detail::kBlock <= n; i += text_detail::kBlock) {
+    const uint64_t differ = text_detail::differ_mask(p + i, q + i);
+    if (differ != 0) return i + std::countr_zero(differ);
+  }
+  if (i < n) {
+    uint8_t tail_a[text_detail::kBlock] = {};
+    uint8_t tail_b[text_detail::kBlock] = {};
+    std::memcpy(tail_a, p + i, n - i);
+    std::memcpy(tail_b, q + i, n - i);
+    const uint64_t differ = text_detail::differ_mask(tail_a, tail_b);
+    if (differ != 0) return i + std::countr_zero(differ);
+  }
+  return n;
+}
+
+// Number of positions at which the n bytes at a and b differ, 64 bytes per step as a popcount of the mask of
+// differing bytes
+inline size_t count_mismatches(const char* a, const char* b, size_t n) {
+  const auto* p = reinterpret_cast<const uint8_t*>(a);
+  const auto* q = reinterpret_cast<const uint8_t*>(b);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + text_detail::kBlock <= n; i += text_detail::kBlock) {
+    count += std::popcount(text_detail::differ_mask(p + i, q + i));
+  }
+  if (i < n) {
+    uint8_t tail_a[text_detail::kBlock] = {};
+    uint8_t tail_b[text_detail::kBlock] = {};
+    std::memcpy(tail_a, p + i, n - i);
+    std::memcpy(tail_b, q + i, n - i);
+    count += std::popcount(text_detail::differ_mask(tail_a, tail_b));
+  }
+  return count;
+}
+
+// Hamming distance of byte strings of any lengths: the positions of the shorter length that differ, and every
+// position past it
+inline size_t hamming_distance(const char* a, size_t a_size, const char* b, size_t b_size) {
+  const size_t common = a_size < b_size ? a_size : b_size;
+  return count_mismatches(a, b, common) + (a_size + b_size - 2 * common);
+}
+
+// Number of differing bits among the first n bits of two bit-packed buffers, bit i being bit i % 8 of byte
+// i / 8: a popcount of the exclusive or, 64 bits per step
+inline size_t count_bit_mismatches(const uint8_t* a, const uint8_t* b, size_t n) {
+  size_t count = 0;
+  size_t byte = 0;
+  for (; (byte + 8) * 8 <= n; byte += 8) {
+    uint64_t x;
+    uint64_t y;
+    std::memcpy(&x, a + byte, 8);
+    std::memcpy(&y, b + byte, 8);
+    count += std::popcount(x ^ y);
+  }
+  for (; byte * 8 < n; byte++) {
+    const size_t bits = n - byte * 8 < 8 ? n - byte * 8 : 8;
+    count += std::popcount(static_cast<unsigned>((a[byte] ^ b[byte]) & ((1u << bits) - 1)));
+  }
+  return count;
+}
+
+// Number of bytes of text in the class
+inline size_t count_class(const char* text, size_t n, const ByteClass& cls) {
+  size_t count = 0;
+  text_detail::for_each_mask(
+      text, n, [&](size_t, uint64_t mask) { count += std::popcount(mask); }, cls);
+  return count;
+}
+
+// What a chunk of text contributes to a count of runs, enough to join chunks cut at any byte: the runs that
+// start in it, counted as if the byte before it were outside the class, and whether its first and last bytes are
+// in the class. Tallies of consecutive chunks combine with +, which is associative but not commutative, so
+// chunks spread over processes reduce in rank order to the tally of the whole text. The default value, an empty
+// chunk, is the identity.
+struct RunTally {
+  uint64_t runs = 0;
+  bool first_in = false;
+  bool last_in = false;
+  bool empty = true;
+
+  // Runs in the text, given whether the byte just before it belongs to the class
+  uint64_t count(bool before_in_class = false) const { return runs - ((before_in_class && first_in) ? 1 : 0); }
+
+  // A run that ends one chunk and opens the next was counted in both
+  friend RunTally operator+(const RunTally& a, const RunTally& b) {
+    if (a.empty) return b;
+    if (b.empty) return a;
+    return {a.runs + b.runs - ((a.last_in && b.first_in) ? 1 : 0), a.first_in, b.last_in, false};
+  }
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int /*version*/) {
+    ar & runs;
+    ar & first_in;
+    ar & last_in;
+    ar & empty;
+  }
+};
+
+// A run starts where a byte is in the class and its predecessor is not: mask & ~(mask << 1), carrying the top
+// bit over from the previous block.
+inline RunTally tally_runs(const char* text, size_t n, const ByteClass& cls) {
+  if (n == 0) return {};
+  RunTally tally{0, cls.contains(text[0]), cls.contains(text[n - 1]), false};
+  uint64_t carry = 0;
+  text_detail::for_each_mask(
+      text, n,
+      [&](size_t bits, uint64_t mask) {
+        tally.runs += std::popcount(mask & ~((mask << 1) | carry));
+        carry = (mask >> (bits - 1)) & 1;
+      },
+      cls);
+  return tally;
+}
+
+// Number of maximal runs of class bytes that start in text, such as words when the class is the word
+// characters; before_in_class tells whether the byte just before text belongs to the class.
+inline size_t count_runs(const char* text, size_t n, const ByteClass& cls, bool before_in_class = false) {
+  return tally_runs(text, n, cls).count(before_in_class);
+}
+
+// What a chunk contributes to count_preceded, in the manner of RunTally: the targets preceded by a prev byte
+// within the chunk, and the first and last bytes that are not skipped, which decide the targets across the cut.
+// A chunk of skipped bytes only passes the state through.
+struct PrecededTally {
+  uint64_t count_within = 0;
+  bool opens_with_target = false;  // the first byte not skipped is a target
+  bool ends_in_prev = false;       // the last byte not skipped is in prev
+  bool all_skipped = true;
+
+  // Targets in the text, given whether it continues a prev byte, possibly followed by skipped ones
+  uint64_t count(bool before_in_prev = false) const {
+    return count_within + ((before_in_prev && opens_with_target) ? 1 : 0);
+  }
+
+  friend PrecededTally operator+(const PrecededTally& a, const PrecededTally& b) {
+    if (a.all_skipped) return {a.count_within + b.count_within, b.opens_with_target, b.ends_in_prev, b.all_skipped};
+    if (b.all_skipped) return {a.count_within + b.count_within, a.opens_with_target, a.ends_in_prev, false};
+    return {a.count_within + b.count(a.ends_in_prev), a.opens_with_target, b.ends_in_prev, false};
+  }
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int /*version*/) {
+    ar & count_within;
+    ar & opens_with_target;
+    ar & ends_in_prev;
+    ar & all_skipped;
+  }
+};
+
+// A bit of reach marks a byte whose closest preceding non-skipped byte is in prev. The byte right after a prev
+// byte is reached; when that byte is skipped, adding the mask of skipped bytes carries the bit through the whole
+// run of them to the byte that ends it. Prev and skip must be disjoint.
+inline PrecededTally tally_preceded(const char* text, size_t n, const ByteClass& target, const ByteClass& prev,
+                                    const ByteClass& skip) {
+  PrecededTally tally;
+  uint64_t carry = 0;
+  text_detail::for_each_mask(
+      text, n,
+      [&](size_t bits, uint64_t t, uint64_t p, uint64_t s) {
+        const uint64_t next = (p << 1) | carry;
+        const uint64_t through = (next & s) + s;
+        const uint64_t reach = (through & ~s) | (next & ~s);
+        tally.count_within += std::popcount(reach & t);
+        carry = (p >> 63) | (through < s ? 1 : 0);
+
+        const uint64_t valid = bits == text_detail::kBlock ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+        const uint64_t kept = ~s & valid;
+        if (kept == 0) return;
+        if (tally.all_skipped) {
+          tally.opens_with_target = ((t >> std::countr_zero(kept)) & 1) != 0;
+          tally.all_skipped = false;
+        }
+        tally.ends_in_prev = ((p >> (63 - std::countl_zero(kept))) & 1) != 0;
+      },
+      target, prev, skip);
+  return tally;
+}
+
+// Number of bytes in target whose closest preceding byte outside skip is in prev, such as sentence ends that
+// follow text rather than another end when skip is the whitespace. before_in_prev tells whether the text
+// continues such a byte, possibly followed by skipped ones.
+inline size_t count_preceded(const char* text, size_t n, const ByteClass& target, const ByteClass& prev,
+                             const ByteClass& skip, bool before_in_prev = false) {
+  return tally_preceded(text, n, target, prev, skip).count(before_in_prev);
+}
+
+// Occurrences of every byte value of a text, counted in one pass; the count of any byte or class is then read
+// from the 256 bins without scanning the text again. Histograms of parts of a text add up to that of the whole,
+// so the bins can be summed across processes as one array.
+class ByteHistogram {
+ public:
+  static constexpr size_t kBins = 256;
+
+  ByteHistogram() = default;
+  ByteHistogram(const char* text, size_t n) { add(text, n); }
+
+  // Eight interleaved sub-histograms, one per byte of a 64-bit word: a run of equal bytes increments eight
+  // different counters in turn, so an increment does not wait for the store of the one before. A word equal to
+  // the one before is only counted, and its bytes are added once the run of such words ends, so long runs of one
+  // byte cost a compare per eight bytes. The 32-bit counters keep all eight in 8 KiB of L1 and are flushed into
+  // the 64-bit bins before they can overflow.
+  void add(const char* text, size_t n) {
+    constexpr size_t kFlush = size_t(1) << 31;
+    const auto* p = reinterpret_cast<const uint8_t*>(text);
+    while (n > 0) {
+      const size_t m = n < kFlush ? n : kFlush;
+      std::array<std::array<uint32_t, kBins>, 8> sub{};
+      auto add_word = [&sub](uint64_t w, uint32_t times) {
+        sub[0][w & 0xff] += times;
+        sub[1][(w >> 8) & 0xff] += times;
+        sub[2][(w >> 16) & 0xff] += times;
+        sub[3][(w >> 24) & 0xff] += times;
+        sub[4][(w >> 32) & 0xff] += times;
+        sub[5][(w >> 40) & 0xff] += times;
+        sub[6][(w >> 48) & 0xff] += times;
+        sub[7][w >> 56] += times;
+      };
+      uint64_t prev = 0;
+      uint32_t repeats = 0;
+      size_t i = 0;
+      for (; i + 8 <= m; i += 8) {
+        uint64_t w;
+        std::memcpy(&w, p + i, 8);
+        if (w == prev) {
+          repeats++;
+          continue;
+        }
+        add_word(prev, repeats);
+        prev = w;
+        repeats = 1;
+      }
+      add_word(prev, repeats);
+      for (; i < m; i++) sub[i % 8][p[i]]++;
+      for (size_t b = 0; b < kBins; b++) {
+        uint64_t total = 0;
+        for (const auto& table : sub) total += table[b];
+        bins_[b] += total;
+      }
+      p += m;
+      n -= m;
+    }
+  }
+
+  uint64_t count(char ch) const { return bins_[static_cast<uint8_t>(ch)]; }
+  uint64_t count(const ByteClass& cls) const {
+    uint64_t total = 0;
+    for (size_t b = 0; b < kBins; b++) total += cls.contains(static_cast<char>(b)) ? bins_[b] : 0;
+    return total;
+  }
+
+  ByteHistogram& operator+=(const ByteHistogram& other) {
+    for (size_t b = 0; b < kBins; b++) bins_[b] += other.bins_[b];
+    return *this;
+  }
+
+  // The bins as one array, e.g. for a reduce of kBins values
+  uint64_t* data() { return bins_.data(); }
+  const uint64_t* data() const { return bins_.data(); }
+
+ private:
+  std::array<uint64_t, kBins> bins_{};
+};
+
+}  // namespace ppc::util
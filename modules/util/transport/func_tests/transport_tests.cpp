@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "util/transport/include/raw_types.hpp"
+
+using ppc::util::is_raw_v;
+using ppc::util::RawContiguous;
+using ppc::util::RawResizable;
+
+namespace {
+
+struct Rgb {
+  uint8_t r, g, b;
+};
+
+struct Owning {
+  std::vector<double> values;
+};
+
+}  // namespace
+
+TEST(transport, raw_values_are_trivially_copyable_and_not_pointers) {
+  EXPECT_TRUE(is_raw_v<int>);
+  EXPECT_TRUE(is_raw_v<double>);
+  EXPECT_TRUE(is_raw_v<Rgb>);
+  EXPECT_TRUE((is_raw_v<std::array<Rgb, 4>>));
+  EXPECT_FALSE(is_raw_v<int*>);
+  EXPECT_FALSE(is_raw_v<int Rgb::*>);
+  EXPECT_FALSE(is_raw_v<Owning>);
+  EXPECT_FALSE(is_raw_v<std::string>);
+  EXPECT_FALSE(is_raw_v<std::shared_ptr<int>>);
+}
+
+TEST(transport, contiguous_containers_of_raw_values_go_as_one_block) {
+  EXPECT_TRUE(RawResizable<std::vector<int>>);
+  EXPECT_TRUE(RawResizable<std::vector<Rgb>>);
+  EXPECT_TRUE(RawResizable<std::string>);
+  EXPECT_TRUE(RawResizable<std::u32string>);
+  EXPECT_TRUE((RawContiguous<std::array<double, 3>>));
+  EXPECT_FALSE((RawResizable<std::array<double, 3>>));
+
+  // Packed bits, pointers and values that own memory are left to serialization
+  EXPECT_FALSE(RawContiguous<std::vector<bool>>);
+  EXPECT_FALSE(RawContiguous<std::vector<int*>>);
+  EXPECT_FALSE(RawContiguous<std::vector<std::string>>);
+  EXPECT_FALSE(RawContiguous<std::vector<Owning>>);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+
+namespace ppc::util {
+
+// Values that mean the same on another process when copied byte by byte: trivially copyable and not pointers.
+// A struct holding a pointer passes too, so only mark such a struct raw if the pointer is never followed elsewhere.
+template <class T>
+inline constexpr bool is_raw_v =
+    std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !std::is_member_pointer_v<T>;
+
+// Containers keeping such values in one block: std::vector (but not of bool), std::basic_string, std::array, ...
+template <class C>
+concept RawContiguous =
+    std::ranges::contiguous_range<C> && std::ranges::sized_range<C> && is_raw_v<std::ranges::range_value_t<C>>;
+
+// ... and those of them that can take the size of what arrives
+template <class C>
+concept RawResizable = RawContiguous<C> && requires(C& c, std::size_t n) { c.resize(n); };
+
+}  // namespace ppc::util
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <stdexcept>
+
+#include "util/transport/include/raw_types.hpp"
+
+namespace ppc::util {
+
+namespace transport_detail {
+
+inline int free_type(MPI_Comm /*comm*/, int /*keyval*/, void* type, void* /*extra_state*/) {
+  return MPI_Type_free(static_cast<MPI_Datatype*>(type));
+}
+
+// MPI_Finalize deletes the attributes of MPI_COMM_SELF before it shuts anything down, so a type attached to
+// it is freed while MPI still runs. The keyval is released at once and lives on until the attribute goes.
+inline void free_at_finalize(MPI_Datatype* type) {
+  int keyval;
+  MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, free_type, &keyval, nullptr);
+  MPI_Comm_set_attr(MPI_COMM_SELF, keyval, type);
+  MPI_Comm_free_keyval(&keyval);
+}
+
+}  // namespace transport_detail
+
+// One T as sizeof(T) bytes, committed on first use and freed by MPI_Finalize
+template <class T>
+MPI_Datatype raw_datatype() {
+  static MPI_Datatype type = MPI_DATATYPE_NULL;
+  static const bool committed = [] {
+    MPI_Type_contiguous(static_cast<int>(sizeof(T)), MPI_BYTE, &type);
+    MPI_Type_commit(&type);
+    transport_detail::free_at_finalize(&type);
+    return true;
+  }();
+  (void)committed;
+  return type;
+}
+
+// Counts of MPI calls are ints
+inline int raw_count(std::size_t n) {
+  if (n > INT_MAX) throw std::invalid_argument("transport: more than INT_MAX values in one call");
+  return static_cast<int>(n);
+}
+
+// Boost.MPI packs anything that is not an MPI datatype into a serialization archive, copies the archive and
+// unpacks it again, and sends vectors and strings as a size and then the archive. These send raw values, and
+// vectors, strings and arrays of them, as one block of bytes (vectors and strings in a broadcast after their
+// size), and fall back to Boost.MPI for everything else. What send sends, recv must receive.
+template <class T>
+void broadcast(const boost::mpi::communicator& comm, T& value, int root) {
+  if constexpr (RawResizable<T>) {
+    auto size = static_cast<uint64_t>(std::ranges::size(value));
+    MPI_Bcast(&size, 1, MPI_UINT64_T, root, comm);
+    if (comm.rank() != root) value.resize(size);
+    MPI_Bcast(std::ranges::data(value), raw_count(size), raw_datatype<std::ranges::range_value_t<T>>(), root, comm);
+  } else if constexpr (RawContiguous<T>) {
+    MPI_Bcast(std::ranges::data(value), raw_count(std::ranges::size(value)),
+              raw_datatype<std::ranges::range_value_t<T>>(), root, comm);
+  } else if constexpr (is_raw_v<T>) {
+    MPI_Bcast(&value, 1, raw_datatype<T>(), root, comm);
+  } else {
+    boost::mpi::broadcast(comm, value, root);
+  }
+}
+
+template <class T>
+void send(const boost::mpi::communicator& comm, int dest, int tag, const T& value) {
+  if constexpr (RawContiguous<T>) {
+    MPI_Send(std::ranges::data(value), raw_count(std::ranges::size(value)),
+             raw_datatype<std::ranges::range_value_t<T>>(), dest, tag, comm);
+  } else if constexpr (is_raw_v<T>) {
+    MPI_Send(&value, 1, raw_datatype<T>(), dest, tag, comm);
+  } else {
+    comm.send(dest, tag, value);
+  }
+}
+
+// A vector or string takes the size of the message, which the receiver learns from probing it
+template <class T>
+void recv(const boost::mpi::communicator& comm, int source, int tag, T& value) {
+  if constexpr (RawResizable<T>) {
+    const auto type = raw_datatype<std::ranges::range_value_t<T>>();
+    MPI_Status status;
+    MPI_Probe(source, tag, comm, &status);
+    int count = 0;
+    MPI_Get_count(&status, type, &count);
+    value.resize(count);
+    MPI_Recv(std::ranges::data(value), count, type, status.MPI_SOURCE, status.MPI_TAG, comm, MPI_STATUS_IGNORE);
+  } else if constexpr (RawContiguous<T>) {
+    MPI_Recv(std::ranges::data(value), raw_count(std::ranges::size(value)),
+             raw_datatype<std::ranges::range_value_t<T>>(), source, tag, comm, MPI_STATUS_IGNORE);
+  } else if constexpr (is_raw_v<T>) {
+    MPI_Recv(&value, 1, raw_datatype<T>(), source, tag, comm, MPI_STATUS_IGNORE);
+  } else {
+    comm.recv(source, tag, value);
+  }
+}
+
+}  // namespace ppc::util
+
+// Makes T an MPI datatype for Boost.MPI, as sizeof(T) raw bytes: sends, collectives and reductions of T, and of
+// arrays of T, then go straight to MPI instead of through serialization. Use at global scope, after T.
+#define PPC_MPI_RAW_DATATYPE(T)                                                                        \
+  namespace boost::mpi {                                                                               \
+  template <>                                                                                          \
+  struct is_mpi_datatype<T> : boost::mpl::true_ {                                                      \
+    static_assert(::ppc::util::is_raw_v<T>, "PPC_MPI_RAW_DATATYPE: " #T " is not trivially copyable"); \
+  };                                                                                                   \
+  template <>                                                                                          \
+  inline MPI_Datatype get_mpi_datatype<T>(const T&) {                                                  \
+    return ::ppc::util::raw_datatype<T>();                                                             \
+  }                                                                                                    \
+  }
@@ -2,6 +2,7 @@
 
 build\bin\core_func_tests.exe --gtest_also_run_disabled_tests --gtest_repeat=10 --gtest_recreate_environments_when_repeating || exit 1
 build\bin\ref_func_tests.exe  --gtest_also_run_disabled_tests --gtest_repeat=10 --gtest_recreate_environments_when_repeating || exit 1
+build\bin\util_func_tests.exe --gtest_also_run_disabled_tests --gtest_repeat=10 --gtest_recreate_environments_when_repeating || exit 1
 
 if "%CLANG_BUILD%" NEQ "1" mpiexec.exe -np 4 build\bin\sample_mpi.exe
 if "%CLANG_BUILD%" NEQ "1" mpiexec.exe -np 4 build\bin\sample_mpi_boost.exe
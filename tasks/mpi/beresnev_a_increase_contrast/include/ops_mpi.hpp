@@ -8,9 +8,13 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/contrast/include/contrast.hpp"
 
 namespace beresnev_a_increase_contrast_mpi {
 
+// Byte value -> value with its contrast around mid-grey scaled by factor
+ppc::util::ContrastLut contrastLut(double factor);
+
 class TestMPITaskSequential : public ppc::core::Task {
  public:
   explicit TestMPITaskSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
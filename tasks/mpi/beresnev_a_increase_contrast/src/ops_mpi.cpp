@@ -5,6 +5,16 @@
 #include <string>
 #include <vector>
 
+ppc::util::ContrastLut beresnev_a_increase_contrast_mpi::contrastLut(double factor) {
+  // Tabulated once for the 256 byte values instead of evaluated per byte
+  return ppc::util::make_lut([factor](uint8_t v) {
+    double normalized = v / 255.0;
+    normalized = (normalized - 0.5) * factor + 0.5;
+    normalized = std::clamp(normalized, 0.0, 1.0);
+    return static_cast<uint8_t>(normalized * 255);
+  });
+}
+
 bool beresnev_a_increase_contrast_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
   inp_.assign(taskData->inputs[0] + pixel_data_start, taskData->inputs[0] + pixel_data_start + pixel_data_size);
@@ -68,12 +78,7 @@ bool beresnev_a_increase_contrast_mpi::TestMPITaskSequential::validation() {
 
 bool beresnev_a_increase_contrast_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  for (size_t i = 0; i < pixel_data_size; ++i) {
-    double normalized = inp_[i] / 255.0;
-    normalized = (normalized - 0.5) * factor + 0.5;
-    normalized = std::clamp(normalized, 0.0, 1.0);
-    res_[i] = static_cast<uint8_t>(normalized * 255);
-  }
+  ppc::util::apply_lut(contrastLut(factor), inp_.data(), res_.data(), pixel_data_size);
   return true;
 }
 
@@ -170,12 +175,7 @@ bool beresnev_a_increase_contrast_mpi::TestMPITaskParallel::run() {
   std::vector<uint8_t> inp_l(sizes[world.rank()]);
   std::vector<uint8_t> res_l(sizes[world.rank()]);
   boost::mpi::scatterv(world, inp_, sizes, inp_l.data(), 0);
-  for (int i = 0; i < sizes[world.rank()]; ++i) {
-    double normalized = inp_l[i] / 255.0;
-    normalized = (normalized - 0.5) * factor + 0.5;
-    normalized = std::clamp(normalized, 0.0, 1.0);
-    res_l[i] = static_cast<uint8_t>(normalized * 255);
-  }
+  ppc::util::apply_lut(contrastLut(factor), inp_l.data(), res_l.data(), inp_l.size());
   boost::mpi::gatherv(world, res_l, res_.data(), sizes, 0);
   return true;
 }
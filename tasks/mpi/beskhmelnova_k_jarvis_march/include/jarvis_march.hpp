@@ -9,19 +9,16 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/geometry/include/geometry.hpp"
 
 namespace beskhmelnova_k_jarvis_march_mpi {
 
 template <typename DataType>
-DataType crossProduct(const std::vector<DataType>& p1, const std::vector<DataType>& p2,
-                      const std::vector<DataType>& p3);
+using Point = ppc::util::Point2<DataType>;
 
+// Gift wrapping counter-clockwise from the lexicographically smallest point, without collinear points
 template <typename DataType>
-bool isLeftAngle(const std::vector<DataType>& p1, const std::vector<DataType>& p2, const std::vector<DataType>& p3);
-
-template <typename DataType>
-void jarvisMarch(int& num_points, std::vector<std::vector<DataType>>& input, std::vector<DataType>& res_x,
-                 std::vector<DataType>& res_y);
+std::vector<Point<DataType>> jarvisMarch(const std::vector<Point<DataType>>& points);
 
 int localNumPoints(int num_points, int world_size, int rank);
 
@@ -36,10 +33,8 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  int num_points{};
-  std::vector<std::vector<DataType>> input;
-  std::vector<DataType> res_x;
-  std::vector<DataType> res_y;
+  ppc::util::PointCloud<DataType> input;
+  std::vector<Point<DataType>> hull;
 };
 
 template <typename DataType>
@@ -56,14 +51,6 @@ class TestMPITaskParallel : public ppc::core::Task {
   boost::mpi::communicator world;
 
   int num_points{};
-  std::vector<DataType> input_x;
-  std::vector<DataType> input_y;
-  std::vector<DataType> res_x;
-  std::vector<DataType> res_y;
-
-  int local_num_points{};
-  std::vector<DataType> local_input_x;
-  std::vector<DataType> local_input_y;
-  std::vector<std::vector<DataType>> local_input;
+  std::vector<Point<DataType>> hull;
 };
 }  // namespace beskhmelnova_k_jarvis_march_mpi
\ No newline at end of file
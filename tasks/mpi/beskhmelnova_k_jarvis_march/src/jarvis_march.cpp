@@ -1,8 +1,7 @@
 #include "mpi/beskhmelnova_k_jarvis_march/include/jarvis_march.hpp"
 
-#include <random>
-
-using namespace std::chrono_literals;
+#include <algorithm>
+#include <vector>
 
 int beskhmelnova_k_jarvis_march_mpi::localNumPoints(int num_points, int world_size, int rank) {
   if (num_points / world_size < 3) {
@@ -14,62 +13,39 @@ int beskhmelnova_k_jarvis_march_mpi::localNumPoints(int num_points, int world_si
 }
 
 template <typename DataType>
-DataType beskhmelnova_k_jarvis_march_mpi::crossProduct(const std::vector<DataType>& p1, const std::vector<DataType>& p2,
-                                                       const std::vector<DataType>& p3) {
-  return ((p2[1] - p1[1]) * (p3[2] - p1[2]) - (p3[1] - p1[1]) * (p2[2] - p1[2]));
-}
-
-template <typename DataType>
-bool beskhmelnova_k_jarvis_march_mpi::isLeftAngle(const std::vector<DataType>& p1, const std::vector<DataType>& p2,
-                                                  const std::vector<DataType>& p3) {
-  return cross_product(p1, p2, p3) > 0;
-}
-
-template <typename DataType>
-void beskhmelnova_k_jarvis_march_mpi::jarvisMarch(int& num_points, std::vector<std::vector<DataType>>& input,
-                                                  std::vector<DataType>& res_x, std::vector<DataType>& res_y) {
-  int leftmost_index = 0;
-  for (int i = 1; i < num_points; i++)
-    if (input[i][1] < input[leftmost_index][1] ||
-        (input[i][1] == input[leftmost_index][1] && input[i][2] < input[leftmost_index][2]))
-      leftmost_index = i;
-  std::swap(input[0], input[leftmost_index]);
-  std::vector<std::vector<DataType>> hull;
-  int current = 0;
+std::vector<beskhmelnova_k_jarvis_march_mpi::Point<DataType>> beskhmelnova_k_jarvis_march_mpi::jarvisMarch(
+    const std::vector<Point<DataType>>& points) {
+  const Point<DataType> start = *std::min_element(points.begin(), points.end(), ppc::util::lex_less<DataType>);
+  auto squared_distance = [](const Point<DataType>& a, const Point<DataType>& b) {
+    const double dx = static_cast<double>(a.x) - b.x;
+    const double dy = static_cast<double>(a.y) - b.y;
+    return dx * dx + dy * dy;
+  };
+  std::vector<Point<DataType>> hull;
+  Point<DataType> current = start;
   do {
-    hull.push_back(input[current]);
-    int next = (current + 1) % num_points;
-    for (int i = 0; i < num_points; ++i) {
-      auto cross_product =
-          beskhmelnova_k_jarvis_march_mpi::crossProduct<DataType>(input[current], input[next], input[i]);
-      if (cross_product < 0 || (cross_product == 0 &&
-                                std::hypot(input[i][1] - input[current][1], input[i][2] - input[current][2]) >
-                                    std::hypot(input[next][1] - input[current][1], input[next][2] - input[current][2])))
-        next = i;
+    hull.push_back(current);
+    Point<DataType> next = current;
+    for (const auto& p : points) {
+      // Exact turns: a rounded one may skip a vertex or never return to the start
+      const int turn = ppc::util::orientation(current, next, p);
+      if (next == current || turn < 0 ||
+          (turn == 0 && squared_distance(current, p) > squared_distance(current, next))) {
+        next = p;
+      }
     }
     current = next;
-  } while (current != 0);
-  num_points = static_cast<int>(hull.size());
-  res_x.resize(num_points);
-  res_y.resize(num_points);
-  for (int i = 0; i < num_points; ++i) {
-    res_x[i] = hull[i][1];
-    res_y[i] = hull[i][2];
-  }
-  input = hull;
+  } while (!(current == start));
+  return hull;
 }
 
 template <typename DataType>
 bool beskhmelnova_k_jarvis_march_mpi::TestMPITaskSequential<DataType>::pre_processing() {
   internal_order_test();
-  num_points = (int)taskData->inputs_count[0];
-  input = std::vector<std::vector<DataType>>(num_points, std::vector<DataType>(3, 0));
   auto* ptr_x = reinterpret_cast<DataType*>(taskData->inputs[0]);
   auto* ptr_y = reinterpret_cast<DataType*>(taskData->inputs[1]);
-  for (int i = 0; i < num_points; i++) {
-    input[i][1] = ptr_x[i];
-    input[i][2] = ptr_y[i];
-  }
+  input.x.assign(ptr_x, ptr_x + taskData->inputs_count[0]);
+  input.y.assign(ptr_y, ptr_y + taskData->inputs_count[0]);
   return true;
 }
 
@@ -82,17 +58,18 @@ bool beskhmelnova_k_jarvis_march_mpi::TestMPITaskSequential<DataType>::validatio
 template <typename DataType>
 bool beskhmelnova_k_jarvis_march_mpi::TestMPITaskSequential<DataType>::run() {
   internal_order_test();
-  jarvisMarch(num_points, input, res_x, res_y);
+  // Points strictly inside the Akl-Toussaint octagon are never wrapped, so each step scans few candidates
+  hull = jarvisMarch(ppc::util::akl_toussaint(input));
   return true;
 }
 
 template <typename DataType>
 bool beskhmelnova_k_jarvis_march_mpi::TestMPITaskSequential<DataType>::post_processing() {
   internal_order_test();
-  reinterpret_cast<int*>(taskData->outputs[0])[0] = num_points;
-  for (int i = 0; i < num_points; i++) {
-    reinterpret_cast<DataType*>(taskData->outputs[1])[i] = input[i][1];
-    reinterpret_cast<DataType*>(taskData->outputs[2])[i] = input[i][2];
+  reinterpret_cast<int*>(taskData->outputs[0])[0] = static_cast<int>(hull.size());
+  for (size_t i = 0; i < hull.size(); i++) {
+    reinterpret_cast<DataType*>(taskData->outputs[1])[i] = hull[i].x;
+    reinterpret_cast<DataType*>(taskData->outputs[2])[i] = hull[i].y;
   }
   return true;
 }
@@ -100,17 +77,7 @@ bool beskhmelnova_k_jarvis_march_mpi::TestMPITaskSequential<DataType>::post_proc
 template <typename DataType>
 bool beskhmelnova_k_jarvis_march_mpi::TestMPITaskParallel<DataType>::pre_processing() {
   internal_order_test();
-  if (world.rank() == 0) {
-    num_points = (int)taskData->inputs_count[0];
-    input_x = std::vector<DataType>(num_points);
-    input_y = std::vector<DataType>(num_points);
-    auto* ptr_x = reinterpret_cast<DataType*>(taskData->inputs[0]);
-    auto* ptr_y = reinterpret_cast<DataType*>(taskData->inputs[1]);
-    for (int i = 0; i < num_points; i++) {
-      input_x[i] = ptr_x[i];
-      input_y[i] = ptr_y[i];
-    }
-  }
+  if (world.rank() == 0) num_points = (int)taskData->inputs_count[0];
   return true;
 }
 
@@ -125,73 +92,38 @@ template <typename DataType>
 bool beskhmelnova_k_jarvis_march_mpi::TestMPITaskParallel<DataType>::run() {
   internal_order_test();
   broadcast(world, num_points, 0);
+  std::vector<int> sizes(world.size());
+  std::vector<int> displs(world.size(), 0);
+  for (int i = 0; i < world.size(); i++) sizes[i] = localNumPoints(num_points, world.size(), i);
+  for (int i = 1; i < world.size(); i++) displs[i] = displs[i - 1] + sizes[i - 1];
+
+  ppc::util::PointCloud<DataType> local;
+  local.x.resize(sizes[world.rank()]);
+  local.y.resize(sizes[world.rank()]);
   if (world.rank() == 0) {
-    local_num_points = localNumPoints(num_points, world.size(), world.rank());
-    local_input_x = std::vector<DataType>(input_x.begin(), input_x.begin() + local_num_points);
-    local_input_y = std::vector<DataType>(input_y.begin(), input_y.begin() + local_num_points);
-    int sum_next_num_points = local_num_points;
-    for (int i = 1; i < world.size(); i++) {
-      int next_num_points = localNumPoints(num_points, world.size(), i);
-      if (next_num_points != 0) {
-        world.send(i, 0, input_x.data() + sum_next_num_points, next_num_points);
-        world.send(i, 0, input_y.data() + sum_next_num_points, next_num_points);
-      }
-      sum_next_num_points += next_num_points;
-    }
+    boost::mpi::scatterv(world, reinterpret_cast<DataType*>(taskData->inputs[0]), sizes, displs, local.x.data(),
+                         sizes[0], 0);
+    boost::mpi::scatterv(world, reinterpret_cast<DataType*>(taskData->inputs[1]), sizes, displs, local.y.data(),
+                         sizes[0], 0);
   } else {
-    local_num_points = localNumPoints(num_points, world.size(), world.rank());
-    if (local_num_points != 0) {
-      local_input_x = std::vector<DataType>(local_num_points);
-      local_input_y = std::vector<DataType>(local_num_points);
-      world.recv(0, 0, local_input_x.data(), local_num_points);
-      world.recv(0, 0, local_input_y.data(), local_num_points);
-    }
+    boost::mpi::scatterv(world, local.x.data(), sizes[world.rank()], 0);
+    boost::mpi::scatterv(world, local.y.data(), sizes[world.rank()], 0);
   }
 
-  if (local_num_points != 0) {
-    local_input = std::vector<std::vector<DataType>>(local_num_points, std::vector<DataType>(3, 0));
-    for (int i = 0; i < local_num_points; i++) {
-      local_input[i][1] = local_input_x[i];
-      local_input[i][2] = local_input_y[i];
-    }
-    std::vector<DataType> local_res_x;
-    std::vector<DataType> local_res_y;
-    jarvisMarch(local_num_points, local_input, local_res_x, local_res_y);
-    local_input_x = local_res_x;
-    local_input_y = local_res_y;
-  }
+  // The hull of the local hulls is the hull of all points; they travel as packed coordinate pairs
+  std::vector<Point<DataType>> local_hull;
+  if (local.size() != 0) local_hull = jarvisMarch(ppc::util::akl_toussaint(local));
+  int local_size = static_cast<int>(local_hull.size()) * 2;
   if (world.rank() == 0) {
-    input_x.assign(local_input_x.begin(), local_input_x.end());
-    input_y.assign(local_input_y.begin(), local_input_y.end());
-    int sum_next_num_points = local_num_points;
-    for (int i = 1; i < world.size(); i++) {
-      int next_num_points;
-      world.recv(i, 0, &next_num_points, 1);
-      if (next_num_points != 0) {
-        world.recv(i, 0, input_x.data() + sum_next_num_points, next_num_points);
-        world.recv(i, 0, input_y.data() + sum_next_num_points, next_num_points);
-      }
-      sum_next_num_points += next_num_points;
-    }
-    local_num_points = sum_next_num_points;
+    boost::mpi::gather(world, local_size, sizes, 0);
+    for (int i = 1; i < world.size(); i++) displs[i] = displs[i - 1] + sizes[i - 1];
+    std::vector<Point<DataType>> candidates((displs.back() + sizes.back()) / 2);
+    boost::mpi::gatherv(world, reinterpret_cast<DataType*>(local_hull.data()), local_size,
+                        reinterpret_cast<DataType*>(candidates.data()), sizes, displs, 0);
+    hull = jarvisMarch(candidates);
   } else {
-    world.send(0, 0, &local_num_points, 1);
-    if (local_num_points != 0) {
-      world.send(0, 0, local_input_x.data(), local_num_points);
-      world.send(0, 0, local_input_y.data(), local_num_points);
-    }
-  }
-  if (world.rank() == 0) {
-    local_input = std::vector<std::vector<DataType>>(local_num_points, std::vector<DataType>(3, 0));
-    for (int i = 0; i < local_num_points; i++) {
-      local_input[i][1] = input_x[i];
-      local_input[i][2] = input_y[i];
-    }
-    std::vector<DataType> final_res_x;
-    std::vector<DataType> final_res_y;
-    jarvisMarch(local_num_points, local_input, final_res_x, final_res_y);
-    res_x = final_res_x;
-    res_y = final_res_y;
+    boost::mpi::gather(world, local_size, 0);
+    boost::mpi::gatherv(world, reinterpret_cast<DataType*>(local_hull.data()), local_size, 0);
   }
   return true;
 }
@@ -200,10 +132,10 @@ template <typename DataType>
 bool beskhmelnova_k_jarvis_march_mpi::TestMPITaskParallel<DataType>::post_processing() {
   internal_order_test();
   if (world.rank() == 0) {
-    reinterpret_cast<int*>(taskData->outputs[0])[0] = static_cast<int>(res_x.size());
-    for (size_t i = 0; i < res_x.size(); i++) {
-      reinterpret_cast<DataType*>(taskData->outputs[1])[i] = res_x[i];
-      reinterpret_cast<DataType*>(taskData->outputs[2])[i] = res_y[i];
+    reinterpret_cast<int*>(taskData->outputs[0])[0] = static_cast<int>(hull.size());
+    for (size_t i = 0; i < hull.size(); i++) {
+      reinterpret_cast<DataType*>(taskData->outputs[1])[i] = hull[i].x;
+      reinterpret_cast<DataType*>(taskData->outputs[2])[i] = hull[i].y;
     }
   }
   return true;
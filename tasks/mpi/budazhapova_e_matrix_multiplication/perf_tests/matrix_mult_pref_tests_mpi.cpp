@@ -1,12 +1,16 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <boost/mpi/timer.hpp>
+#include <boost/serialization/vector.hpp>
+#include <iostream>
 #include <string>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
 #include "mpi/budazhapova_e_matrix_multiplication/include/matrix_mult_mpi.hpp"
+#include "util/transport/include/transport.hpp"
 
 TEST(budazhapova_e_matrix_mult_mpi, test_pipeline_run) {
   boost::mpi::communicator world;
@@ -81,3 +85,28 @@ TEST(budazhapova_e_matrix_mult_mpi, test_task_run) {
     ppc::core::Perf::print_perf_statistic(perfResults);
   }
 }
+
+TEST(budazhapova_e_matrix_mult_mpi, broadcast_latency_and_bandwidth) {
+  boost::mpi::communicator world;
+  // Vectors as run() broadcasts them, through Boost.MPI's serialization and as raw bytes, from 4 bytes to 4 MB
+  for (size_t n : {size_t{1}, size_t{16}, size_t{256}, size_t{4096}, size_t{65536}, size_t{1} << 20}) {
+    const int repeats = static_cast<int>(std::clamp<size_t>((size_t{1} << 22) / n, 5, 1000));
+    std::vector<int> values(world.rank() == 0 ? n : 0, 7);
+    auto seconds_per_broadcast = [&](auto broadcast) {
+      world.barrier();
+      const boost::mpi::timer timer;
+      for (int r = 0; r < repeats; r++) broadcast(values);
+      world.barrier();
+      return timer.elapsed() / repeats;
+    };
+    const double serialized = seconds_per_broadcast([&](std::vector<int>& v) { boost::mpi::broadcast(world, v, 0); });
+    const double raw = seconds_per_broadcast([&](std::vector<int>& v) { ppc::util::broadcast(world, v, 0); });
+    ASSERT_EQ(values, std::vector<int>(n, 7));
+    if (world.rank() == 0) {
+      const double bytes = static_cast<double>(n * sizeof(int));
+      std::cout << "broadcast of " << n * sizeof(int) << " bytes: serialized " << serialized * 1e6 << " us ("
+                << bytes / serialized / 1e9 << " GB/s), raw " << raw * 1e6 << " us (" << bytes / raw / 1e9 << " GB/s)"
+                << std::endl;
+    }
+  }
+}
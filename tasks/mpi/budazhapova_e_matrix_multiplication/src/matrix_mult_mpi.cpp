@@ -10,6 +10,8 @@
 #include <thread>
 #include <vector>
 
+#include "util/transport/include/transport.hpp"
+
 bool budazhapova_e_matrix_mult_mpi::MatrixMultSequential::pre_processing() {
   internal_order_test();
   A = std::vector<int>(reinterpret_cast<int*>(taskData->inputs[0]),
@@ -84,8 +86,8 @@ bool budazhapova_e_matrix_mult_mpi::MatrixMultParallel::run() {
 
   boost::mpi::broadcast(world, columns, 0);
   boost::mpi::broadcast(world, rows, 0);
-  boost::mpi::broadcast(world, A, 0);
-  boost::mpi::broadcast(world, b, 0);
+  ppc::util::broadcast(world, A, 0);
+  ppc::util::broadcast(world, b, 0);
 
   int n_of_send_rows;
   int n_of_proc_with_extra_row;
@@ -3,11 +3,14 @@
 #include <algorithm>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace burykin_m_word_count {
 
@@ -27,7 +30,6 @@ class TestTaskSequential : public ppc::core::Task {
   std::string input_;
   int word_count_{};
 
-  static bool is_word_character(char c);
   static int count_words(const std::string& text);
 };
 
@@ -46,11 +48,7 @@ class TestTaskParallel : public ppc::core::Task {
   std::vector<char> input_;
   std::vector<char> local_input_;
   int word_count_{};
-  int local_word_count_{};
   int length{};
-
-  static bool is_word_character(char c);
-  int count_words(const std::vector<char>& text);
 };
 
 }  // namespace burykin_m_word_count
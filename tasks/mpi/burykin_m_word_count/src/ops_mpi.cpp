@@ -31,24 +31,8 @@ bool TestTaskSequential::post_processing() {
   reinterpret_cast<int *>(taskData->outputs[0])[0] = word_count_;
   return true;
 }
-bool TestTaskSequential::is_word_character(char c) { return std::isalpha(static_cast<unsigned char>(c)) != 0; }
-
 int TestTaskSequential::count_words(const std::string &text) {
-  int count = 0;
-  bool in_word = false;
-
-  for (char c : text) {
-    if (is_word_character(c)) {
-      if (!in_word) {
-        count++;
-        in_word = true;
-      }
-    } else {
-      in_word = false;
-    }
-  }
-
-  return count;
+  return static_cast<int>(ppc::util::count_runs(text.data(), text.size(), ppc::util::ByteClass::ascii_alpha()));
 }
 
 bool TestTaskParallel::pre_processing() {
@@ -81,53 +65,26 @@ bool TestTaskParallel::validation() {
 bool TestTaskParallel::run() {
   internal_order_test();
 
-  if (length == 0) {
-    return true;
-  }
-
-#if defined(_MSC_VER) && !defined(__clang__)
-  if (world.size() == 1) {
-    for (int i = 0; i < length; i++) {
-      if (!is_word_character(input_[i])) word_count_++;
-    }
-    word_count_++;
-    return true;
-  }
-#endif
-
-  int world_size = world.size();
-
-  if (world.rank() > length) {
-    return true;
+  // Every rank, the root included, gets a slice cut at any byte; the tallies join the words cut in two, so the
+  // count equals the sequential one for any number of processes
+  std::vector<int> sizes(world.size());
+  std::vector<int> displs(world.size());
+  for (int i = 0; i < world.size(); i++) {
+    displs[i] = static_cast<int>(static_cast<int64_t>(length) * i / world.size());
+    sizes[i] = static_cast<int>(static_cast<int64_t>(length) * (i + 1) / world.size()) - displs[i];
   }
-  if (world_size > length + 1) world_size = length + 1;
-
-  int partSize = length / (world_size - 1);
-  int endPartSize = length - partSize * (world_size - 2);
-
+  local_input_.resize(sizes[world.rank()]);
   if (world.rank() == 0) {
-    for (int i = 0; i < world_size - 2; i++) {
-      world.send(i + 1, 0, input_.data() + i * partSize, partSize);
-    }
-    world.send(world_size - 1, 0, input_.data() + (world_size - 2) * partSize, endPartSize);
-
-    int counter = 0;
-    for (int i = 0; i < world_size - 1; i++) {
-      world.recv(i + 1, 1, &counter, 1);
-      word_count_ += counter;
-    }
-    word_count_++;
+    boost::mpi::scatterv(world, input_.data(), sizes, displs, local_input_.data(), sizes[0], 0);
   } else {
-    int localPart = partSize;
-    if (world_size - 1 == world.rank()) localPart = endPartSize;
-    std::vector<char> chunk(localPart);
-    int counter = 0;
-    world.recv(0, 0, chunk.data(), localPart);
-
-    for (char ch : chunk)
-      if (!is_word_character(ch)) counter++;
-    world.send(0, 1, &counter, 1);
+    boost::mpi::scatterv(world, local_input_.data(), sizes[world.rank()], 0);
   }
+
+  const auto local_tally =
+      ppc::util::tally_runs(local_input_.data(), local_input_.size(), ppc::util::ByteClass::ascii_alpha());
+  ppc::util::RunTally tally;
+  boost::mpi::reduce(world, local_tally, tally, std::plus<>(), 0);
+  word_count_ = static_cast<int>(tally.count());
   return true;
 }
 
@@ -139,6 +96,4 @@ bool TestTaskParallel::post_processing() {
   return true;
 }
 
-bool TestTaskParallel::is_word_character(char c) { return std::isalpha(static_cast<unsigned char>(c)) != 0; }
-
 }  // namespace burykin_m_word_count
@@ -6,6 +6,7 @@
 
 #include "core/task/include/task.hpp"
 #include "mpi/chernykh_a_adjust_image_contrast/include/pixel.hpp"
+#include "util/contrast/include/contrast.hpp"
 
 namespace chernykh_a_adjust_image_contrast_mpi {
 
@@ -13,6 +13,8 @@ class Pixel {
 
   static Pixel from_hex_color(uint32_t hex_color);
 
+  // Contrast of a single channel value around mid-grey; with_contrast applies it to every channel
+  static uint8_t adjust_channel(uint8_t value, float factor);
   Pixel with_contrast(float factor) const;
   bool operator==(const Pixel& other) const;
   friend std::ostream& operator<<(std::ostream& os, const Pixel& pixel);
@@ -7,6 +7,8 @@
 
 namespace chernykh_a_adjust_image_contrast_mpi {
 
+static_assert(sizeof(Pixel) == 3, "pixels are handled as interleaved RGB bytes");
+
 bool SequentialTask::validation() {
   internal_order_test();
   return contrast_factor >= 0.0 && contrast_factor <= 2.0 &&       // Contrast factor within [0.0, 2.0]
@@ -26,8 +28,10 @@ bool SequentialTask::pre_processing() {
 
 bool SequentialTask::run() {
   internal_order_test();
-  std::transform(input.begin(), input.end(), result.begin(),
-                 [this](const Pixel& p) { return p.with_contrast(contrast_factor); });
+  // The adjustment depends on the byte value alone, so every channel of every pixel goes through one table
+  auto lut = ppc::util::make_lut([this](uint8_t v) { return Pixel::adjust_channel(v, contrast_factor); });
+  ppc::util::apply_lut(lut, reinterpret_cast<const uint8_t*>(input.data()), reinterpret_cast<uint8_t*>(result.data()),
+                       3 * input.size());
   return true;
 }
 
@@ -63,26 +67,38 @@ bool ParallelTask::pre_processing() {
 bool ParallelTask::run() {
   internal_order_test();
   auto sizes = std::vector<int>(world.size(), 0);
-  auto local_input = std::vector<Pixel>();
-  auto local_result = std::vector<Pixel>();
+  auto displs = std::vector<int>(world.size(), 0);
 
   if (world.rank() == 0) {
+    // Counted in bytes: a Pixel is three raw channel bytes, so no serialization is needed
     auto input_size = int(input.size());
     auto active_processes = std::min(world.size(), input_size);
     auto size = input_size / active_processes;
     auto remainder = input_size % active_processes;
-    std::fill_n(sizes.begin(), active_processes - remainder, size);
-    std::fill_n(sizes.begin() + active_processes - remainder, remainder, size + 1);
+    std::fill_n(sizes.begin(), active_processes - remainder, 3 * size);
+    std::fill_n(sizes.begin() + active_processes - remainder, remainder, 3 * (size + 1));
+    for (int i = 1; i < world.size(); i++) displs[i] = displs[i - 1] + sizes[i - 1];
   }
   boost::mpi::broadcast(world, sizes, 0);
 
-  local_input.resize(sizes[world.rank()]);
-  local_result.resize(sizes[world.rank()]);
+  auto local_input = std::vector<uint8_t>(sizes[world.rank()]);
+  auto local_result = std::vector<uint8_t>(sizes[world.rank()]);
+  if (world.rank() == 0) {
+    boost::mpi::scatterv(world, reinterpret_cast<const uint8_t*>(input.data()), sizes, displs, local_input.data(),
+                         sizes[0], 0);
+  } else {
+    boost::mpi::scatterv(world, local_input.data(), sizes[world.rank()], 0);
+  }
+
+  auto lut = ppc::util::make_lut([this](uint8_t v) { return Pixel::adjust_channel(v, contrast_factor); });
+  ppc::util::apply_lut(lut, local_input.data(), local_result.data(), local_input.size());
 
-  boost::mpi::scatterv(world, input, sizes, local_input.data(), 0);
-  std::transform(local_input.begin(), local_input.end(), local_result.begin(),
-                 [this](const Pixel& p) { return p.with_contrast(contrast_factor); });
-  boost::mpi::gatherv(world, local_result, result.data(), sizes, 0);
+  if (world.rank() == 0) {
+    boost::mpi::gatherv(world, local_result.data(), sizes[0], reinterpret_cast<uint8_t*>(result.data()), sizes, displs,
+                        0);
+  } else {
+    boost::mpi::gatherv(world, local_result.data(), sizes[world.rank()], 0);
+  }
   return true;
 }
 
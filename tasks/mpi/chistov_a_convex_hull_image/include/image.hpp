@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/labeling/include/labeling.hpp"
 
 namespace chistov_a_convex_hull_image_mpi {
 
@@ -30,7 +31,6 @@ class ConvexHullMPI : public ppc::core::Task {
 
  private:
   std::vector<int> image;
-  std::vector<std::vector<Point>> components;
   int width{};
   int height{};
   int size{};
@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include <boost/mpi/timer.hpp>
+#include <chrono>
+#include <random>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
@@ -113,4 +115,63 @@ TEST(chistov_a_convex_hull_image_mpi, test_task_run) {
 
     ASSERT_EQ(hull, expected_hull);
   }
-}
\ No newline at end of file
+}
+
+TEST(chistov_a_convex_hull_image_mpi, test_labeling_throughput) {
+  boost::mpi::communicator world;
+  const int width = 2500;
+  const int height = 2500;
+
+  std::vector<int> image;
+  std::vector<int> hull;
+  std::vector<int> expected_hull;
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    // Noise near the percolation threshold: many components, many of them crossing band borders
+    image.resize(width * height);
+    std::mt19937 gen(7);
+    std::bernoulli_distribution bit(0.6);
+    for (auto &pixel : image) pixel = bit(gen) ? 1 : 0;
+    hull.resize(width * height);
+
+    // The noise touches every edge of the image, so the hull spans the whole frame
+    expected_hull.resize(width * height, 0);
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) {
+        if (x == 0 || y == 0 || x == width - 1 || y == height - 1) {
+          expected_hull[y * width + x] = 1;
+        }
+      }
+    }
+
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(image.data()));
+    taskDataPar->inputs_count.emplace_back(width * height);
+    taskDataPar->inputs_count.emplace_back(width);
+    taskDataPar->inputs_count.emplace_back(height);
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(hull.data()));
+    taskDataPar->outputs_count.emplace_back(width * height);
+  }
+
+  auto TestTaskPar = std::make_shared<chistov_a_convex_hull_image_mpi::ConvexHullMPI>(taskDataPar);
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perfAttr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Labeling happens in pre_processing, so the whole pipeline is timed
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(TestTaskPar);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+
+    ASSERT_EQ(hull, expected_hull);
+  }
+}
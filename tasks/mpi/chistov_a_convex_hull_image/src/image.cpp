@@ -1,6 +1,7 @@
 #include "mpi/chistov_a_convex_hull_image/include/image.hpp"
 
 #include <algorithm>
+#include <boost/serialization/vector.hpp>
 #include <functional>
 #include <string>
 #include <thread>
@@ -48,69 +49,37 @@ int cross(const Point& p1, const Point& p2, const Point& p3) {
   return (p2.x - p1.x) * (p3.y - p1.y) - (p2.y - p1.y) * (p3.x - p1.x);
 }
 
-void labelingFirstPass(std::vector<int>& labeled_image, int width, int height) {
-  int mark = 2;
-
-  for (int i = 0; i < height; ++i) {
-    for (int j = 0; j < width; ++j) {
-      int current = labeled_image[i * width + j];
-      int left = (j == 0) ? 0 : labeled_image[i * width + (j - 1)];
-      int upper = (i == 0) ? 0 : labeled_image[(i - 1) * width + j];
-
-      if (current == 0) continue;
-
-      if (left == 0 && upper == 0) {
-        labeled_image[i * width + j] = mark++;
-      } else {
-        labeled_image[i * width + j] = std::max(left, upper);
-      }
+// Boundary pixels of every component: the leftmost and rightmost pixel of each of its rows. Every hull vertex
+// is among them, so a component of n rows gives the hull at most 2n points, however many pixels it has.
+std::vector<std::vector<Point>> componentBoundaries(const ppc::util::BandLabels& band) {
+  std::vector<std::vector<Point>> components(band.count);
+  for (const auto& run : band.runs) {
+    auto& points = components[run.label];
+    // Runs of a row arrive left to right: a later run of the same row only moves the right end
+    if (points.size() >= 2 && points.back().y == run.row && points[points.size() - 2].y == run.row) {
+      points.back().x = run.last;
+    } else if (!points.empty() && points.back().y == run.row) {
+      points.push_back(Point{run.last, run.row});
+    } else {
+      points.push_back(Point{run.first, run.row});
+      if (run.last != run.first) points.push_back(Point{run.last, run.row});
     }
   }
+  return components;
 }
 
-void labelingSecondPass(std::vector<int>& labeled_image, int width, int height) {
-  for (int i = height - 1; i >= 0; --i) {
-    for (int j = width - 1; j >= 0; --j) {
-      int current = labeled_image[i * width + j];
-      int right = (j == width - 1) ? 0 : labeled_image[i * width + (j + 1)];
-      int lower = (i == height - 1) ? 0 : labeled_image[(i + 1) * width + j];
-
-      if (current == 0 || (right == 0 && lower == 0)) continue;
-
-      labeled_image[i * width + j] = std::max(right, lower);
-    }
-  }
+void appendRuns(std::vector<int>& message, const std::vector<ppc::util::PixelRun>& runs) {
+  message.push_back(static_cast<int>(runs.size()));
+  for (const auto& run : runs) message.insert(message.end(), {run.row, run.first, run.last, run.label});
 }
 
-std::vector<std::vector<Point>> processLabeledImage(const std::vector<int>& labeled_image, int width, int height) {
-  std::vector<int> component_indices;
-  std::vector<std::vector<Point>> components;
-
-  for (int i = 0; i < height; i++) {
-    for (int j = 0; j < width; j++) {
-      if (labeled_image[i * width + j] == 0) continue;
-
-      int component_label = labeled_image[i * width + j];
-
-      if (static_cast<size_t>(component_label) < component_indices.size() && component_indices[component_label] != -1) {
-        components[component_indices[component_label]].push_back(Point{j, i});
-      } else {
-        component_indices.resize(std::max(component_indices.size(), static_cast<size_t>(component_label + 1)), -1);
-        component_indices[component_label] = components.size();
-        components.push_back({Point{j, i}});
-      }
-    }
+std::vector<ppc::util::PixelRun> readRuns(const std::vector<int>& message, size_t& pos) {
+  std::vector<ppc::util::PixelRun> runs(message[pos++]);
+  for (auto& run : runs) {
+    run = {message[pos], message[pos + 1], message[pos + 2], message[pos + 3]};
+    pos += 4;
   }
-  return components;
-}
-
-std::vector<std::vector<Point>> labeling(const std::vector<int>& image, int width, int height) {
-  std::vector<int> labeled_image(width * height);
-
-  std::copy(image.begin(), image.end(), labeled_image.begin());
-  labelingFirstPass(labeled_image, width, height);
-  labelingSecondPass(labeled_image, width, height);
-  return processLabeledImage(labeled_image, width, height);
+  return runs;
 }
 
 std::vector<Point> graham(std::vector<Point> points) {
@@ -167,7 +136,6 @@ bool ConvexHullMPI::pre_processing() {
     size = static_cast<int>(taskData->inputs_count[0]);
     height = static_cast<int>(taskData->inputs_count[1]);
     width = static_cast<int>(taskData->inputs_count[2]);
-    components = labeling(image, width, height);
   }
   return true;
 }
@@ -175,82 +143,76 @@ bool ConvexHullMPI::pre_processing() {
 bool ConvexHullMPI::run() {
   internal_order_test();
 
-  std::vector<std::vector<Point>> local_components;
-
-  auto toVector = [](const std::vector<Point>& points) -> std::vector<int> {
-    std::vector<int> result;
-    result.reserve(points.size() * 2);
-    for (const auto& point : points) {
-      result.push_back(point.x);
-      result.push_back(point.y);
-    }
-    return result;
-  };
-
-  auto toPoints = [](const std::vector<int>& vec) -> std::vector<Point> {
-    std::vector<Point> points;
-    points.reserve(vec.size() / 2);
-    for (size_t i = 0; i < vec.size(); i += 2) {
-      points.push_back({vec[i], vec[i + 1]});
-    }
-    return points;
-  };
+  boost::mpi::broadcast(world, width, 0);
+  boost::mpi::broadcast(world, height, 0);
 
+  // Each rank labels a band of whole rows; components crossing band borders are joined on rank 0
+  auto bandRow = [&](int k) { return static_cast<int>(static_cast<long long>(height) * k / world.size()); };
+  const int first_row = bandRow(world.rank());
+  const int last_row = bandRow(world.rank() + 1);
+  std::vector<int> local_image(static_cast<size_t>(last_row - first_row) * width);
   if (world.rank() == 0) {
-    int base_count = components.size() / world.size();
-    int remainder = components.size() % world.size();
-
-    int offset = 0;
-    for (int proc = 1; proc < world.size(); ++proc) {
-      int send_count = base_count + (proc < remainder ? 1 : 0);
-      world.send(proc, 0, &send_count, 1);
-
-      for (int i = 0; i < send_count; ++i) {
-        std::vector<int> int_component = toVector(components[offset + i]);
-        world.send(proc, 1, int_component);
-      }
-
-      offset += send_count;
+    std::vector<int> counts(world.size());
+    std::vector<int> displs(world.size());
+    for (int k = 0; k < world.size(); k++) {
+      displs[k] = bandRow(k) * width;
+      counts[k] = (bandRow(k + 1) - bandRow(k)) * width;
     }
-
-    int local_count = base_count + (0 < remainder ? 1 : 0);
-    for (int i = 0; i < local_count; ++i) {
-      local_components.push_back(components[offset + i]);
-    }
-
+    boost::mpi::scatterv(world, image.data(), counts, displs, local_image.data(), counts[0], 0);
   } else {
-    int recv_count;
-    world.recv(0, 0, &recv_count, 1);
-
-    for (int i = 0; i < recv_count; ++i) {
-      std::vector<int> int_component;
-      world.recv(0, 1, int_component);
-      local_components.push_back(toPoints(int_component));
-    }
+    boost::mpi::scatterv(world, local_image.data(), static_cast<int>(local_image.size()), 0);
   }
 
-  std::vector<Point> local_hulls;
-  for (const auto& component : local_components) {
+  auto band = ppc::util::label_band(local_image.data(), width, first_row, last_row);
+
+  // The band border plus the hull of every local component: hull(A u B) = hull(hull(A) u hull(B)), so the hulls
+  // stand in for the components when rank 0 joins them
+  std::vector<int> message{first_row, last_row, band.count};
+  appendRuns(message, band.top());
+  appendRuns(message, band.bottom());
+  for (const auto& component : componentBoundaries(band)) {
     auto hull = graham(component);
-    local_hulls.insert(local_hulls.end(), hull.begin(), hull.end());
+    message.push_back(static_cast<int>(hull.size()));
+    for (const auto& point : hull) message.insert(message.end(), {point.x, point.y});
   }
 
+  std::vector<std::vector<int>> messages;
+  boost::mpi::gather(world, message, messages, 0);
+
   if (world.rank() == 0) {
-    std::vector<Point> merged_hulls;
-    merged_hulls.insert(merged_hulls.end(), local_hulls.begin(), local_hulls.end());
-
-    for (int proc = 1; proc < world.size(); ++proc) {
-      std::vector<int> hull_ints;
-      world.recv(proc, 2, hull_ints);
-      auto hull = toPoints(hull_ints);
-      merged_hulls.insert(merged_hulls.end(), hull.begin(), hull.end());
+    std::vector<ppc::util::BandBorder> borders(messages.size());
+    std::vector<std::vector<Point>> local_hulls;
+    for (size_t k = 0; k < messages.size(); k++) {
+      const auto& m = messages[k];
+      size_t pos = 3;
+      borders[k].first_row = m[0];
+      borders[k].last_row = m[1];
+      borders[k].count = m[2];
+      borders[k].top = readRuns(m, pos);
+      borders[k].bottom = readRuns(m, pos);
+      for (int l = 0; l < borders[k].count; l++) {
+        std::vector<Point> hull(m[pos++]);
+        for (auto& point : hull) {
+          point = {m[pos], m[pos + 1]};
+          pos += 2;
+        }
+        local_hulls.push_back(std::move(hull));
+      }
     }
 
-    image = setPoints(graham(merged_hulls), width, height);
+    int count = 0;
+    auto ids = ppc::util::merge_bands(borders, &count);
+    std::vector<std::vector<Point>> components(count);
+    for (size_t i = 0; i < local_hulls.size(); i++) {
+      components[ids[i]].insert(components[ids[i]].end(), local_hulls[i].begin(), local_hulls[i].end());
+    }
 
-  } else {
-    std::vector<int> local_hulls_ints = toVector(local_hulls);
-    world.send(0, 2, local_hulls_ints);
+    std::vector<Point> points;
+    for (const auto& component : components) {
+      auto hull = graham(component);
+      points.insert(points.end(), hull.begin(), hull.end());
+    }
+    image = setPoints(points, width, height);
   }
 
   return true;
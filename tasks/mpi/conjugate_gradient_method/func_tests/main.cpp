@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "mpi/conjugate_gradient_method/include/ops_mpi.hpp"
+
+namespace conjugate_gradient_method_mpi {
+
+// Symmetric and strictly diagonally dominant with a positive diagonal, hence SPD
+std::vector<double> generate_spd_matrix(size_t n, double diagonal_spread = 1.0) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+
+  std::vector<double> A(n * n, 0.0);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = i + 1; j < n; ++j) {
+      A[i * n + j] = A[j * n + i] = dist(gen);
+    }
+  }
+  for (size_t i = 0; i < n; ++i) {
+    double row_sum = 0.0;
+    for (size_t j = 0; j < n; ++j) {
+      row_sum += (i != j) ? std::abs(A[i * n + j]) : 0.0;
+    }
+    A[i * n + i] = row_sum + 1.0;
+  }
+
+  // Symmetric diagonal scaling D * A * D keeps the matrix SPD but spreads the diagonal over several orders
+  if (diagonal_spread != 1.0) {
+    std::vector<double> d(n);
+    for (size_t i = 0; i < n; ++i) {
+      d[i] = std::pow(diagonal_spread, static_cast<double>(i) / static_cast<double>(n));
+    }
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        A[i * n + j] *= d[i] * d[j];
+      }
+    }
+  }
+  return A;
+}
+
+std::vector<double> multiply(const std::vector<double>& A, const std::vector<double>& x, size_t n) {
+  std::vector<double> b(n, 0.0);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      b[i] += A[i * n + j] * x[j];
+    }
+  }
+  return b;
+}
+
+}  // namespace conjugate_gradient_method_mpi
+
+void run_cg_test(size_t n, conjugate_gradient_method_mpi::Preconditioner preconditioner, int block_size = 4) {
+  boost::mpi::communicator world;
+
+  std::vector<double> A(n * n);
+  std::vector<double> x_true(n);
+  for (size_t i = 0; i < n; ++i) {
+    x_true[i] = static_cast<double>(i % 7) - 3.0;
+  }
+  if (world.rank() == 0) {
+    A = conjugate_gradient_method_mpi::generate_spd_matrix(n);
+  }
+  std::vector<double> b = conjugate_gradient_method_mpi::multiply(A, x_true, n);
+  std::vector<double> x_parallel(n, 0.0);
+  size_t n_copy = n;
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n_copy));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(A.data()));
+    taskDataPar->inputs_count.emplace_back(A.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    taskDataPar->inputs_count.emplace_back(b.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(x_parallel.data()));
+    taskDataPar->outputs_count.emplace_back(x_parallel.size());
+  }
+
+  conjugate_gradient_method_mpi::ConjugateGradientParallel cgParallel(taskDataPar, preconditioner, block_size);
+  ASSERT_TRUE(cgParallel.validation());
+  cgParallel.pre_processing();
+  cgParallel.run();
+  cgParallel.post_processing();
+
+  if (world.rank() == 0) {
+    std::vector<double> x_sequential(n, 0.0);
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n_copy));
+    taskDataSeq->inputs_count.emplace_back(1);
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(A.data()));
+    taskDataSeq->inputs_count.emplace_back(A.size());
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    taskDataSeq->inputs_count.emplace_back(b.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(x_sequential.data()));
+    taskDataSeq->outputs_count.emplace_back(x_sequential.size());
+
+    conjugate_gradient_method_mpi::ConjugateGradientSequential cgSequential(taskDataSeq, preconditioner, block_size);
+    ASSERT_TRUE(cgSequential.validation());
+    cgSequential.pre_processing();
+    cgSequential.run();
+    cgSequential.post_processing();
+
+    for (size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(x_parallel[i], x_true[i], 1e-6);
+      EXPECT_NEAR(x_sequential[i], x_true[i], 1e-6);
+    }
+  }
+}
+
+TEST(conjugate_gradient_method_mpi, test_1x1_no_preconditioner) { run_cg_test(1, conjugate_gradient_method_mpi::NONE); }
+
+TEST(conjugate_gradient_method_mpi, test_5x5_no_preconditioner) { run_cg_test(5, conjugate_gradient_method_mpi::NONE); }
+
+TEST(conjugate_gradient_method_mpi, test_5x5_jacobi) { run_cg_test(5, conjugate_gradient_method_mpi::JACOBI); }
+
+TEST(conjugate_gradient_method_mpi, test_37x37_jacobi) { run_cg_test(37, conjugate_gradient_method_mpi::JACOBI); }
+
+TEST(conjugate_gradient_method_mpi, test_37x37_block_jacobi) {
+  run_cg_test(37, conjugate_gradient_method_mpi::BLOCK_JACOBI, 5);
+}
+
+TEST(conjugate_gradient_method_mpi, test_100x100_block_jacobi) {
+  run_cg_test(100, conjugate_gradient_method_mpi::BLOCK_JACOBI, 16);
+}
+
+TEST(conjugate_gradient_method_mpi, test_128x128_no_preconditioner) {
+  run_cg_test(128, conjugate_gradient_method_mpi::NONE);
+}
+
+TEST(conjugate_gradient_method_mpi, test_jacobi_reduces_iterations_on_badly_scaled_matrix) {
+  const size_t n = 60;
+  std::vector<double> A = conjugate_gradient_method_mpi::generate_spd_matrix(n, 1e4);
+  std::vector<double> b(n, 1.0);
+  size_t n_copy = n;
+
+  size_t iterations[2];
+  conjugate_gradient_method_mpi::Preconditioner preconditioners[2] = {conjugate_gradient_method_mpi::NONE,
+                                                                      conjugate_gradient_method_mpi::JACOBI};
+  for (int k = 0; k < 2; ++k) {
+    std::vector<double> x(n, 0.0);
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n_copy));
+    taskDataSeq->inputs_count.emplace_back(1);
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(A.data()));
+    taskDataSeq->inputs_count.emplace_back(A.size());
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    taskDataSeq->inputs_count.emplace_back(b.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(x.data()));
+    taskDataSeq->outputs_count.emplace_back(x.size());
+
+    conjugate_gradient_method_mpi::ConjugateGradientSequential cgSequential(taskDataSeq, preconditioners[k]);
+    ASSERT_TRUE(cgSequential.validation());
+    cgSequential.pre_processing();
+    cgSequential.run();
+    cgSequential.post_processing();
+    iterations[k] = cgSequential.get_iterations();
+  }
+  EXPECT_LT(iterations[1], iterations[0]);
+}
+
+TEST(conjugate_gradient_method_mpi, test_non_symmetric_matrix_fails_validation) {
+  boost::mpi::communicator world;
+  size_t n = 2;
+  std::vector<double> A = {4.0, 1.0, 2.0, 3.0};
+  std::vector<double> b = {1.0, 2.0};
+  std::vector<double> x(n, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(A.data()));
+    taskDataPar->inputs_count.emplace_back(A.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    taskDataPar->inputs_count.emplace_back(b.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(x.data()));
+    taskDataPar->outputs_count.emplace_back(x.size());
+  }
+
+  conjugate_gradient_method_mpi::ConjugateGradientParallel cgParallel(taskDataPar);
+  if (world.rank() == 0) {
+    ASSERT_FALSE(cgParallel.validation());
+  }
+}
+
+TEST(conjugate_gradient_method_mpi, test_wrong_vector_size_fails_validation) {
+  size_t n = 3;
+  std::vector<double> A = {2.0, 0.0, 0.0, 0.0, 2.0, 0.0, 0.0, 0.0, 2.0};
+  std::vector<double> b = {1.0, 2.0};
+  std::vector<double> x(n, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+  taskDataSeq->inputs_count.emplace_back(1);
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(A.data()));
+  taskDataSeq->inputs_count.emplace_back(A.size());
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+  taskDataSeq->inputs_count.emplace_back(b.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(x.data()));
+  taskDataSeq->outputs_count.emplace_back(x.size());
+
+  conjugate_gradient_method_mpi::ConjugateGradientSequential cgSequential(taskDataSeq);
+  ASSERT_FALSE(cgSequential.validation());
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace conjugate_gradient_method_mpi {
+
+enum Preconditioner { NONE, JACOBI, BLOCK_JACOBI };
+
+// Inverse of the block diagonal of the rows [row_begin, row_begin + count) of a row-major n x n matrix.
+// Blocks never cross the row range, so every rank applies its part without communication.
+class BlockJacobi {
+ public:
+  void build(const double* rows, int row_begin, int count, int n, int block_size);
+  void apply(const double* r, double* z) const;
+
+ private:
+  int count_ = 0;
+  int block_size_ = 1;
+  // Cholesky factors of the diagonal blocks, each stored densely block_size x block_size
+  std::vector<double> factors_;
+};
+
+class ConjugateGradientSequential : public ppc::core::Task {
+ public:
+  explicit ConjugateGradientSequential(std::shared_ptr<ppc::core::TaskData> taskData_,
+                                       Preconditioner preconditioner_ = JACOBI, int block_size_ = 16)
+      : Task(std::move(taskData_)), preconditioner(preconditioner_), block_size(block_size_) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  size_t get_iterations() const { return iterations; }
+
+ private:
+  std::vector<double> A_;
+  std::vector<double> b_;
+  std::vector<double> x_;
+  size_t n;
+  size_t iterations = 0;
+
+  Preconditioner preconditioner;
+  int block_size;
+  BlockJacobi M_;
+  double epsilon_ = 1e-10;
+};
+
+class ConjugateGradientParallel : public ppc::core::Task {
+ public:
+  explicit ConjugateGradientParallel(std::shared_ptr<ppc::core::TaskData> taskData_,
+                                     Preconditioner preconditioner_ = JACOBI, int block_size_ = 16)
+      : Task(std::move(taskData_)), preconditioner(preconditioner_), block_size(block_size_) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  size_t get_iterations() const { return iterations; }
+
+ private:
+  std::vector<double> A_;
+  std::vector<double> b_;
+  std::vector<double> x_;
+  size_t n;
+  size_t iterations = 0;
+
+  std::vector<double> local_A;
+  std::vector<double> local_b;
+  std::vector<int> sizes;
+  std::vector<int> displs;
+
+  Preconditioner preconditioner;
+  int block_size;
+  BlockJacobi M_;
+  double epsilon_ = 1e-10;
+
+  boost::mpi::communicator world;
+};
+
+bool isSymmetricPositiveDiagonal(const double* A, size_t n);
+
+}  // namespace conjugate_gradient_method_mpi
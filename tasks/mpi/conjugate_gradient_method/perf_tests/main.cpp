@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/timer.hpp>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "mpi/conjugate_gradient_method/include/ops_mpi.hpp"
+
+namespace {
+
+std::vector<double> generate_spd_matrix(size_t n) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+
+  std::vector<double> A(n * n, 0.0);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = i + 1; j < n; ++j) {
+      A[i * n + j] = A[j * n + i] = dist(gen);
+    }
+  }
+  for (size_t i = 0; i < n; ++i) {
+    double row_sum = 0.0;
+    for (size_t j = 0; j < n; ++j) {
+      row_sum += (i != j) ? std::abs(A[i * n + j]) : 0.0;
+    }
+    A[i * n + i] = row_sum + 1.0;
+  }
+  return A;
+}
+
+std::shared_ptr<conjugate_gradient_method_mpi::ConjugateGradientParallel> make_task(
+    std::vector<size_t>& in_size, std::vector<double>& A, std::vector<double>& b, std::vector<double>& out) {
+  boost::mpi::communicator world;
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_size.data()));
+    taskDataPar->inputs_count.emplace_back(in_size.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(A.data()));
+    taskDataPar->inputs_count.emplace_back(A.size());
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    taskDataPar->inputs_count.emplace_back(b.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskDataPar->outputs_count.emplace_back(out.size());
+  }
+  return std::make_shared<conjugate_gradient_method_mpi::ConjugateGradientParallel>(
+      taskDataPar, conjugate_gradient_method_mpi::BLOCK_JACOBI, 32);
+}
+
+}  // namespace
+
+TEST(conjugate_gradient_method_mpi, test_pipeline_run) {
+  boost::mpi::communicator world;
+
+  const size_t matrix_size = 1024;
+  std::vector<double> A = generate_spd_matrix(matrix_size);
+  std::vector<double> b(matrix_size, 1.0);
+  std::vector<size_t> in_size(1, matrix_size);
+  std::vector<double> out(matrix_size, 0.0);
+
+  auto cgTaskParallel = make_task(in_size, A, b, out);
+  ASSERT_EQ(cgTaskParallel->validation(), true);
+  cgTaskParallel->pre_processing();
+  cgTaskParallel->run();
+  cgTaskParallel->post_processing();
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(cgTaskParallel);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    ASSERT_EQ(matrix_size, out.size());
+  }
+}
+
+TEST(conjugate_gradient_method_mpi, test_task_run) {
+  boost::mpi::communicator world;
+
+  const size_t matrix_size = 1024;
+  std::vector<double> A = generate_spd_matrix(matrix_size);
+  std::vector<double> b(matrix_size, 1.0);
+  std::vector<size_t> in_size(1, matrix_size);
+  std::vector<double> out(matrix_size, 0.0);
+
+  auto cgTaskParallel = make_task(in_size, A, b, out);
+  ASSERT_EQ(cgTaskParallel->validation(), true);
+  cgTaskParallel->pre_processing();
+  cgTaskParallel->run();
+  cgTaskParallel->post_processing();
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(cgTaskParallel);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    ASSERT_EQ(matrix_size, out.size());
+  }
+}
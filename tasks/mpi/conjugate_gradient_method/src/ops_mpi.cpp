@@ -0,0 +1,310 @@
+#include "mpi/conjugate_gradient_method/include/ops_mpi.hpp"
+
+#include <algorithm>
+#include <boost/mpi/collectives/all_gatherv.hpp>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+void conjugate_gradient_method_mpi::BlockJacobi::build(const double* rows, int row_begin, int count, int n,
+                                                       int block_size) {
+  count_ = count;
+  block_size_ = std::max(block_size, 1);
+  factors_.assign(((count + block_size_ - 1) / block_size_) * block_size_ * block_size_, 0.0);
+
+  for (int first = 0; first < count; first += block_size_) {
+    int m = std::min(block_size_, count - first);
+    double* L = factors_.data() + (first / block_size_) * block_size_ * block_size_;
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < m; ++j) {
+        L[i * block_size_ + j] = rows[(first + i) * n + row_begin + first + j];
+      }
+    }
+
+    // Cholesky in place, the lower triangle keeps L. A block that is not positive definite falls back to its
+    // diagonal, which is still a valid preconditioner for an SPD system.
+    bool factored = true;
+    for (int j = 0; j < m && factored; ++j) {
+      double d = L[j * block_size_ + j];
+      for (int k = 0; k < j; ++k) {
+        d -= L[j * block_size_ + k] * L[j * block_size_ + k];
+      }
+      if (d <= 0.0) {
+        factored = false;
+        break;
+      }
+      L[j * block_size_ + j] = std::sqrt(d);
+      for (int i = j + 1; i < m; ++i) {
+        double s = L[i * block_size_ + j];
+        for (int k = 0; k < j; ++k) {
+          s -= L[i * block_size_ + k] * L[j * block_size_ + k];
+        }
+        L[i * block_size_ + j] = s / L[j * block_size_ + j];
+      }
+    }
+    if (!factored) {
+      for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < m; ++j) {
+          L[i * block_size_ + j] = (i == j) ? std::sqrt(rows[(first + i) * n + row_begin + first + i]) : 0.0;
+        }
+      }
+    }
+  }
+}
+
+void conjugate_gradient_method_mpi::BlockJacobi::apply(const double* r, double* z) const {
+  for (int first = 0; first < count_; first += block_size_) {
+    int m = std::min(block_size_, count_ - first);
+    const double* L = factors_.data() + (first / block_size_) * block_size_ * block_size_;
+    double* y = z + first;
+    for (int i = 0; i < m; ++i) {
+      double s = r[first + i];
+      for (int k = 0; k < i; ++k) {
+        s -= L[i * block_size_ + k] * y[k];
+      }
+      y[i] = s / L[i * block_size_ + i];
+    }
+    for (int i = m - 1; i >= 0; --i) {
+      double s = y[i];
+      for (int k = i + 1; k < m; ++k) {
+        s -= L[k * block_size_ + i] * y[k];
+      }
+      y[i] = s / L[i * block_size_ + i];
+    }
+  }
+}
+
+bool conjugate_gradient_method_mpi::isSymmetricPositiveDiagonal(const double* A, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    if (A[i * n + i] <= 0.0) {
+      return false;
+    }
+    for (size_t j = i + 1; j < n; ++j) {
+      if (std::fabs(A[i * n + j] - A[j * n + i]) > 1e-12 * std::max(1.0, std::fabs(A[i * n + j]))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool conjugate_gradient_method_mpi::ConjugateGradientSequential::pre_processing() {
+  internal_order_test();
+  n = *reinterpret_cast<size_t*>(taskData->inputs[0]);
+
+  auto* A_input = reinterpret_cast<double*>(taskData->inputs[1]);
+  auto* b_input = reinterpret_cast<double*>(taskData->inputs[2]);
+  A_.assign(A_input, A_input + n * n);
+  b_.assign(b_input, b_input + n);
+  x_.assign(n, 0.0);
+
+  int m = preconditioner == BLOCK_JACOBI ? block_size : 1;
+  M_.build(A_.data(), 0, static_cast<int>(n), static_cast<int>(n), m);
+  return true;
+}
+
+bool conjugate_gradient_method_mpi::ConjugateGradientSequential::validation() {
+  internal_order_test();
+  if (taskData->inputs_count.size() != 3 || taskData->outputs_count.size() != 1) {
+    return false;
+  }
+  n = *reinterpret_cast<size_t*>(taskData->inputs[0]);
+  if (n == 0 || taskData->inputs_count[1] != n * n || taskData->inputs_count[2] != n ||
+      taskData->outputs_count[0] != n) {
+    return false;
+  }
+  return isSymmetricPositiveDiagonal(reinterpret_cast<double*>(taskData->inputs[1]), n);
+}
+
+bool conjugate_gradient_method_mpi::ConjugateGradientSequential::run() {
+  internal_order_test();
+  std::vector<double> r(b_);
+  std::vector<double> z(n);
+  std::vector<double> p(n);
+  std::vector<double> q(n);
+  std::fill(x_.begin(), x_.end(), 0.0);
+
+  if (preconditioner == NONE) {
+    z = r;
+  } else {
+    M_.apply(r.data(), z.data());
+  }
+  p = z;
+  double rz = std::inner_product(r.begin(), r.end(), z.begin(), 0.0);
+  double rr = std::inner_product(r.begin(), r.end(), r.begin(), 0.0);
+  double stop = epsilon_ * epsilon_ * rr;
+
+  for (iterations = 0; iterations < 2 * n + 100 && rr > stop; iterations++) {
+    for (size_t i = 0; i < n; i++) {
+      q[i] = std::inner_product(p.begin(), p.end(), A_.begin() + i * n, 0.0);
+    }
+    double alpha = rz / std::inner_product(p.begin(), p.end(), q.begin(), 0.0);
+    for (size_t i = 0; i < n; i++) {
+      x_[i] += alpha * p[i];
+      r[i] -= alpha * q[i];
+    }
+
+    if (preconditioner == NONE) {
+      z = r;
+    } else {
+      M_.apply(r.data(), z.data());
+    }
+    double rz_new = std::inner_product(r.begin(), r.end(), z.begin(), 0.0);
+    rr = std::inner_product(r.begin(), r.end(), r.begin(), 0.0);
+    double beta = rz_new / rz;
+    rz = rz_new;
+    for (size_t i = 0; i < n; i++) {
+      p[i] = z[i] + beta * p[i];
+    }
+  }
+  return true;
+}
+
+bool conjugate_gradient_method_mpi::ConjugateGradientSequential::post_processing() {
+  internal_order_test();
+  std::copy(x_.begin(), x_.end(), reinterpret_cast<double*>(taskData->outputs[0]));
+  return true;
+}
+
+bool conjugate_gradient_method_mpi::ConjugateGradientParallel::pre_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    n = *reinterpret_cast<size_t*>(taskData->inputs[0]);
+    auto* A_input = reinterpret_cast<double*>(taskData->inputs[1]);
+    auto* b_input = reinterpret_cast<double*>(taskData->inputs[2]);
+    A_.assign(A_input, A_input + n * n);
+    b_.assign(b_input, b_input + n);
+    x_.assign(n, 0.0);
+  }
+  boost::mpi::broadcast(world, n, 0);
+
+  sizes.assign(world.size(), static_cast<int>(n / world.size()));
+  displs.assign(world.size(), 0);
+  for (int proc = 0; proc < world.size(); proc++) {
+    if (proc < static_cast<int>(n % world.size())) {
+      sizes[proc]++;
+    }
+    if (proc > 0) {
+      displs[proc] = displs[proc - 1] + sizes[proc - 1];
+    }
+  }
+
+  std::vector<int> sizes_a(world.size());
+  std::vector<int> displs_a(world.size());
+  for (int proc = 0; proc < world.size(); proc++) {
+    sizes_a[proc] = sizes[proc] * static_cast<int>(n);
+    displs_a[proc] = displs[proc] * static_cast<int>(n);
+  }
+
+  int count = sizes[world.rank()];
+  local_A.resize(count * n);
+  local_b.resize(count);
+  if (world.rank() == 0) {
+    boost::mpi::scatterv(world, A_.data(), sizes_a, displs_a, local_A.data(), count * n, 0);
+    boost::mpi::scatterv(world, b_.data(), sizes, displs, local_b.data(), count, 0);
+  } else {
+    boost::mpi::scatterv(world, local_A.data(), count * n, 0);
+    boost::mpi::scatterv(world, local_b.data(), count, 0);
+  }
+
+  int m = preconditioner == BLOCK_JACOBI ? block_size : 1;
+  M_.build(local_A.data(), displs[world.rank()], count, static_cast<int>(n), m);
+  return true;
+}
+
+bool conjugate_gradient_method_mpi::ConjugateGradientParallel::validation() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    if (taskData->inputs_count.size() != 3 || taskData->outputs_count.size() != 1) {
+      return false;
+    }
+    n = *reinterpret_cast<size_t*>(taskData->inputs[0]);
+    if (n == 0 || taskData->inputs_count[1] != n * n || taskData->inputs_count[2] != n ||
+        taskData->outputs_count[0] != n) {
+      return false;
+    }
+    return isSymmetricPositiveDiagonal(reinterpret_cast<double*>(taskData->inputs[1]), n);
+  }
+  return true;
+}
+
+bool conjugate_gradient_method_mpi::ConjugateGradientParallel::run() {
+  internal_order_test();
+  // Chronopoulos-Gear form of preconditioned CG: the three dot products of an iteration are independent,
+  // so they travel in a single all_reduce next to the all_gatherv that assembles u for the product A * u
+  int count = sizes[world.rank()];
+  std::vector<double> x(count, 0.0);
+  std::vector<double> r(local_b);
+  std::vector<double> u(count);
+  std::vector<double> w(count);
+  std::vector<double> p(count, 0.0);
+  std::vector<double> s(count, 0.0);
+  std::vector<double> u_full(n);
+
+  auto precondition = [&] {
+    if (preconditioner == NONE) {
+      u = r;
+    } else {
+      M_.apply(r.data(), u.data());
+    }
+    boost::mpi::all_gatherv(world, u.data(), u_full.data(), sizes, displs);
+    for (int i = 0; i < count; i++) {
+      w[i] = std::inner_product(u_full.begin(), u_full.end(), local_A.begin() + i * n, 0.0);
+    }
+  };
+  auto reduce_dots = [&](double* global) {
+    double local[3] = {0.0, 0.0, 0.0};
+    for (int i = 0; i < count; i++) {
+      local[0] += r[i] * u[i];
+      local[1] += w[i] * u[i];
+      local[2] += r[i] * r[i];
+    }
+    boost::mpi::all_reduce(world, local, 3, global, std::plus<double>());
+  };
+
+  double dots[3];
+  precondition();
+  reduce_dots(dots);
+  double stop = epsilon_ * epsilon_ * dots[2];
+
+  double gamma_old = 0.0;
+  double alpha = 0.0;
+  for (iterations = 0; iterations < 2 * n + 100 && dots[2] > stop; iterations++) {
+    double gamma = dots[0];
+    double delta = dots[1];
+    double beta = 0.0;
+    if (iterations == 0) {
+      alpha = gamma / delta;
+    } else {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta * gamma / alpha);
+    }
+    gamma_old = gamma;
+
+    for (int i = 0; i < count; i++) {
+      p[i] = u[i] + beta * p[i];
+      s[i] = w[i] + beta * s[i];
+      x[i] += alpha * p[i];
+      r[i] -= alpha * s[i];
+    }
+
+    precondition();
+    reduce_dots(dots);
+  }
+
+  if (world.rank() == 0) {
+    boost::mpi::gatherv(world, x.data(), count, x_.data(), sizes, displs, 0);
+  } else {
+    boost::mpi::gatherv(world, x.data(), count, 0);
+  }
+  return true;
+}
+
+bool conjugate_gradient_method_mpi::ConjugateGradientParallel::post_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    std::copy(x_.begin(), x_.end(), reinterpret_cast<double*>(taskData->outputs[0]));
+  }
+  return true;
+}
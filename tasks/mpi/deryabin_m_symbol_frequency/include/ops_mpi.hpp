@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace deryabin_m_symbol_frequency_mpi {
 
@@ -23,11 +23,8 @@ bool deryabin_m_symbol_frequency_mpi::SymbolFrequencyMPITaskSequential::validati
 
 bool deryabin_m_symbol_frequency_mpi::SymbolFrequencyMPITaskSequential::run() {
   internal_order_test();
-  for (char i : input_str_) {
-    if (i == input_symbol_) {
-      frequency_++;
-    }
-  }
+  frequency_ = static_cast<int>(ppc::util::count_class(input_str_.data(), input_str_.size(),
+                                                        ppc::util::ByteClass::of({&input_symbol_, 1})));
   return true;
 }
 
@@ -80,11 +77,8 @@ bool deryabin_m_symbol_frequency_mpi::SymbolFrequencyMPITaskParallel::run() {
   frequency_ = 0;
   // Init local value
   local_found_ = 0;
-  for (char i : local_input_str_) {
-    if (i == input_symbol_) {
-      local_found_++;
-    }
-  }
+  local_found_ = static_cast<int>(ppc::util::count_class(local_input_str_.data(), local_input_str_.size(),
+                                                         ppc::util::ByteClass::of({&input_symbol_, 1})));
   boost::mpi::reduce(world, local_found_, frequency_, std::plus<>(), 0);
   return true;
 }
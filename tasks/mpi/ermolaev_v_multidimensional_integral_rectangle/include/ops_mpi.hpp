@@ -4,24 +4,63 @@
 #include <gtest/gtest.h>
 
 #include <boost/mpi/collectives.hpp>
+#include <boost/mpi/collectives/all_gatherv.hpp>
 #include <boost/mpi/communicator.hpp>
-#include <boost/serialization/deque.hpp>
 #include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
 #include <cmath>
-#include <deque>
 #include <functional>
+#include <utility>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/cubature/include/adaptive_cubature.hpp"
 
 namespace ermolaev_v_multidimensional_integral_rectangle_mpi {
 using function = std::function<double(std::vector<double>& args)>;
+using limits_t = std::vector<std::pair<double, double>>;
 
-double integrateImpl(std::deque<std::pair<double, double>>& limits, std::vector<double>& args, const function& func,
-                     double eps);
-double integrateSeq(std::deque<std::pair<double, double>> limits, double eps, const function& func);
-double integrateMPI(boost::mpi::communicator& world, std::deque<std::pair<double, double>> limits, double eps,
-                    const function& func);
+// Adaptive cubature to an absolute error of eps; F is any callable taking std::vector<double>& and is
+// inlined into the cubature rule when it is not a type-erased function
+template <class F>
+double integrateSeq(const limits_t& limits, double eps, F&& func) {
+  std::vector<double> lower;
+  std::vector<double> upper;
+  for (const auto& [a, b] : limits) {
+    lower.push_back(a);
+    upper.push_back(b);
+  }
+  ppc::util::CubatureOptions options;
+  options.epsilon = eps;
+  return ppc::util::adaptive_cubature(func, lower, upper, options).value;
+}
+
+// Every rank keeps the same heap of subregions; each round the worst ones are bisected and the children
+// dealt out over the ranks, whose estimates are all-gathered. The result does not depend on the rank count.
+template <class F>
+double integrateMPI(boost::mpi::communicator& world, limits_t limits, double eps, F&& func) {
+  broadcast(world, limits, 0);
+  broadcast(world, eps, 0);
+
+  std::vector<double> lower;
+  std::vector<double> upper;
+  for (const auto& [a, b] : limits) {
+    lower.push_back(a);
+    upper.push_back(b);
+  }
+  auto gather = [&](std::vector<double>& mine, std::vector<double>& all, const std::vector<int>& counts) {
+    int total = 0;
+    for (int c : counts) total += c;
+    all.resize(total);
+    boost::mpi::all_gatherv(world, mine, all, counts);
+  };
+  ppc::util::CubatureOptions options;
+  options.epsilon = eps;
+  auto result = ppc::util::adaptive_cubature(func, lower, upper, options, world.rank(), world.size(), gather);
+
+  if (world.rank() == 0) return result.value;
+  return 0;
+}
 
 class TestMPITaskSequential : public ppc::core::Task {
  public:
@@ -33,7 +72,7 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::deque<std::pair<double, double>> limits_;
+  limits_t limits_;
   function function_;
   double eps_{};
   double res_{};
@@ -49,7 +88,7 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::deque<std::pair<double, double>> limits_;
+  limits_t limits_;
   function function_;
   double eps_{};
   double res_{};
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 
 namespace gusev_n_trapezoidal_rule_mpi {
 
@@ -24,15 +25,18 @@ class TrapezoidalIntegrationSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
-  void set_function(const std::function<double(double)>& func);
+  // Any double(double) callable; a lambda is inlined into the batched quadrature loop
+  template <ppc::util::ScalarIntegrand F>
+  void set_function(F func) {
+    func_ = ppc::util::make_batch_integrand(std::move(func));
+  }
 
  private:
-  static double integrate(const std::function<double(double)>& f, double a, double b, int n);
   double a_{};
   double b_{};
   int n_{};
   double result_{};
-  std::function<double(double)> func_;
+  ppc::util::BatchIntegrand func_;
 };
 
 class TrapezoidalIntegrationParallel : public ppc::core::Task {
@@ -45,16 +49,17 @@ class TrapezoidalIntegrationParallel : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
-  void set_function(const std::function<double(double)>& func);
+  template <ppc::util::ScalarIntegrand F>
+  void set_function(F func) {
+    func_ = ppc::util::make_batch_integrand(std::move(func));
+  }
 
  private:
-  double parallel_integrate(const std::function<double(double)>& f, double a, double b, int n);
-
   double a_{};
   double b_{};
   int n_{};
   double global_result_{};
-  std::function<double(double)> func_;
+  ppc::util::BatchIntegrand func_;
 
   boost::mpi::communicator world;
 };
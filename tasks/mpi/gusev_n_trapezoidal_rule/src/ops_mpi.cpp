@@ -24,12 +24,12 @@ bool gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationSequential::pre_process
 
 bool gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationSequential::validation() {
   internal_order_test();
-  return taskData->outputs_count[0] == 1;
+  return taskData->outputs_count[0] == 1 && *reinterpret_cast<int*>(taskData->inputs[2]) > 0;
 }
 
 bool gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationSequential::run() {
   internal_order_test();
-  result_ = integrate(func_, a_, b_, n_);
+  result_ = ppc::util::composite_quadrature(func_, a_, b_, n_, ppc::util::QuadratureRule::kTrapezoid);
   return true;
 }
 
@@ -39,24 +39,6 @@ bool gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationSequential::post_proces
   return true;
 }
 
-double gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationSequential::integrate(const std::function<double(double)>& f,
-                                                                                 double a, double b, int n) {
-  double h = (b - a) / n;
-  double sum = 0.5 * (f(a) + f(b));
-
-  for (int i = 1; i < n; ++i) {
-    double x = a + i * h;
-    sum += f(x);
-  }
-
-  return sum * h;
-}
-
-void gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationSequential::set_function(
-    const std::function<double(double)>& func) {
-  func_ = func;
-}
-
 bool gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationParallel::pre_processing() {
   internal_order_test();
 
@@ -76,7 +58,7 @@ bool gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationParallel::pre_processin
 bool gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationParallel::validation() {
   internal_order_test();
   if (world.rank() == 0) {
-    return taskData->outputs_count[0] == 1;
+    return taskData->outputs_count[0] == 1 && *reinterpret_cast<int*>(taskData->inputs[2]) > 0;
   }
   return true;
 }
@@ -84,7 +66,12 @@ bool gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationParallel::validation()
 bool gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationParallel::run() {
   internal_order_test();
   MPI_Bcast(&a_, sizeof(a_) + sizeof(b_) + sizeof(n_), MPI_BYTE, 0, world);
-  double local_result = parallel_integrate(func_, a_, b_, n_);
+  // Each rank takes a contiguous block of the n subintervals
+  size_t n = n_;
+  size_t first = n * world.rank() / world.size();
+  size_t last = n * (world.rank() + 1) / world.size();
+  double local_result =
+      ppc::util::composite_quadrature(func_, a_, b_, n, ppc::util::QuadratureRule::kTrapezoid, first, last);
   reduce(world, local_result, global_result_, std::plus<>(), 0);
   return true;
 }
@@ -96,28 +83,3 @@ bool gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationParallel::post_processi
   }
   return true;
 }
-
-double gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationParallel::parallel_integrate(
-    const std::function<double(double)>& f, double a, double b, int n) {
-  int rank = world.rank();
-  int size = world.size();
-
-  double h = (b - a) / n;
-  double local_sum = 0.0;
-
-  for (int i = rank; i < n; i += size) {
-    double x = a + i * h;
-    local_sum += f(x);
-  }
-
-  if (rank == 0) {
-    local_sum += 0.5 * (f(a) + f(b));
-  }
-
-  return local_sum * h;
-}
-
-void gusev_n_trapezoidal_rule_mpi::TrapezoidalIntegrationParallel::set_function(
-    const std::function<double(double)>& func) {
-  func_ = func;
-}
\ No newline at end of file
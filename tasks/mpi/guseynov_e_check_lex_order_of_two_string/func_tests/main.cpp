@@ -445,4 +445,41 @@ TEST(guseynov_e_check_lex_order_of_two_string_mpi, Test_random_strings) {
     testMPITaskSequantial.post_processing();
     ASSERT_EQ(reference_res[0], global_res[0]);
   }
-}
\ No newline at end of file
+}
+TEST(guseynov_e_check_lex_order_of_two_string_mpi, Test_difference_after_long_equal_part) {
+  boost::mpi::communicator world;
+  // Differences inside the prefix checked first, on its border and in the slices sent to the processes
+  for (int pos : {100, 4096, 12345, 19999}) {
+    std::vector<std::vector<char>> global_vec(2);
+    if (world.rank() == 0) {
+      global_vec[0] = guseynov_e_check_lex_order_of_two_string_mpi::getRandomVector(20000);
+      global_vec[1] = global_vec[0];
+      global_vec[0][pos] = 'z';
+      global_vec[1][pos] = 'y';
+    }
+    std::vector<int32_t> global_res(1, -1);
+
+    // Create TaskData
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+    if (world.rank() == 0) {
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(global_vec[0].data()));
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(global_vec[1].data()));
+      taskDataPar->inputs_count.emplace_back(global_vec.size());
+      taskDataPar->inputs_count.emplace_back(global_vec[0].size());
+      taskDataPar->inputs_count.emplace_back(global_vec[1].size());
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(global_res.data()));
+      taskDataPar->outputs_count.emplace_back(global_res.size());
+    }
+
+    guseynov_e_check_lex_order_of_two_string_mpi::TestMPITaskParallel testMPITaskParallel(taskDataPar);
+    ASSERT_EQ(testMPITaskParallel.validation(), true);
+    testMPITaskParallel.pre_processing();
+    testMPITaskParallel.run();
+    testMPITaskParallel.post_processing();
+
+    if (world.rank() == 0) {
+      EXPECT_EQ(2, global_res[0]) << pos;
+    }
+  }
+}
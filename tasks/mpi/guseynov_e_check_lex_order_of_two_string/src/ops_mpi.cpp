@@ -1,8 +1,12 @@
 #include "mpi/guseynov_e_check_lex_order_of_two_string/include/ops_mpi.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <random>
 #include <vector>
 
+#include "util/text/include/text.hpp"
+
 std::vector<char> guseynov_e_check_lex_order_of_two_string_mpi::getRandomVector(int sz) {
   std::random_device dev;
   std::mt19937 gen(dev());
@@ -65,6 +69,14 @@ bool guseynov_e_check_lex_order_of_two_string_mpi::TestMPITaskSequential::post_p
 
 bool guseynov_e_check_lex_order_of_two_string_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
+  if (world.rank() == 0) {
+    // init vectors
+    input_ = std::vector<std::vector<char>>(taskData->inputs_count[0]);
+    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
+      auto* tmp_ptr = reinterpret_cast<char*>(taskData->inputs[i]);
+      input_[i] = std::vector<char>(tmp_ptr, tmp_ptr + taskData->inputs_count[i + 1]);
+    }
+  }
   return true;
 }
 
@@ -78,68 +90,47 @@ bool guseynov_e_check_lex_order_of_two_string_mpi::TestMPITaskParallel::validati
 
 bool guseynov_e_check_lex_order_of_two_string_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  unsigned int delta = 0;
-  if (world.rank() == 0) {
-    delta = std::min(taskData->inputs_count[1], taskData->inputs_count[2]) / world.size();
-  }
-  broadcast(world, delta, 0);
-
-  if (world.rank() == 0) {
-    // init vectors
-    input_ = std::vector<std::vector<char>>(taskData->inputs_count[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      auto* tmp_ptr = reinterpret_cast<char*>(taskData->inputs[i]);
-      input_[i] = std::vector<char>(taskData->inputs_count[i + 1]);
-      for (unsigned j = 0; j < taskData->inputs_count[i + 1]; j++) {
-        input_[i][j] = tmp_ptr[j];
-      }
-    }
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_[0].data() + delta * proc, delta);
-      world.send(proc, 1, input_[1].data() + delta * proc, delta);
-    }
-  }
-  local_input_1_ = std::vector<char>(delta);
-  local_input_2_ = std::vector<char>(delta);
+  // The root compares a prefix first, and most pairs of strings are decided there. Only strings equal in it are
+  // cut into slices aligned to 64 bytes, and the first difference is the smallest offset found in any slice.
+  constexpr uint64_t kPrefix = 4096;
+  uint64_t header[2] = {0, 0};  // common length, first difference within the prefix
   if (world.rank() == 0) {
-    local_input_1_ = std::vector<char>(input_[0].begin(), input_[0].begin() + delta);
-    local_input_2_ = std::vector<char>(input_[1].begin(), input_[1].begin() + delta);
-  } else {
-    world.recv(0, 0, local_input_1_.data(), delta);
-    world.recv(0, 1, local_input_2_.data(), delta);
+    header[0] = std::min(input_[0].size(), input_[1].size());
+    header[1] = ppc::util::first_mismatch(input_[0].data(), input_[1].data(), std::min(header[0], kPrefix));
   }
-  // Init value for output
-  res_ = 0;
-
-  // Transfer data to processes
-  int local_res = 0;
-  for (size_t i = 0; i < local_input_1_.size(); i++) {
-    if (local_input_1_[i] < local_input_2_[i]) {
-      local_res = 1;
-      break;
+  boost::mpi::broadcast(world, header, 2, 0);
+  const uint64_t len = header[0];
+  uint64_t first = header[1];
+  if (first == std::min(len, kPrefix) && first < len) {
+    const uint64_t rest = len - first;
+    auto cut = [&](int proc) { return proc == world.size() ? len : first + rest * proc / world.size() / 64 * 64; };
+    std::vector<int> sizes(world.size());
+    std::vector<int> displs(world.size());
+    for (int proc = 0; proc < world.size(); proc++) {
+      displs[proc] = static_cast<int>(cut(proc));
+      sizes[proc] = static_cast<int>(cut(proc + 1) - cut(proc));
     }
-    if (local_input_1_[i] > local_input_2_[i]) {
-      local_res = 2;
-      break;
+    const int local_size = sizes[world.rank()];
+    local_input_1_.resize(local_size);
+    local_input_2_.resize(local_size);
+    if (world.rank() == 0) {
+      boost::mpi::scatterv(world, input_[0].data(), sizes, displs, local_input_1_.data(), local_size, 0);
+      boost::mpi::scatterv(world, input_[1].data(), sizes, displs, local_input_2_.data(), local_size, 0);
+    } else {
+      boost::mpi::scatterv(world, local_input_1_.data(), local_size, 0);
+      boost::mpi::scatterv(world, local_input_2_.data(), local_size, 0);
     }
+    const size_t local_first = ppc::util::first_mismatch(local_input_1_.data(), local_input_2_.data(), local_size);
+    const uint64_t local_offset = local_first < local_input_1_.size() ? displs[world.rank()] + local_first : len;
+    boost::mpi::reduce(world, local_offset, first, boost::mpi::minimum<uint64_t>(), 0);
   }
 
-  std::vector<int> gathered_data;
-  boost::mpi::gather(world, local_res, gathered_data, 0);
-
   if (world.rank() == 0) {
-    for (int proc = 0; proc < world.size(); proc++) {
-      if (gathered_data[proc] != 0) {
-        res_ = gathered_data[proc];
-        break;
-      }
-    }
-    if (res_ == 0 && input_[0].size() != input_[1].size()) {
-      if (input_[0].size() > input_[1].size()) {
-        res_ = 2;
-      } else {
-        res_ = 1;
-      }
+    res_ = 0;
+    if (first < len) {
+      res_ = input_[0][first] < input_[1][first] ? 1 : 2;
+    } else if (input_[0].size() != input_[1].size()) {
+      res_ = input_[0].size() > input_[1].size() ? 2 : 1;
     }
   }
   return true;
@@ -568,4 +568,35 @@ TEST(ivanov_m_integration_trapezoid_mpi_func_test, cosinus_result_less_than_zero
     testMpiTaskSequential.post_processing();
   }
   ASSERT_NEAR(reference_result[0], global_result[0], 1e-3);
-}
\ No newline at end of file
+}
+
+TEST(ivanov_m_integration_trapezoid_mpi_func_test, romberg_reaches_tolerance) {
+  boost::mpi::communicator world;
+  double a = 0;
+  double b = 3;
+  int n = 1 << 20;
+
+  std::vector<double> global_vec = {a, b, static_cast<double>(n)};
+  std::vector<double> global_result(1, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(global_vec.data()));
+    taskDataPar->inputs_count.emplace_back(global_vec.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  ivanov_m_integration_trapezoid_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+  testMpiTaskParallel.add_function([](double x) { return std::exp(x); });
+  testMpiTaskParallel.set_tolerance(1e-10);
+
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+
+  if (world.rank() == 0) {
+    ASSERT_NEAR(std::exp(3.0) - 1.0, global_result[0], 1e-9);
+  }
+}
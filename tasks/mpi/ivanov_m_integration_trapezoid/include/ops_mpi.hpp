@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 
 namespace ivanov_m_integration_trapezoid_mpi {
 
@@ -19,13 +20,20 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
-  void add_function(const ::std::function<double(double)>& f);
+  template <ppc::util::ScalarIntegrand F>
+  void add_function(F f) {
+    f_ = ppc::util::make_batch_integrand(std::move(f));
+  }
+
+  // Romberg refinement to epsilon instead of a single pass; n becomes the cap on the number of subintervals
+  void set_tolerance(double epsilon) { epsilon_ = epsilon; }
 
  private:
   double a_{}, b_{};
   int n_{};
   double result_{};
-  std::function<double(double)> f_;
+  double epsilon_{};
+  ppc::util::BatchIntegrand f_;
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -36,13 +44,20 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
-  void add_function(const ::std::function<double(double)>& f);
+  template <ppc::util::ScalarIntegrand F>
+  void add_function(F f) {
+    f_ = ppc::util::make_batch_integrand(std::move(f));
+  }
+
+  // Romberg refinement to epsilon instead of a single pass; n becomes the cap on the number of subintervals
+  void set_tolerance(double epsilon) { epsilon_ = epsilon; }
 
  private:
   double a_{}, b_{}, result_{};
   int n_{};
-  std::function<double(double)> f_;
+  double epsilon_{};
+  ppc::util::BatchIntegrand f_;
   boost::mpi::communicator world;
 };
 
-}  // namespace ivanov_m_integration_trapezoid_mpi
\ No newline at end of file
+}  // namespace ivanov_m_integration_trapezoid_mpi
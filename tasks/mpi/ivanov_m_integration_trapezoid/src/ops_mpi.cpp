@@ -14,16 +14,21 @@ bool ivanov_m_integration_trapezoid_mpi::TestMPITaskSequential::pre_processing()
 
 bool ivanov_m_integration_trapezoid_mpi::TestMPITaskSequential::validation() {
   internal_order_test();
-  // Check count elements of output
-  return taskData->outputs_count[0] == 1;
+  // Check count elements of output and the number of intervals
+  return taskData->outputs_count[0] == 1 && static_cast<int>(reinterpret_cast<double*>(taskData->inputs[0])[2]) > 0;
 }
 
 bool ivanov_m_integration_trapezoid_mpi::TestMPITaskSequential::run() {
   internal_order_test();
   if (a_ == b_) return true;
-  double step_ = (b_ - a_) / n_;
-  for (int i = 0; i < n_; i++) result_ += (f_(a_ + i * step_) + f_(a_ + (i + 1) * step_));
-  result_ = result_ / 2 * step_;
+  if (epsilon_ > 0) {
+    ppc::util::RombergOptions options;
+    options.epsilon = epsilon_;
+    options.max_intervals = static_cast<size_t>(n_);
+    result_ = ppc::util::romberg(f_, a_, b_, options).value;
+    return true;
+  }
+  result_ = ppc::util::composite_quadrature(f_, a_, b_, static_cast<size_t>(n_), ppc::util::QuadratureRule::kTrapezoid);
   return true;
 }
 
@@ -33,15 +38,11 @@ bool ivanov_m_integration_trapezoid_mpi::TestMPITaskSequential::post_processing(
   return true;
 }
 
-void ivanov_m_integration_trapezoid_mpi::TestMPITaskSequential::add_function(const std::function<double(double)>& f) {
-  f_ = f;
-}
-
 bool ivanov_m_integration_trapezoid_mpi::TestMPITaskParallel::validation() {
   internal_order_test();
   if (world.rank() == 0) {
-    // Check count elements of output
-    return taskData->outputs_count[0] == 1;
+    // Check count elements of output and the number of intervals
+    return taskData->outputs_count[0] == 1 && static_cast<int>(reinterpret_cast<double*>(taskData->inputs[0])[2]) > 0;
   }
   return true;
 }
@@ -62,22 +63,31 @@ bool ivanov_m_integration_trapezoid_mpi::TestMPITaskParallel::run() {
   internal_order_test();
   int rank = world.rank();
   int size = world.size();
-  double step;
-  double local_result = 0.0;
-  if (rank == 0) {
-    step = (b_ - a_) / n_;
-  }
   broadcast(world, a_, 0);
   broadcast(world, b_, 0);
   broadcast(world, n_, 0);
-  broadcast(world, step, 0);
 
   if (a_ == b_) return true;
 
-  for (int i = rank; i < n_; i += size) local_result += (f_(a_ + i * step) + f_(a_ + (i + 1) * step));
-  reduce(world, local_result, result_, std::plus<>(), 0);
+  if (epsilon_ > 0) {
+    // Every level's new midpoints are dealt out block-cyclically, so the ranks stay balanced as h halves
+    ppc::util::RombergOptions options;
+    options.epsilon = epsilon_;
+    options.max_intervals = static_cast<size_t>(n_);
+    auto sum = [&](std::vector<double>& sums) {
+      double total = 0.0;
+      all_reduce(world, sums[0], total, std::plus<>());
+      sums[0] = total;
+    };
+    result_ = ppc::util::romberg(f_, a_, b_, options, rank, size, sum).value;
+    return true;
+  }
 
-  if (rank == 0) result_ = result_ / 2 * step;
+  // Each rank takes a contiguous block of the subintervals
+  auto n = static_cast<size_t>(n_);
+  double local_result = ppc::util::composite_quadrature(f_, a_, b_, n, ppc::util::QuadratureRule::kTrapezoid,
+                                                        n * rank / size, n * (rank + 1) / size);
+  reduce(world, local_result, result_, std::plus<>(), 0);
 
   return true;
 }
@@ -89,7 +99,3 @@ bool ivanov_m_integration_trapezoid_mpi::TestMPITaskParallel::post_processing()
   }
   return true;
 }
-
-void ivanov_m_integration_trapezoid_mpi::TestMPITaskParallel::add_function(const std::function<double(double)>& f) {
-  f_ = f;
-}
\ No newline at end of file
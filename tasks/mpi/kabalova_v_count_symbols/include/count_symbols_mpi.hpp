@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace kabalova_v_count_symbols_mpi {
 
@@ -30,6 +31,7 @@ class TestMPITaskSequential : public ppc::core::Task {
  private:
   std::string input_{};
   int result{};
+  ppc::util::ByteHistogram histogram_;
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -43,6 +45,7 @@ class TestMPITaskParallel : public ppc::core::Task {
  private:
   std::string input_{}, local_input_{};
   int result{};
+  ppc::util::ByteHistogram histogram_;
   boost::mpi::communicator world;
 };
 
@@ -27,13 +27,8 @@ std::string kabalova_v_count_symbols_mpi::getRandomString() {
 }
 
 int kabalova_v_count_symbols_mpi::countSymbols(std::string& str) {
-  int result = 0;
-  for (size_t i = 0; i < str.size(); i++) {
-    if (isalpha(str[i]) != 0) {
-      result++;
-    }
-  }
-  return result;
+  const ppc::util::ByteHistogram histogram(str.data(), str.size());
+  return static_cast<int>(histogram.count(ppc::util::ByteClass::ascii_alpha()));
 }
 
 bool kabalova_v_count_symbols_mpi::TestMPITaskSequential::pre_processing() {
@@ -58,7 +53,9 @@ bool kabalova_v_count_symbols_mpi::TestMPITaskSequential::validation() {
 
 bool kabalova_v_count_symbols_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  result = countSymbols(input_);
+  // Letters are read from the histogram, which answers any other character class without a rescan
+  histogram_ = ppc::util::ByteHistogram(input_.data(), input_.size());
+  result = static_cast<int>(histogram_.count(ppc::util::ByteClass::ascii_alpha()));
   return true;
 }
 
@@ -125,11 +122,11 @@ bool kabalova_v_count_symbols_mpi::TestMPITaskParallel::validation() {
 
 bool kabalova_v_count_symbols_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  int local_result = 0;
-  // Count symbols in every substring
-  local_result = countSymbols(local_input_);
-  // Get sum and send it into result
-  reduce(world, local_result, result, std::plus(), 0);
+  // Histogram of every substring; their sum, reduced as 256 bins, is the histogram of the whole string
+  const ppc::util::ByteHistogram local_histogram(local_input_.data(), local_input_.size());
+  reduce(world, local_histogram.data(), static_cast<int>(ppc::util::ByteHistogram::kBins), histogram_.data(),
+         std::plus<uint64_t>(), 0);
+  result = static_cast<int>(histogram_.count(ppc::util::ByteClass::ascii_alpha()));
   return true;
 }
 
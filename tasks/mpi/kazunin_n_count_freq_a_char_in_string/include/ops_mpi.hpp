@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace kazunin_n_count_freq_a_char_in_string_mpi {
 class CharFreqCounterMPISequential : public ppc::core::Task {
@@ -27,6 +28,7 @@ class CharFreqCounterMPISequential : public ppc::core::Task {
   size_t count_result_{0};
   char character_to_count_{};
   std::vector<char> input_string_;
+  ppc::util::ByteHistogram histogram_;
 };
 
 class CharFreqCounterMPIParallel : public ppc::core::Task {
@@ -40,10 +42,10 @@ class CharFreqCounterMPIParallel : public ppc::core::Task {
 
  private:
   size_t total_count_{0};
-  size_t local_count_{0};
   char character_to_count_{};
   std::vector<char> input_string_;
   std::vector<char> local_segment_;
+  ppc::util::ByteHistogram histogram_;
   boost::mpi::communicator global;
 };
 }  // namespace kazunin_n_count_freq_a_char_in_string_mpi
\ No newline at end of file
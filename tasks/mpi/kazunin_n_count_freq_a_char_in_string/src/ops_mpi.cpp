@@ -21,7 +21,8 @@ bool kazunin_n_count_freq_a_char_in_string_mpi::CharFreqCounterMPISequential::va
 
 bool kazunin_n_count_freq_a_char_in_string_mpi::CharFreqCounterMPISequential::run() {
   internal_order_test();
-  count_result_ = std::count(input_string_.begin(), input_string_.end(), character_to_count_);
+  histogram_ = ppc::util::ByteHistogram(input_string_.data(), input_string_.size());
+  count_result_ = histogram_.count(character_to_count_);
   return true;
 }
 
@@ -83,9 +84,11 @@ bool kazunin_n_count_freq_a_char_in_string_mpi::CharFreqCounterMPIParallel::run(
                          send_counts[my_rank], 0);
   }
 
-  local_count_ = std::count(local_segment_.begin(), local_segment_.end(), character_to_count_);
-
-  boost::mpi::reduce(global, local_count_, total_count_, std::plus<>(), 0);
+  // The local histograms add up to that of the whole string: one reduce of all 256 bins
+  const ppc::util::ByteHistogram local_histogram(local_segment_.data(), local_segment_.size());
+  boost::mpi::reduce(global, local_histogram.data(), static_cast<int>(ppc::util::ByteHistogram::kBins),
+                     histogram_.data(), std::plus<uint64_t>(), 0);
+  total_count_ = histogram_.count(character_to_count_);
   return true;
 }
 
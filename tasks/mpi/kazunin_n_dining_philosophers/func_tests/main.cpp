@@ -48,6 +48,39 @@ void start_test(int eat_limit = 3, int min_think_time = 2, int max_think_time =
   world.barrier();
 }
 
+void protocol_test(int protocol, int eat_limit = 4, int min_think_time = 1, int max_think_time = 3,
+                   int min_eat_time = 1, int max_eat_time = 3) {
+  boost::mpi::communicator world;
+  if (world.size() < 4) {
+    GTEST_SKIP();
+  }
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  for (int* input : {&eat_limit, &min_think_time, &max_think_time, &min_eat_time, &max_eat_time, &protocol}) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(input));
+    taskDataPar->inputs_count.emplace_back(1);
+  }
+  ppc::util::ContentionReport report;
+  taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(&report));
+  taskDataPar->outputs_count.emplace_back(1);
+
+  auto taskParallel = std::make_shared<kazunin_n_dining_philosophers_mpi::DiningPhilosophersParallelMPI>(taskDataPar);
+  ASSERT_TRUE(taskParallel->validation());
+  taskParallel->pre_processing();
+  taskParallel->run();
+  taskParallel->post_processing();
+
+  if (world.rank() == 0) {
+    // Every philosopher ate every meal, and waited once for each
+    int philosophers = world.size() / 2;
+    ASSERT_EQ(report.served.size(), static_cast<size_t>(philosophers));
+    EXPECT_EQ(report.total_served(), static_cast<uint64_t>(philosophers * eat_limit));
+    EXPECT_EQ(report.starved(), 0u);
+    EXPECT_DOUBLE_EQ(report.fairness(), 1);
+    EXPECT_EQ(report.all_waits().count(), static_cast<uint64_t>(philosophers * eat_limit));
+    EXPECT_GT(report.throughput(), 0);
+  }
+}
+
 }  // namespace kazunin_n_dining_philosophers_mpi
 
 TEST(kazunin_n_dining_philosophers_mpi, defailt) { kazunin_n_dining_philosophers_mpi::start_test(); }
@@ -101,3 +134,36 @@ TEST(kazunin_n_dining_philosophers_mpi, simulation_5_eat_limit) { kazunin_n_dini
 TEST(kazunin_n_dining_philosophers_mpi, simulation_15_eat_limit) {
   kazunin_n_dining_philosophers_mpi::start_test(15, 1, 2, 1, 2);
 }
+
+TEST(kazunin_n_dining_philosophers_mpi, fork_managers_report) {
+  kazunin_n_dining_philosophers_mpi::protocol_test(kazunin_n_dining_philosophers_mpi::FORK_MANAGERS);
+}
+
+TEST(kazunin_n_dining_philosophers_mpi, resource_hierarchy_report) {
+  kazunin_n_dining_philosophers_mpi::protocol_test(kazunin_n_dining_philosophers_mpi::RESOURCE_HIERARCHY);
+}
+
+TEST(kazunin_n_dining_philosophers_mpi, chandy_misra_report) {
+  kazunin_n_dining_philosophers_mpi::protocol_test(kazunin_n_dining_philosophers_mpi::CHANDY_MISRA);
+}
+
+TEST(kazunin_n_dining_philosophers_mpi, chandy_misra_eat_heavy) {
+  kazunin_n_dining_philosophers_mpi::protocol_test(kazunin_n_dining_philosophers_mpi::CHANDY_MISRA, 10, 1, 2, 3, 6);
+}
+
+TEST(kazunin_n_dining_philosophers_mpi, validation_test_unknown_protocol) {
+  boost::mpi::communicator world;
+  int eat_limit = 3;
+  int min_think_time = 2;
+  int max_think_time = 5;
+  int min_eat_time = 2;
+  int max_eat_time = 5;
+  int protocol = 3;
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  for (int* input : {&eat_limit, &min_think_time, &max_think_time, &min_eat_time, &max_eat_time, &protocol}) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(input));
+    taskDataPar->inputs_count.emplace_back(1);
+  }
+  kazunin_n_dining_philosophers_mpi::DiningPhilosophersParallelMPI taskParallel(taskDataPar);
+  EXPECT_FALSE(taskParallel.validation());
+}
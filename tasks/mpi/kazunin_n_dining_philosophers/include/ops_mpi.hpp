@@ -4,23 +4,42 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <queue>
 
 #include "core/task/include/task.hpp"
+#include "util/contention/include/contention.hpp"
 
 namespace kazunin_n_dining_philosophers_mpi {
 
-enum MessageTag : std::uint8_t { REQUEST_FORK = 1, RELEASE_FORK = 2, FORK_GRANTED = 3, TERMINATE_FORK = 4 };
+enum MessageTag : std::uint8_t {
+  REQUEST_FORK = 1,
+  RELEASE_FORK = 2,
+  FORK_GRANTED = 3,
+  TERMINATE_FORK = 4,
+  PASS_FORK = 5,
+  ASK_FORK = 6,
+  DONE_EATING = 7
+};
+
+// How the philosophers get their forks. With a manager rank per fork, either even philosophers take the left fork
+// first and odd ones the right, or everyone takes the lower-numbered fork first (resource hierarchy). Without
+// managers, neighbours pass the forks between them as in Chandy and Misra's solution.
+enum Protocol : std::uint8_t { FORK_MANAGERS = 0, RESOURCE_HIERARCHY = 1, CHANDY_MISRA = 2 };
 
-inline void request_forks(int id, int left_fork, int right_fork, int N, boost::mpi::communicator& world);
-inline void release_forks(int id, int left_fork, int right_fork, int N, boost::mpi::communicator& world);
+inline void request_forks(int id, int first_fork, int second_fork, int N, boost::mpi::communicator& world);
+inline void release_forks(int id, int first_fork, int second_fork, int N, boost::mpi::communicator& world);
 inline void handle_fork_request(int& philosopher_id, bool& fork_available, std::queue<int>& waiting_queue,
                                 boost::mpi::communicator& world, int id);
 inline void handle_fork_release(int& philosopher_id, bool& fork_available, std::queue<int>& waiting_queue,
                                 boost::mpi::communicator& world, int id);
 inline bool fork_manager(int id, boost::mpi::communicator& world);
 inline bool philosopher(int id, int N, boost::mpi::communicator& world, boost::mpi::communicator& philosophers_comm,
-                        int eat_limit, int min_think_time, int max_think_time, int min_eat_time, int max_eat_time);
+                        int eat_limit, int min_think_time, int max_think_time, int min_eat_time, int max_eat_time,
+                        Protocol protocol, ppc::util::WaitHistogram& waits);
+inline bool chandy_misra_philosopher(int id, int N, boost::mpi::communicator& world, int eat_limit,
+                                     int min_think_time, int max_think_time, int min_eat_time, int max_eat_time,
+                                     ppc::util::WaitHistogram& waits);
 
 class DiningPhilosophersParallelMPI : public ppc::core::Task {
  public:
@@ -38,6 +57,12 @@ class DiningPhilosophersParallelMPI : public ppc::core::Task {
   int max_eat_time;
   int N;
   int color;
+  // Optional sixth input; an optional output receives a ppc::util::ContentionReport on rank 0, with a wait for
+  // every meal (from hungry to holding both forks)
+  Protocol protocol = FORK_MANAGERS;
+  ppc::util::WaitHistogram waits;
+  uint64_t meals = 0;
+  double seconds = 0;
   boost::mpi::communicator local_comm;
   boost::mpi::communicator world;
 };
@@ -3,6 +3,7 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
 #include <boost/mpi/timer.hpp>
+#include <iostream>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
@@ -126,3 +127,58 @@ TEST(kazunin_n_dining_philosophers_mpi, task_run) {
     EXPECT_FALSE(taskParallel->validation());
   }
 }
+
+// The protocols side by side, with long thinks (little contention) and long meals (much contention)
+TEST(kazunin_n_dining_philosophers_mpi, protocols_under_contention) {
+  boost::mpi::communicator world;
+  if (world.size() < 4) {
+    GTEST_SKIP();
+  }
+
+  const char* names[] = {"fork managers", "resource hierarchy", "chandy-misra"};
+  struct Mix {
+    const char* name;
+    int think[2];
+    int eat[2];
+  };
+  const Mix mixes[] = {{"think-heavy", {10, 20}, {1, 3}}, {"eat-heavy", {1, 3}, {10, 20}}};
+  for (const auto& mix : mixes) {
+    for (int protocol = kazunin_n_dining_philosophers_mpi::FORK_MANAGERS;
+         protocol <= kazunin_n_dining_philosophers_mpi::CHANDY_MISRA; protocol++) {
+      int eat_limit = 10;
+      int inputs[] = {eat_limit, mix.think[0], mix.think[1], mix.eat[0], mix.eat[1], protocol};
+      std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+      for (int& input : inputs) {
+        taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&input));
+        taskDataPar->inputs_count.emplace_back(1);
+      }
+      ppc::util::ContentionReport report;
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(&report));
+      taskDataPar->outputs_count.emplace_back(1);
+
+      auto taskParallel =
+          std::make_shared<kazunin_n_dining_philosophers_mpi::DiningPhilosophersParallelMPI>(taskDataPar);
+      ASSERT_TRUE(taskParallel->validation());
+      taskParallel->pre_processing();
+      taskParallel->run();
+      taskParallel->post_processing();
+
+      auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+      perfAttr->num_running = 1;
+      const boost::mpi::timer current_timer;
+      perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+      auto perfResults = std::make_shared<ppc::core::PerfResults>();
+      auto perfAnalyzer = std::make_shared<ppc::core::Perf>(taskParallel);
+      perfAnalyzer->task_run(perfAttr, perfResults);
+
+      if (world.rank() == 0) {
+        ppc::core::Perf::print_perf_statistic(perfResults);
+        auto all = report.all_waits();
+        std::cout << mix.name << ", " << names[protocol] << ": " << report.throughput() << " meals/s, wait p50 "
+                  << all.quantile(0.5) * 1e3 << " ms, p99 " << all.quantile(0.99) * 1e3 << " ms, max "
+                  << report.max_wait() * 1e3 << " ms, fairness " << report.fairness() << std::endl;
+        EXPECT_EQ(report.starved(), 0u);
+      }
+    }
+  }
+}
@@ -6,30 +6,40 @@
 #include <queue>
 #include <random>
 #include <thread>
+#include <vector>
 
 namespace kazunin_n_dining_philosophers_mpi {
 
 inline bool philosopher(int id, int N, boost::mpi::communicator& world, boost::mpi::communicator& philosophers_comm,
-                        int eat_limit, int min_think_time, int max_think_time, int min_eat_time, int max_eat_time) {
+                        int eat_limit, int min_think_time, int max_think_time, int min_eat_time, int max_eat_time,
+                        Protocol protocol, ppc::util::WaitHistogram& waits) {
   std::mt19937 rng(id + std::chrono::system_clock::now().time_since_epoch().count());
   std::uniform_int_distribution<int> think_dist(min_think_time, max_think_time);
   std::uniform_int_distribution<int> eat_dist(min_eat_time, max_eat_time);
 
   int left_fork = id;
   int right_fork = (id + 1) % N;
+  bool left_first = id % 2 == 0;
+  if (protocol == RESOURCE_HIERARCHY) {
+    left_first = left_fork < right_fork;
+  }
+  int first_fork = left_first ? left_fork : right_fork;
+  int second_fork = left_first ? right_fork : left_fork;
   int eat_count = 0;
 
   while (eat_count < eat_limit) {
     int think_time = think_dist(rng);
     std::this_thread::sleep_for(std::chrono::milliseconds(think_time));
 
-    request_forks(id, left_fork, right_fork, N, world);
+    auto hungry_since = std::chrono::steady_clock::now();
+    request_forks(id, first_fork, second_fork, N, world);
+    waits.add(std::chrono::duration<double>(std::chrono::steady_clock::now() - hungry_since).count());
 
     int eat_time = eat_dist(rng);
     std::this_thread::sleep_for(std::chrono::milliseconds(eat_time));
     eat_count++;
 
-    release_forks(id, left_fork, right_fork, N, world);
+    release_forks(id, first_fork, second_fork, N, world);
   }
 
   philosophers_comm.barrier();
@@ -40,6 +50,104 @@ inline bool philosopher(int id, int N, boost::mpi::communicator& world, boost::m
   return true;
 }
 
+// Every fork is held by one of its two philosophers, and dirty once eaten with. Asked for a dirty fork, a
+// philosopher cleans it and passes it on, unless it is eating; a clean fork stays until its holder has eaten. A
+// philosopher asks for a fork it lacks with the request token, which is always on the other side of the fork.
+// Initially the lower-numbered philosopher of each pair holds the fork, dirty, so nobody waits in a cycle.
+inline bool chandy_misra_philosopher(int id, int N, boost::mpi::communicator& world, int eat_limit,
+                                     int min_think_time, int max_think_time, int min_eat_time, int max_eat_time,
+                                     ppc::util::WaitHistogram& waits) {
+  std::mt19937 rng(id + std::chrono::system_clock::now().time_since_epoch().count());
+  std::uniform_int_distribution<int> think_dist(min_think_time, max_think_time);
+  std::uniform_int_distribution<int> eat_dist(min_eat_time, max_eat_time);
+
+  // Index 0 is the left side, 1 the right side
+  const int forks[2] = {id, (id + 1) % N};
+  const int neighbours[2] = {(id + N - 1) % N, (id + 1) % N};
+  bool have[2];
+  bool dirty[2] = {true, true};
+  bool token[2];
+  for (int side = 0; side < 2; side++) {
+    have[side] = id < neighbours[side];
+    token[side] = !have[side];
+  }
+  bool hungry = false;
+  int neighbours_done = 0;
+
+  auto handle_message = [&]() {
+    int fork;
+    boost::mpi::status s = world.recv(boost::mpi::any_source, boost::mpi::any_tag, fork);
+    if (s.tag() == DONE_EATING) {
+      neighbours_done++;
+      return;
+    }
+    int side = fork == forks[0] ? 0 : 1;
+    if (s.tag() == PASS_FORK) {
+      have[side] = true;
+      dirty[side] = false;
+      return;
+    }
+    token[side] = true;
+    if (have[side] && dirty[side]) {
+      world.send(neighbours[side], PASS_FORK, fork);
+      have[side] = false;
+      if (hungry) {
+        world.send(neighbours[side], ASK_FORK, fork);
+        token[side] = false;
+      }
+    }
+  };
+
+  int eat_count = 0;
+  while (eat_count < eat_limit) {
+    // Thinking philosophers still give their forks away
+    auto think_until = std::chrono::steady_clock::now() + std::chrono::milliseconds(think_dist(rng));
+    while (std::chrono::steady_clock::now() < think_until) {
+      if (world.iprobe(boost::mpi::any_source, boost::mpi::any_tag)) {
+        handle_message();
+      } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+    }
+
+    auto hungry_since = std::chrono::steady_clock::now();
+    hungry = true;
+    for (int side = 0; side < 2; side++) {
+      if (!have[side] && token[side]) {
+        world.send(neighbours[side], ASK_FORK, forks[side]);
+        token[side] = false;
+      }
+    }
+    while (!have[0] || !have[1]) {
+      handle_message();
+    }
+    waits.add(std::chrono::duration<double>(std::chrono::steady_clock::now() - hungry_since).count());
+    hungry = false;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(eat_dist(rng)));
+    eat_count++;
+
+    // Requests that came while hungry or eating
+    for (int side = 0; side < 2; side++) {
+      dirty[side] = true;
+      if (token[side]) {
+        world.send(neighbours[side], PASS_FORK, forks[side]);
+        have[side] = false;
+      }
+    }
+  }
+
+  // Serve the neighbours until they have eaten too: their requests come before their DONE_EATING
+  for (int neighbour : neighbours) {
+    world.send(neighbour, DONE_EATING, id);
+  }
+  while (neighbours_done < 2) {
+    handle_message();
+  }
+
+  return true;
+}
+
 inline bool fork_manager(int id, boost::mpi::communicator& world) {
   bool fork_available = true;
   bool terminate = false;
@@ -62,34 +170,19 @@ inline bool fork_manager(int id, boost::mpi::communicator& world) {
   return true;
 }
 
-inline void request_forks(int id, int left_fork, int right_fork, int N, boost::mpi::communicator& world) {
-  if (id % 2 == 0) {
-    world.isend(N + left_fork, REQUEST_FORK, id);
-    int left_reply;
-    world.recv(N + left_fork, FORK_GRANTED, left_reply);
-
-    world.isend(N + right_fork, REQUEST_FORK, id);
-    int right_reply;
-    world.recv(N + right_fork, FORK_GRANTED, right_reply);
-  } else {
-    world.isend(N + right_fork, REQUEST_FORK, id);
-    int right_reply;
-    world.recv(N + right_fork, FORK_GRANTED, right_reply);
+inline void request_forks(int id, int first_fork, int second_fork, int N, boost::mpi::communicator& world) {
+  world.isend(N + first_fork, REQUEST_FORK, id);
+  int first_reply;
+  world.recv(N + first_fork, FORK_GRANTED, first_reply);
 
-    world.isend(N + left_fork, REQUEST_FORK, id);
-    int left_reply;
-    world.recv(N + left_fork, FORK_GRANTED, left_reply);
-  }
+  world.isend(N + second_fork, REQUEST_FORK, id);
+  int second_reply;
+  world.recv(N + second_fork, FORK_GRANTED, second_reply);
 }
 
-inline void release_forks(int id, int left_fork, int right_fork, int N, boost::mpi::communicator& world) {
-  if (id % 2 == 0) {
-    world.isend(N + left_fork, RELEASE_FORK, id);
-    world.isend(N + right_fork, RELEASE_FORK, id);
-  } else {
-    world.isend(N + right_fork, RELEASE_FORK, id);
-    world.isend(N + left_fork, RELEASE_FORK, id);
-  }
+inline void release_forks(int id, int first_fork, int second_fork, int N, boost::mpi::communicator& world) {
+  world.isend(N + first_fork, RELEASE_FORK, id);
+  world.isend(N + second_fork, RELEASE_FORK, id);
 }
 
 inline void handle_fork_request(int& philosopher_id, bool& fork_available, std::queue<int>& waiting_queue,
@@ -126,8 +219,13 @@ bool kazunin_n_dining_philosophers_mpi::DiningPhilosophersParallelMPI::validatio
   int val_min_eat_time = *reinterpret_cast<int*>(taskData->inputs[3]);
   int val_max_eat_time = *reinterpret_cast<int*>(taskData->inputs[4]);
 
+  bool val_protocol = taskData->inputs.size() == 5 ||
+                      (taskData->inputs.size() == 6 && *reinterpret_cast<int*>(taskData->inputs[5]) >= FORK_MANAGERS &&
+                       *reinterpret_cast<int*>(taskData->inputs[5]) <= CHANDY_MISRA);
+
   return val_eat_limit > 0 && val_min_think_time < val_max_think_time && val_min_eat_time < val_max_eat_time &&
-         val_max_think_time < 100 && val_min_think_time > 0 && val_max_eat_time < 100 && val_min_eat_time > 0;
+         val_max_think_time < 100 && val_min_think_time > 0 && val_max_eat_time < 100 && val_min_eat_time > 0 &&
+         val_protocol;
 }
 
 bool kazunin_n_dining_philosophers_mpi::DiningPhilosophersParallelMPI::pre_processing() {
@@ -138,9 +236,16 @@ bool kazunin_n_dining_philosophers_mpi::DiningPhilosophersParallelMPI::pre_proce
   max_think_time = *reinterpret_cast<int*>(taskData->inputs[2]);
   min_eat_time = *reinterpret_cast<int*>(taskData->inputs[3]);
   max_eat_time = *reinterpret_cast<int*>(taskData->inputs[4]);
+  if (taskData->inputs.size() == 6) {
+    protocol = static_cast<Protocol>(*reinterpret_cast<int*>(taskData->inputs[5]));
+  }
   N = world.size() / 2;
-  color = (world.rank() < N) ? 0 : 1;
+  // With an odd number of processes the last one has no fork to manage
+  color = (world.rank() < N) ? 0 : (world.rank() < 2 * N ? 1 : 2);
   local_comm = world.split(color);
+  waits = {};
+  meals = 0;
+  seconds = 0;
 
   return true;
 }
@@ -148,12 +253,22 @@ bool kazunin_n_dining_philosophers_mpi::DiningPhilosophersParallelMPI::pre_proce
 bool kazunin_n_dining_philosophers_mpi::DiningPhilosophersParallelMPI::run() {
   internal_order_test();
 
+  world.barrier();
+  auto start = std::chrono::steady_clock::now();
   if (color == 0) {
-    philosopher(world.rank(), N, world, local_comm, eat_limit, min_think_time, max_think_time, min_eat_time,
-                max_eat_time);
-  } else {
+    if (protocol == CHANDY_MISRA) {
+      chandy_misra_philosopher(world.rank(), N, world, eat_limit, min_think_time, max_think_time, min_eat_time,
+                               max_eat_time, waits);
+    } else {
+      philosopher(world.rank(), N, world, local_comm, eat_limit, min_think_time, max_think_time, min_eat_time,
+                  max_eat_time, protocol, waits);
+    }
+    meals += eat_limit;
+  } else if (color == 1 && protocol != CHANDY_MISRA) {
     fork_manager(world.rank() - N, world);
   }
+  world.barrier();
+  seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 
   return true;
 }
@@ -161,5 +276,16 @@ bool kazunin_n_dining_philosophers_mpi::DiningPhilosophersParallelMPI::run() {
 bool kazunin_n_dining_philosophers_mpi::DiningPhilosophersParallelMPI::post_processing() {
   internal_order_test();
 
+  std::vector<ppc::util::WaitHistogram> all_waits;
+  std::vector<uint64_t> all_meals;
+  boost::mpi::gather(world, waits, all_waits, 0);
+  boost::mpi::gather(world, meals, all_meals, 0);
+  if (world.rank() == 0 && !taskData->outputs.empty()) {
+    auto* report = reinterpret_cast<ppc::util::ContentionReport*>(taskData->outputs[0]);
+    report->seconds = seconds;
+    report->served.assign(all_meals.begin(), all_meals.begin() + N);
+    report->waits.assign(all_waits.begin(), all_waits.begin() + N);
+  }
+
   return true;
 }
@@ -8,6 +8,7 @@
 #include <string>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace kharin_m_number_of_sentences_mpi {
 
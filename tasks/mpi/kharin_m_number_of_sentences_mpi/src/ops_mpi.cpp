@@ -20,12 +20,8 @@ bool CountSentencesSequential::validation() {
 
 bool CountSentencesSequential::run() {
   internal_order_test();
-  for (size_t i = 0; i < text.size(); i++) {
-    char c = text[i];
-    if (c == '.' || c == '?' || c == '!') {
-      sentence_count++;
-    }
-  }
+  sentence_count =
+      static_cast<int>(ppc::util::count_class(text.data(), text.size(), ppc::util::ByteClass::sentence_end()));
   return true;
 }
 
@@ -74,13 +70,8 @@ bool CountSentencesParallel::run() {
        reinterpret_cast<const char*>(taskData->inputs[0]) + end, local_text.begin());
 
   // Подсчет предложений в локальной части
-  int local_count = 0;
-  for (size_t i = 0; i < local_text.size(); i++) {
-    char c = local_text[i];
-    if (c == '.' || c == '?' || c == '!') {
-      local_count++;
-    }
-  }
+  int local_count = static_cast<int>(
+      ppc::util::count_class(local_text.data(), local_text.size(), ppc::util::ByteClass::sentence_end()));
 
   // Суммирование результатов
   boost::mpi::reduce(world, local_count, sentence_count, std::plus<>(), 0);
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace kolodkin_g_sentence_count_mpi {
 
@@ -39,7 +40,6 @@ class TestMPITaskParallel : public ppc::core::Task {
  private:
   std::vector<char> input_, local_input_;
   int res{};
-  int localSentenceCount{};
   boost::mpi::communicator world;
 };
 
@@ -1,6 +1,7 @@
 #include "mpi/kolodkin_g_sentence_count/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <random>
 #include <string>
@@ -25,12 +26,8 @@ bool kolodkin_g_sentence_count_mpi::TestMPITaskSequential::validation() {
 
 bool kolodkin_g_sentence_count_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  for (unsigned long i = 0; i < input_.size(); i++) {
-    if ((input_[i] == '.' || input_[i] == '!' || input_[i] == '?') &&
-        ((input_[i + 1] != '.' && input_[i + 1] != '!' && input_[i + 1] != '?') || i + 1 == input_.size())) {
-      res++;
-    }
-  }
+  // "?!" or "..." ends one sentence: count runs of terminators, not terminators
+  res = static_cast<int>(ppc::util::count_runs(input_.data(), input_.size(), ppc::util::ByteClass::sentence_end()));
   return true;
 }
 
@@ -49,7 +46,6 @@ bool kolodkin_g_sentence_count_mpi::TestMPITaskParallel::pre_processing() {
       input_[i] = tmp_ptr[i];
     }
   }
-  localSentenceCount = 0;
   res = 0;
   return true;
 }
@@ -64,28 +60,29 @@ bool kolodkin_g_sentence_count_mpi::TestMPITaskParallel::validation() {
 
 bool kolodkin_g_sentence_count_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  unsigned int delta = 0;
+  unsigned int total = 0;
   if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] / world.size();
+    total = taskData->inputs_count[0];
+  }
+  broadcast(world, total, 0);
+  // Cut anywhere, remainder included: a "..." split between ranks is one run once the tallies are added
+  std::vector<int> sizes(world.size());
+  std::vector<int> displs(world.size());
+  for (int proc = 0; proc < world.size(); proc++) {
+    displs[proc] = static_cast<int>(static_cast<uint64_t>(total) * proc / world.size());
+    sizes[proc] = static_cast<int>(static_cast<uint64_t>(total) * (proc + 1) / world.size()) - displs[proc];
   }
-  broadcast(world, delta, 0);
-  local_input_.resize(delta);
+  local_input_.resize(sizes[world.rank()]);
   if (world.rank() == 0) {
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + proc * delta, delta);
-    }
-    local_input_ = std::vector<char>(input_.begin(), input_.begin() + delta);
+    scatterv(world, input_.data(), sizes, displs, local_input_.data(), sizes[0], 0);
   } else {
-    world.recv(0, 0, local_input_.data(), delta);
-  }
-  for (unsigned long i = 0; i < local_input_.size(); i++) {
-    if ((local_input_[i] == '.' || local_input_[i] == '!' || local_input_[i] == '?') &&
-        ((local_input_[i + 1] != '.' && local_input_[i + 1] != '!' && local_input_[i + 1] != '?') ||
-         i + 1 == local_input_.size())) {
-      localSentenceCount++;
-    }
+    scatterv(world, local_input_.data(), sizes[world.rank()], 0);
   }
-  reduce(world, localSentenceCount, res, std::plus<>(), 0);
+  auto local_tally =
+      ppc::util::tally_runs(local_input_.data(), local_input_.size(), ppc::util::ByteClass::sentence_end());
+  ppc::util::RunTally tally;
+  reduce(world, local_tally, tally, std::plus<>(), 0);
+  res = static_cast<int>(tally.count());
   return true;
 }
 
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/contrast/include/contrast.hpp"
 
 namespace kondratev_ya_contrast_adjustment_mpi {
 
@@ -38,6 +39,9 @@ struct Pixel {
 
 double getContrast(std::vector<kondratev_ya_contrast_adjustment_mpi::Pixel>& array);
 
+// One table per RGB channel applying the contrast around that channel's mean
+std::vector<ppc::util::ContrastLut> makeContrastLuts(const double (&average)[3], double contrast);
+
 class TestMPITaskSequential : public ppc::core::Task {
  public:
   explicit TestMPITaskSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
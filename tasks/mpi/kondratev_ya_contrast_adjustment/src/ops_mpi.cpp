@@ -1,6 +1,8 @@
 // Copyright 2023 Nesterov Alexander
 #include "mpi/kondratev_ya_contrast_adjustment/include/ops_mpi.hpp"
 
+static_assert(sizeof(kondratev_ya_contrast_adjustment_mpi::Pixel) == 3, "pixels are moved as interleaved RGB bytes");
+
 double kondratev_ya_contrast_adjustment_mpi::getContrast(
     std::vector<kondratev_ya_contrast_adjustment_mpi::Pixel>& array) {
   auto [min, max] = std::minmax_element(array.begin(), array.end(), [](auto a, auto b) { return a.red < b.red; });
@@ -8,6 +10,16 @@ double kondratev_ya_contrast_adjustment_mpi::getContrast(
   return (double)(max->red - min->red) / (max->red + min->red);
 }
 
+std::vector<ppc::util::ContrastLut> kondratev_ya_contrast_adjustment_mpi::makeContrastLuts(const double (&average)[3],
+                                                                                          double contrast) {
+  std::vector<ppc::util::ContrastLut> luts;
+  for (double channel_average : average) {
+    luts.push_back(ppc::util::make_lut(
+        [&](uint8_t v) { return (int32_t)(contrast * (v - channel_average) + channel_average); }));
+  }
+  return luts;
+}
+
 bool kondratev_ya_contrast_adjustment_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
 
@@ -30,21 +42,12 @@ bool kondratev_ya_contrast_adjustment_mpi::TestMPITaskSequential::validation() {
 bool kondratev_ya_contrast_adjustment_mpi::TestMPITaskSequential::run() {
   internal_order_test();
 
-  double average[3]{0, 0, 0};  // RGB
-
-  for (auto& pixel : input_) {
-    average[0] += pixel.red;
-    average[1] += pixel.green;
-    average[2] += pixel.blue;
-  }
-
-  for (uint32_t i = 0; i < 3; i++) average[i] /= input_.size();
-
-  for (uint32_t i = 0; i < input_.size(); i++) {
-    res_[i].red = std::clamp((int32_t)(contrast_ * (input_[i].red - average[0]) + average[0]), 0, 255);
-    res_[i].green = std::clamp((int32_t)(contrast_ * (input_[i].green - average[1]) + average[1]), 0, 255);
-    res_[i].blue = std::clamp((int32_t)(contrast_ * (input_[i].blue - average[2]) + average[2]), 0, 255);
-  }
+  // Channel means in one pass over planar channels, then a table per channel replaces the per-pixel arithmetic
+  ppc::util::PlanarImage image;
+  auto stats = image.load(reinterpret_cast<const uint8_t*>(input_.data()), input_.size(), 3);
+  double average[3];
+  for (uint32_t i = 0; i < 3; i++) average[i] = stats[i].mean();
+  image.apply(makeContrastLuts(average, contrast_), reinterpret_cast<uint8_t*>(res_.data()));
 
   return true;
 }
@@ -94,44 +97,42 @@ bool kondratev_ya_contrast_adjustment_mpi::TestMPITaskParallel::run() {
   broadcast(world, inputSize, 0);
   broadcast(world, contrast_, 0);
 
-  uint32_t step = inputSize / world.size();
-  uint32_t remain = inputSize % world.size();
-
-  std::vector<int> sizes;
-  uint32_t recvSize;
-  for (uint32_t i = 0; i < (uint32_t)world.size(); i++) {
-    recvSize = step;
-    if (i < remain) recvSize++;
-    sizes.push_back(recvSize);
+  // Pixels travel once each way as raw RGB bytes; only the three channel sums are reduced
+  std::vector<int> sizes(world.size());
+  std::vector<int> displs(world.size());
+  for (int i = 0; i < world.size(); i++) {
+    auto first = static_cast<int>(static_cast<uint64_t>(inputSize) * i / world.size());
+    auto last = static_cast<int>(static_cast<uint64_t>(inputSize) * (i + 1) / world.size());
+    sizes[i] = 3 * (last - first);
+    displs[i] = 3 * first;
   }
 
-  std::vector<kondratev_ya_contrast_adjustment_mpi::Pixel> local_input(sizes[world.rank()]);
-  std::vector<kondratev_ya_contrast_adjustment_mpi::Pixel> local_res(sizes[world.rank()]);
-  scatterv(world, input_, sizes, local_input.data(), 0);
-
-  std::vector<int> local_sum(3, 0);
-  std::vector<int> sum(3);
-
-  for (uint32_t i = 0; i < local_input.size(); i++) {
-    local_sum[0] += local_input[i].red;
-    local_sum[1] += local_input[i].green;
-    local_sum[2] += local_input[i].blue;
+  std::vector<uint8_t> local_input(sizes[world.rank()]);
+  std::vector<uint8_t> local_res(sizes[world.rank()]);
+  if (world.rank() == 0) {
+    boost::mpi::scatterv(world, reinterpret_cast<const uint8_t*>(input_.data()), sizes, displs, local_input.data(),
+                         sizes[0], 0);
+  } else {
+    boost::mpi::scatterv(world, local_input.data(), sizes[world.rank()], 0);
   }
 
-  all_reduce(world, local_sum.data(), local_sum.size(), sum.data(), std::plus());
+  ppc::util::PlanarImage image;
+  auto stats = image.load(local_input.data(), local_input.size() / 3, 3);
+  uint64_t local_sum[3]{stats[0].sum, stats[1].sum, stats[2].sum};
+  uint64_t sum[3];
+  boost::mpi::all_reduce(world, local_sum, 3, sum, std::plus());
 
-  std::vector<double> average(3);
-  auto size = static_cast<double>(step * world.size() + remain);
-  for (uint32_t i = 0; i < 3; i++) average[i] = sum[i] / size;
+  double average[3];
+  for (uint32_t i = 0; i < 3; i++) average[i] = static_cast<double>(sum[i]) / inputSize;
+  image.apply(makeContrastLuts(average, contrast_), local_res.data());
 
-  for (uint32_t i = 0; i < local_input.size(); i++) {
-    local_res[i].red = std::clamp((int32_t)(contrast_ * (local_input[i].red - average[0]) + average[0]), 0, 255);
-    local_res[i].green = std::clamp((int32_t)(contrast_ * (local_input[i].green - average[1]) + average[1]), 0, 255);
-    local_res[i].blue = std::clamp((int32_t)(contrast_ * (local_input[i].blue - average[2]) + average[2]), 0, 255);
+  if (world.rank() == 0) {
+    boost::mpi::gatherv(world, local_res.data(), sizes[0], reinterpret_cast<uint8_t*>(res_.data()), sizes, displs,
+                        0);
+  } else {
+    boost::mpi::gatherv(world, local_res.data(), sizes[world.rank()], 0);
   }
 
-  gatherv(world, local_res.data(), local_res.size(), res_.data(), sizes, 0);
-
   return true;
 }
 
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/radix_sort/include/radix_sort.hpp"
 
 namespace kondratev_ya_radix_sort_batcher_merge_mpi {
 
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace konkov_i_count_words_mpi {
 
@@ -2,7 +2,7 @@
 #include "mpi/konkov_i_count_words/include/ops_mpi.hpp"
 
 #include <boost/mpi/collectives.hpp>
-#include <sstream>
+#include <functional>
 
 bool konkov_i_count_words_mpi::CountWordsTaskParallel::pre_processing() {
   internal_order_test();
@@ -24,48 +24,34 @@ bool konkov_i_count_words_mpi::CountWordsTaskParallel::run() {
   int num_processes = world.size();
   int rank = world.rank();
 
+  size_t total_size = 0;
   if (rank == 0) {
     input_ = *reinterpret_cast<std::string*>(taskData->inputs[0]);
-
-    std::vector<std::string> words;
-    std::istringstream stream(input_);
-    std::string word;
-    while (stream >> word) {
-      words.push_back(word);
-    }
-
-    int total_words = words.size();
-    int chunk_size = total_words / num_processes;
-
-    for (int i = 1; i < num_processes; ++i) {
-      int start_pos = i * chunk_size;
-      int end_pos = (i == num_processes - 1) ? total_words : (i + 1) * chunk_size;
-      std::vector<std::string> chunk(words.begin() + start_pos, words.begin() + end_pos);
-      std::ostringstream oss;
-      for (const auto& w : chunk) {
-        oss << w << " ";
-      }
-      world.send(i, 0, oss.str());
-    }
-
-    words.assign(words.begin(), words.begin() + chunk_size);
-    std::ostringstream oss;
-    for (const auto& w : words) {
-      oss << w << " ";
-    }
-    input_ = oss.str();
-  } else {
-    world.recv(0, 0, input_);
+    total_size = input_.size();
   }
+  boost::mpi::broadcast(world, total_size, 0);
 
-  int local_word_count = 0;
-  std::istringstream local_stream(input_);
-  std::string local_word;
-  while (local_stream >> local_word) {
-    local_word_count++;
+  // The text is cut at any byte rather than split into words on the root; a word cut in two is counted once
+  // when the tallies are joined in rank order
+  std::vector<int> sizes(num_processes);
+  std::vector<int> displs(num_processes);
+  for (int i = 0; i < num_processes; ++i) {
+    displs[i] = static_cast<int>(total_size * i / num_processes);
+    sizes[i] = static_cast<int>(total_size * (i + 1) / num_processes) - displs[i];
+  }
+  std::string local_input(sizes[rank], ' ');
+  if (rank == 0) {
+    boost::mpi::scatterv(world, input_.data(), sizes, displs, local_input.data(), sizes[0], 0);
+  } else {
+    boost::mpi::scatterv(world, local_input.data(), sizes[rank], 0);
   }
 
-  boost::mpi::reduce(world, local_word_count, word_count_, std::plus<>(), 0);
+  // Words as operator>> reads them: maximal runs of characters other than whitespace
+  const auto local_tally =
+      ppc::util::tally_runs(local_input.data(), local_input.size(), ~ppc::util::ByteClass::whitespace());
+  ppc::util::RunTally tally;
+  boost::mpi::reduce(world, local_tally, tally, std::plus<>(), 0);
+  word_count_ = static_cast<int>(tally.count());
 
   return true;
 }
@@ -29,7 +29,6 @@ class JacobiMethodSequential : public ppc::core::Task {
 
   size_t maxIterations_ = 2000;
   double epsilon_ = 1e-5;
-  bool isNeedToComplete(const std::vector<double>& x_old, const std::vector<double>& x_new) const;
 };
 
 class JacobiMethodParallel : public ppc::core::Task {
@@ -57,7 +56,6 @@ class JacobiMethodParallel : public ppc::core::Task {
 
   size_t maxIterations_ = 2000;
   double epsilon_ = 1e-5;
-  bool isNeedToComplete(const std::vector<double>& x_old, const std::vector<double>& x_new) const;
 
   boost::mpi::communicator world;
   static void calculate_distribution_a(int rows, int num_proc, std::vector<int>& sizes, std::vector<int>& displs);
@@ -6,6 +6,7 @@
 #include <boost/mpi.hpp>
 #include <boost/serialization/vector.hpp>
 #include <cmath>
+#include <functional>
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
@@ -40,17 +41,6 @@ bool korablev_v_jacobi_method_mpi::JacobiMethodParallel::isNonSingular(const std
   return true;
 }
 
-bool korablev_v_jacobi_method_mpi::JacobiMethodSequential::isNeedToComplete(const std::vector<double>& x_old,
-                                                                            const std::vector<double>& x_new) const {
-  double sum_up = 0;
-  double sum_low = 0;
-  for (size_t k = 0; k < x_old.size(); k++) {
-    sum_up += (x_new[k] - x_old[k]) * (x_new[k] - x_old[k]);
-    sum_low += x_new[k] * x_new[k];
-  }
-  return (sqrt(sum_up / sum_low) < epsilon_);
-}
-
 bool korablev_v_jacobi_method_mpi::JacobiMethodSequential::pre_processing() {
   internal_order_test();
   n = *reinterpret_cast<size_t*>(taskData->inputs[0]);
@@ -112,8 +102,10 @@ bool korablev_v_jacobi_method_mpi::JacobiMethodSequential::run() {
   size_t numberOfIter = 0;
 
   while (numberOfIter < maxIterations_) {
-    std::copy(x_.begin(), x_.end(), x_prev.begin());
+    x_prev.swap(x_);
 
+    double sum_up = 0;
+    double sum_low = 0;
     for (size_t k = 0; k < n; k++) {
       double S = 0;
       for (size_t j = 0; j < n; j++) {
@@ -122,9 +114,11 @@ bool korablev_v_jacobi_method_mpi::JacobiMethodSequential::run() {
         }
       }
       x_[k] = (b_[k] - S) / A_[k * n + k];
+      sum_up += (x_[k] - x_prev[k]) * (x_[k] - x_prev[k]);
+      sum_low += x_[k] * x_[k];
     }
 
-    if (isNeedToComplete(x_prev, x_)) break;
+    if (sqrt(sum_up / sum_low) < epsilon_) break;
     numberOfIter++;
   }
 
@@ -139,17 +133,6 @@ bool korablev_v_jacobi_method_mpi::JacobiMethodSequential::post_processing() {
   return true;
 }
 
-bool korablev_v_jacobi_method_mpi::JacobiMethodParallel::isNeedToComplete(const std::vector<double>& x_old,
-                                                                          const std::vector<double>& x_new) const {
-  double sum_up = 0;
-  double sum_low = 0;
-  for (size_t k = 0; k < x_old.size(); k++) {
-    sum_up += (x_new[k] - x_old[k]) * (x_new[k] - x_old[k]);
-    sum_low += x_new[k] * x_new[k];
-  }
-  return (sqrt(sum_up / sum_low) < epsilon_);
-}
-
 bool korablev_v_jacobi_method_mpi::JacobiMethodParallel::pre_processing() {
   internal_order_test();
   sizes_a.resize(world.size());
@@ -222,8 +205,6 @@ bool korablev_v_jacobi_method_mpi::JacobiMethodParallel::validation() {
 
 bool korablev_v_jacobi_method_mpi::JacobiMethodParallel::run() {
   internal_order_test();
-  std::vector<double> local_x;
-
   boost::mpi::broadcast(world, sizes_a, 0);
   boost::mpi::broadcast(world, sizes_b, 0);
   boost::mpi::broadcast(world, displs_b, 0);
@@ -234,7 +215,6 @@ bool korablev_v_jacobi_method_mpi::JacobiMethodParallel::run() {
 
   local_A.resize(loc_mat_size);
   local_b.resize(loc_vec_size);
-  local_x.resize(sizes_b[world.rank()]);
 
   if (world.rank() == 0) {
     boost::mpi::scatterv(world, A_.data(), sizes_a, displs_a, local_A.data(), loc_mat_size, 0);
@@ -244,34 +224,41 @@ bool korablev_v_jacobi_method_mpi::JacobiMethodParallel::run() {
     boost::mpi::scatterv(world, local_b.data(), loc_vec_size, 0);
   }
 
+  // Every rank writes its rows of the new iterate into a zeroed buffer of length n + 2 and appends its
+  // partial sums of the update norm; one allreduce then exchanges the solution and the stopping test together
+  std::vector<double> x_next(n + 2);
+  std::vector<double> x_sum(n + 2);
+  x_prev.resize(n + 2);
+  if (world.rank() == 0) {
+    std::copy(x_.begin(), x_.end(), x_prev.begin());
+  }
+  boost::mpi::broadcast(world, x_prev.data(), static_cast<int>(n), 0);
+
   for (size_t numberOfIter = 0; numberOfIter < maxIterations_; numberOfIter++) {
-    if (world.rank() == 0) {
-      std::copy(x_.begin(), x_.end(), x_prev.begin());
-    }
-    boost::mpi::broadcast(world, x_prev, 0);
+    std::fill(x_next.begin(), x_next.end(), 0.0);
 
     for (int k = 0; k < sizes_b[world.rank()]; k++) {
+      int row = displs_b[world.rank()] + k;
       double S = 0;
       for (int j = 0; j < static_cast<int>(n); j++) {
-        if (j != (displs_b[world.rank()] + k)) {
+        if (j != row) {
           S += local_A[k * n + j] * x_prev[j];
         }
       }
-      local_x[k] = (local_b[k] - S) / local_A[k * n + displs_b[world.rank()] + k];
+      double x_k = (local_b[k] - S) / local_A[k * n + row];
+      x_next[row] = x_k;
+      x_next[n] += (x_k - x_prev[row]) * (x_k - x_prev[row]);
+      x_next[n + 1] += x_k * x_k;
     }
 
-    if (world.rank() == 0) {
-      boost::mpi::gatherv(world, local_x.data(), sizes_b[world.rank()], x_.data(), sizes_b, displs_b, 0);
-    } else {
-      boost::mpi::gatherv(world, local_x.data(), sizes_b[world.rank()], 0);
-    }
-    bool need;
-    if (world.rank() == 0) {
-      need = isNeedToComplete(x_prev, x_);
-    }
-    boost::mpi::broadcast(world, need, 0);
+    boost::mpi::all_reduce(world, x_next.data(), static_cast<int>(n + 2), x_sum.data(), std::plus<double>());
+    x_prev.swap(x_sum);
+
+    if (sqrt(x_prev[n] / x_prev[n + 1]) < epsilon_) break;
+  }
 
-    if (need) break;
+  if (world.rank() == 0) {
+    std::copy(x_prev.begin(), x_prev.begin() + n, x_.begin());
   }
 
   return true;
@@ -259,3 +259,31 @@ TEST(korablev_v_rect_int, test_remainder_case) {
     ASSERT_NEAR(reference_result[0], global_result[0], 1e-3);
   }
 }
+
+TEST(korablev_v_rect_int, test_validation_rejects_non_positive_n) {
+  boost::mpi::communicator world;
+  for (int n : {0, -5}) {
+    std::vector<double> global_result(1, 0);
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+    double a = 0.0;
+    double b = 1.0;
+
+    if (world.rank() == 0) {
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&a));
+      taskDataPar->inputs_count.emplace_back(1);
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&b));
+      taskDataPar->inputs_count.emplace_back(1);
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+      taskDataPar->inputs_count.emplace_back(1);
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+      taskDataPar->outputs_count.emplace_back(global_result.size());
+
+      korablev_v_rect_int_mpi::RectangularIntegrationParallel parallelTask(taskDataPar);
+      ASSERT_FALSE(parallelTask.validation());
+
+      korablev_v_rect_int_mpi::RectangularIntegrationSequential sequentialTask(taskDataPar);
+      ASSERT_FALSE(sequentialTask.validation());
+    }
+  }
+}
@@ -28,12 +28,12 @@ bool korablev_v_rect_int_mpi::RectangularIntegrationSequential::pre_processing()
 
 bool korablev_v_rect_int_mpi::RectangularIntegrationSequential::validation() {
   internal_order_test();
-  return taskData->outputs_count[0] == 1;
+  return taskData->outputs_count[0] == 1 && *reinterpret_cast<int*>(taskData->inputs[2]) > 0;
 }
 
 bool korablev_v_rect_int_mpi::RectangularIntegrationSequential::run() {
   internal_order_test();
-  result_ = integrate(func_, a_, b_, n_);
+  result_ = ppc::util::composite_quadrature(func_, a_, b_, n_, ppc::util::QuadratureRule::kLeftRectangle);
   return true;
 }
 
@@ -43,24 +43,6 @@ bool korablev_v_rect_int_mpi::RectangularIntegrationSequential::post_processing(
   return true;
 }
 
-double korablev_v_rect_int_mpi::RectangularIntegrationSequential::integrate(const std::function<double(double)>& f,
-                                                                            double a, double b, int n) {
-  double h = (b - a) / n;
-  double sum = 0.0;
-
-  for (int i = 0; i < n; ++i) {
-    double x = a + i * h;
-    sum += f(x) * h;
-  }
-
-  return sum;
-}
-
-void korablev_v_rect_int_mpi::RectangularIntegrationSequential::set_function(
-    const std::function<double(double)>& func) {
-  func_ = func;
-}
-
 bool korablev_v_rect_int_mpi::RectangularIntegrationParallel::pre_processing() {
   internal_order_test();
 
@@ -84,15 +66,19 @@ bool korablev_v_rect_int_mpi::RectangularIntegrationParallel::pre_processing() {
 bool korablev_v_rect_int_mpi::RectangularIntegrationParallel::validation() {
   internal_order_test();
   if (world.rank() == 0) {
-    return taskData->outputs_count[0] == 1;
+    return taskData->outputs_count[0] == 1 && *reinterpret_cast<int*>(taskData->inputs[2]) > 0;
   }
   return true;
 }
 
 bool korablev_v_rect_int_mpi::RectangularIntegrationParallel::run() {
   internal_order_test();
-  double local_result_{};
-  local_result_ = parallel_integrate(func_, a_, b_, n_);
+  // Each rank takes a contiguous block of the n rectangles
+  size_t n = n_;
+  size_t first = n * world.rank() / world.size();
+  size_t last = n * (world.rank() + 1) / world.size();
+  double local_result_ =
+      ppc::util::composite_quadrature(func_, a_, b_, n, ppc::util::QuadratureRule::kLeftRectangle, first, last);
   reduce(world, local_result_, global_result_, std::plus<>(), 0);
   return true;
 }
@@ -104,23 +90,3 @@ bool korablev_v_rect_int_mpi::RectangularIntegrationParallel::post_processing()
   }
   return true;
 }
-
-double korablev_v_rect_int_mpi::RectangularIntegrationParallel::parallel_integrate(
-    const std::function<double(double)>& f, double a, double b, int n) {
-  int rank = world.rank();
-  int size = world.size();
-
-  double h = (b - a) / n;
-  double local_sum = 0.0;
-
-  for (int i = rank; i < n; i += size) {
-    double x = a + i * h;
-    local_sum += f(x) * h;
-  }
-
-  return local_sum;
-}
-
-void korablev_v_rect_int_mpi::RectangularIntegrationParallel::set_function(const std::function<double(double)>& func) {
-  func_ = func;
-}
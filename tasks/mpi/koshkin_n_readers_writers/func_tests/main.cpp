@@ -265,4 +265,51 @@ TEST(readers_writers_MPI, test_invalid_vector) {
   if (world.rank() == 0) {
     ASSERT_NE(res_exp_paral, exit_vec);
   }
-}
\ No newline at end of file
+}
+
+TEST(readers_writers_MPI, test_rounds_and_mixes) {
+  boost::mpi::communicator world;
+
+  if (world.size() < 2) {
+    GTEST_SKIP();
+  }
+
+  const int count_size_vector = 40;
+  const int rounds = 20;
+
+  // All writers, the default mix of odd writers, and a single writer; with and without writer preference
+  for (int writer_period : {1, 2, world.size()}) {
+    for (int writer_preference : {1, 0}) {
+      std::vector<int> global_vec = koshkin_n_readers_writers_mpi::getRandomVector(count_size_vector);
+      std::vector<int> options = {rounds, writer_period, writer_preference};
+      std::vector<int> exit_vec(count_size_vector, 0);
+      std::vector<int> res_exp_paral = global_vec;
+
+      std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+      if (world.rank() == 0) {
+        int num_writers = 0;
+        for (int rank = 0; rank < world.size(); rank++) {
+          if (rank % writer_period == 1 % writer_period) num_writers++;
+        }
+        for (int i = 0; i < count_size_vector; i++) {
+          res_exp_paral[i] += num_writers * rounds * 100;
+        }
+        taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(global_vec.data()));
+        taskDataPar->inputs_count.emplace_back(global_vec.size());
+        taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(options.data()));
+        taskDataPar->inputs_count.emplace_back(options.size());
+        taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(exit_vec.data()));
+        taskDataPar->outputs_count.emplace_back(exit_vec.size());
+      }
+
+      koshkin_n_readers_writers_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+      ASSERT_EQ(testMpiTaskParallel.validation(), true);
+      testMpiTaskParallel.pre_processing();
+      testMpiTaskParallel.run();
+      testMpiTaskParallel.post_processing();
+      if (world.rank() == 0) {
+        EXPECT_EQ(res_exp_paral, exit_vec) << writer_period << ' ' << writer_preference;
+      }
+    }
+  }
+}
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <gtest/gtest.h>
+#include <mpi.h>
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -14,6 +16,47 @@
 
 namespace koshkin_n_readers_writers_mpi {
 std::vector<int> getRandomVector(int sz);
+
+// Reader-writer lock in an MPI window, without a lock server. Readers count themselves in a word on rank 0 with
+// an atomic fetch-and-add; a writer adds kWriter to the same word, which turns arriving readers away, and waits
+// for the readers inside to leave. Writers queue as in the MCS lock: each swaps itself into a tail word on rank 0
+// and then spins only on a flag in its own window, which its predecessor sets. With writer preference a writer
+// hands the lock straight to the next queued writer, so readers wait until the queue is empty; without it every
+// writer gives the lock back to the readers' word, which lets readers waiting at that moment in between writers.
+// Constructing and destroying the lock is collective.
+class RmaRwLock {
+ public:
+  RmaRwLock(MPI_Comm comm, bool writer_preference);
+  ~RmaRwLock();
+  RmaRwLock(const RmaRwLock&) = delete;
+  RmaRwLock& operator=(const RmaRwLock&) = delete;
+
+  void lock_shared();
+  void unlock_shared();
+  void lock();
+  void unlock();
+
+ private:
+  // Words of every rank's queue node, then the words only rank 0 has
+  enum Word : int { kNext, kGranted, kCount, kTail };
+  // kGranted: the lock comes with kWriter already counted (handed on), or the writer must count itself
+  enum Grant : int64_t { kWaiting, kHandedOn, kCountYourself };
+  static constexpr int64_t kWriter = int64_t{1} << 32;
+
+  int64_t fetch_and_op(int64_t value, int rank, Word word, MPI_Op op);
+  int64_t load(int rank, Word word) { return fetch_and_op(0, rank, word, MPI_NO_OP); }
+  void store(int64_t value, int rank, Word word);
+  // Spins until the word holds a value other than value
+  int64_t wait_while(int rank, Word word, int64_t value);
+  // Lets the other processes run and serves their operations on this rank's window, which some one-sided
+  // implementations only process inside MPI calls to other ranks
+  void idle();
+
+  MPI_Comm comm_;
+  MPI_Win win_{};
+  int rank_ = 0;
+  bool writer_preference_;
+};
 class TestMPITaskParallel : public ppc::core::Task {
  public:
   explicit TestMPITaskParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
@@ -25,6 +68,14 @@ class TestMPITaskParallel : public ppc::core::Task {
  private:
   std::vector<int> shared_resource;
   std::vector<int> res;
+  int rounds = 1;
+  int writer_period = 2;
+  bool writer_preference = true;
+  // The resource in a window on rank 0, and the lock, from pre_processing to post_processing: setting up windows
+  // costs more than many acquisitions, so repeated runs share them
+  int size = 0;
+  MPI_Win data_win{};
+  std::unique_ptr<RmaRwLock> lock;
   boost::mpi::communicator world;
 };
-}  // namespace koshkin_n_readers_writers_mpi
\ No newline at end of file
+}  // namespace koshkin_n_readers_writers_mpi
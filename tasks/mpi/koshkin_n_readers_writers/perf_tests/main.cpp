@@ -109,4 +109,54 @@ TEST(koshkin_n_readers_writers_mpi_perf_test, test_task_run) {
     ppc::core::Perf::print_perf_statistic(perfResults);
     ASSERT_EQ(res_exp_paral, exit_vec);
   }
-}
\ No newline at end of file
+}
+// Reader-heavy (rank 1 writes) and writer-heavy (every rank writes) mixes of 100 acquisitions per rank, with
+// writer preference; the mean acquisition latency is the printed time over 100 * size acquisitions
+TEST(koshkin_n_readers_writers_mpi_perf_test, test_task_run_mixes) {
+  boost::mpi::communicator world;
+
+  if (world.size() < 2) {
+    GTEST_SKIP();
+  }
+
+  const int count_size_vector = 500;
+  const int rounds = 100;
+
+  for (int writer_period : {world.size(), 1}) {
+    std::vector<int> global_vec = koshkin_n_readers_writers_mpi::getRandomVector(count_size_vector);
+    std::vector<int> options = {rounds, writer_period, 1};
+    std::vector<int> exit_vec(count_size_vector, 0);
+    std::vector<int> res_exp_paral = global_vec;
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      const int num_writers = writer_period == 1 ? world.size() : 1;
+      for (int i = 0; i < count_size_vector; i++) {
+        res_exp_paral[i] += num_writers * rounds * 100;
+      }
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(global_vec.data()));
+      taskDataPar->inputs_count.emplace_back(global_vec.size());
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(options.data()));
+      taskDataPar->inputs_count.emplace_back(options.size());
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(exit_vec.data()));
+      taskDataPar->outputs_count.emplace_back(exit_vec.size());
+    }
+
+    auto testMpiTaskParallel = std::make_shared<koshkin_n_readers_writers_mpi::TestMPITaskParallel>(taskDataPar);
+    ASSERT_EQ(testMpiTaskParallel->validation(), true);
+    testMpiTaskParallel->pre_processing();
+    testMpiTaskParallel->run();
+    testMpiTaskParallel->post_processing();
+
+    auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+    perfAttr->num_running = 10;
+    const boost::mpi::timer current_timer;
+    perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+    auto perfResults = std::make_shared<ppc::core::PerfResults>();
+    auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testMpiTaskParallel);
+    perfAnalyzer->task_run(perfAttr, perfResults);
+    if (world.rank() == 0) {
+      ppc::core::Perf::print_perf_statistic(perfResults);
+      ASSERT_EQ(res_exp_paral, exit_vec);
+    }
+  }
+}
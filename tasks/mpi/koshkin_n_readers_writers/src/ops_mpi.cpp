@@ -18,16 +18,136 @@ std::vector<int> koshkin_n_readers_writers_mpi::getRandomVector(int sz) {
   return vec;
 }
 
+koshkin_n_readers_writers_mpi::RmaRwLock::RmaRwLock(MPI_Comm comm, bool writer_preference)
+    : comm_(comm), writer_preference_(writer_preference) {
+  MPI_Comm_rank(comm, &rank_);
+  int64_t* base;
+  const int words = rank_ == 0 ? 4 : 2;
+  MPI_Win_allocate(static_cast<MPI_Aint>(words * sizeof(int64_t)), sizeof(int64_t), MPI_INFO_NULL, comm, &base,
+                   &win_);
+  MPI_Win_lock(MPI_LOCK_EXCLUSIVE, rank_, 0, win_);
+  std::fill(base, base + words, 0);
+  MPI_Win_unlock(rank_, win_);
+  MPI_Barrier(comm);
+  MPI_Win_lock_all(0, win_);
+}
+
+koshkin_n_readers_writers_mpi::RmaRwLock::~RmaRwLock() {
+  MPI_Win_unlock_all(win_);
+  MPI_Win_free(&win_);
+}
+
+int64_t koshkin_n_readers_writers_mpi::RmaRwLock::fetch_and_op(int64_t value, int rank, Word word, MPI_Op op) {
+  int64_t old;
+  MPI_Fetch_and_op(&value, &old, MPI_INT64_T, rank, word, op, win_);
+  MPI_Win_flush(rank, win_);
+  return old;
+}
+
+void koshkin_n_readers_writers_mpi::RmaRwLock::store(int64_t value, int rank, Word word) {
+  MPI_Accumulate(&value, 1, MPI_INT64_T, rank, word, 1, MPI_INT64_T, MPI_REPLACE, win_);
+  MPI_Win_flush(rank, win_);
+}
+
+void koshkin_n_readers_writers_mpi::RmaRwLock::idle() {
+  int flag;
+  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm_, &flag, MPI_STATUS_IGNORE);
+  std::this_thread::yield();
+}
+
+int64_t koshkin_n_readers_writers_mpi::RmaRwLock::wait_while(int rank, Word word, int64_t value) {
+  int64_t current;
+  while ((current = load(rank, word)) == value) idle();
+  return current;
+}
+
+void koshkin_n_readers_writers_mpi::RmaRwLock::lock_shared() {
+  while (fetch_and_op(1, 0, kCount, MPI_SUM) >= kWriter) {
+    // A writer holds the lock or waits for it: step back until it is gone
+    fetch_and_op(-1, 0, kCount, MPI_SUM);
+    while (load(0, kCount) >= kWriter) idle();
+  }
+}
+
+void koshkin_n_readers_writers_mpi::RmaRwLock::unlock_shared() { fetch_and_op(-1, 0, kCount, MPI_SUM); }
+
+void koshkin_n_readers_writers_mpi::RmaRwLock::lock() {
+  store(0, rank_, kNext);
+  store(kWaiting, rank_, kGranted);
+  // Queue nodes are named by rank + 1, so that 0 is an empty queue
+  const int64_t pred = fetch_and_op(rank_ + 1, 0, kTail, MPI_REPLACE);
+  if (pred != 0) {
+    store(rank_ + 1, static_cast<int>(pred - 1), kNext);
+    if (wait_while(rank_, kGranted, kWaiting) == kHandedOn) return;
+  }
+  // First in the queue: count the writer, which turns readers away, and wait for those inside
+  fetch_and_op(kWriter, 0, kCount, MPI_SUM);
+  while (load(0, kCount) != kWriter) idle();
+}
+
+void koshkin_n_readers_writers_mpi::RmaRwLock::unlock() {
+  // MCS release with swaps only (compare-and-swap is not reliable in every MPI one-sided component)
+  int64_t next = load(rank_, kNext);
+  if (next == 0) {
+    const int64_t tail = fetch_and_op(0, 0, kTail, MPI_REPLACE);
+    if (tail == rank_ + 1) {
+      fetch_and_op(-kWriter, 0, kCount, MPI_SUM);  // nobody queued behind
+      return;
+    }
+    // Writers behind this one swapped themselves in. Put their tail back; writers that came while the queue
+    // looked empty (the usurpers) started a queue of their own, so this one goes behind them and the lock is
+    // released to the first usurper through the readers' word.
+    const int64_t usurper = fetch_and_op(tail, 0, kTail, MPI_REPLACE);
+    next = wait_while(rank_, kNext, 0);
+    if (usurper != 0) {
+      store(next, static_cast<int>(usurper - 1), kNext);
+      fetch_and_op(-kWriter, 0, kCount, MPI_SUM);
+      return;
+    }
+  }
+  const auto successor = static_cast<int>(next - 1);
+  if (writer_preference_) {
+    store(kHandedOn, successor, kGranted);
+  } else {
+    fetch_and_op(-kWriter, 0, kCount, MPI_SUM);
+    store(kCountYourself, successor, kGranted);
+  }
+}
+
 bool koshkin_n_readers_writers_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
 
   if (world.rank() == 0) {
-    int size = taskData->inputs_count[0];
+    size = static_cast<int>(taskData->inputs_count[0]);
     shared_resource = std::vector<int>(size);
     auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
     std::copy(tmp_ptr, tmp_ptr + size, shared_resource.begin());
     res = {};
+    // Optional {rounds, writer period, writer preference}: every rank takes the lock rounds times, the ranks r
+    // with r % period == 1 % period as writers
+    if (taskData->inputs.size() > 1) {
+      auto* options = reinterpret_cast<int*>(taskData->inputs[1]);
+      rounds = options[0];
+      writer_period = options[1];
+      writer_preference = options[2] != 0;
+    }
+  }
+  boost::mpi::broadcast(world, size, 0);
+  boost::mpi::broadcast(world, rounds, 0);
+  boost::mpi::broadcast(world, writer_period, 0);
+  boost::mpi::broadcast(world, writer_preference, 0);
+
+  int* data;
+  MPI_Win_allocate(static_cast<MPI_Aint>(world.rank() == 0 ? size * sizeof(int) : 0), sizeof(int), MPI_INFO_NULL,
+                   world, &data, &data_win);
+  if (world.rank() == 0) {
+    MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, data_win);
+    std::copy(shared_resource.begin(), shared_resource.end(), data);
+    MPI_Win_unlock(0, data_win);
   }
+  world.barrier();
+  MPI_Win_lock_all(0, data_win);
+  lock = std::make_unique<RmaRwLock>(world, writer_preference);
   return true;
 }
 
@@ -36,7 +156,11 @@ bool koshkin_n_readers_writers_mpi::TestMPITaskParallel::validation() {
   if (world.rank() == 0) {
     return ((!taskData->inputs.empty() && !taskData->outputs.empty()) &&
             (!taskData->inputs_count.empty() && taskData->inputs_count[0] != 0) &&
-            (!taskData->outputs_count.empty() && taskData->outputs_count[0] != 0));
+            (!taskData->outputs_count.empty() && taskData->outputs_count[0] != 0)) &&
+           (taskData->inputs.size() == 1 ||
+            (taskData->inputs.size() == 2 && taskData->inputs_count.size() == 2 && taskData->inputs_count[1] == 3 &&
+             reinterpret_cast<int*>(taskData->inputs[1])[0] >= 0 &&
+             reinterpret_cast<int*>(taskData->inputs[1])[1] > 0));
   }
   return true;
 }
@@ -44,111 +168,31 @@ bool koshkin_n_readers_writers_mpi::TestMPITaskParallel::validation() {
 bool koshkin_n_readers_writers_mpi::TestMPITaskParallel::run() {
   internal_order_test();
 
-  static int resource = 1;   // Semaphore for resource locking
-  static int rmutex = 1;     // Semaphore for protection readcount
-  static int readcount = 0;  // Global Reader Counter
-
-  if (world.rank() == 0) {
-    // The master process controls access
-    bool terminate = false;
-    int active_processes = world.size() - 1;
-
-    while (!terminate) {
-      boost::mpi::status status;
-      std::string request;
-      status = world.recv(boost::mpi::any_source, 0, request);
-      int sender = status.source();
-
-      if (request == "read_entry") {
-        if (rmutex != 0) {
-          rmutex = 0;  // Block the entrance section
-          readcount++;
-          if (readcount == 1) {
-            if (resource != 0) {
-              resource = 0;  // Blocking a resource for writers
-            } else {
-              world.send(sender, 1, std::string("wait"));
-              continue;
-            }
-          }
-          rmutex = 1;  // Unlock section
-          world.send(sender, 1, std::string("proceed"));
-
-          world.send(sender, 3, shared_resource);
-        } else {
-          world.send(sender, 1, std::string("wait"));
-        }
-      } else if (request == "read_exit") {
-        rmutex = 0;  // Block the exit section
-        readcount--;
-        if (readcount == 0) {
-          resource = 1;  // Unlock resource
-        }
-        rmutex = 1;
-        world.send(sender, 1, std::string("done"));
-      } else if (request == "write_entry") {
-        // Simulation resource.P()
-        if (resource != 0) {
-          resource = 0;  // Blocking the resource
-          world.send(sender, 1, std::string("proceed"));
-
-          // Send the current resource to the writer
-          world.send(sender, 3, shared_resource);
-
-        } else {
-          world.send(sender, 1, std::string("wait"));
-        }
-      } else if (request == "write_exit") {
-        std::vector<int> updated_resource(shared_resource.size());
-        // We receive an updated resource from the writer
-        world.recv(sender, 2, updated_resource);
-
-        shared_resource = updated_resource;
-
-        resource = 1;  // Unlocking a resource
-        world.send(sender, 1, std::string("done"));
-
-      } else if (request == "terminate") {
-        active_processes--;
-        if (active_processes == 0) terminate = true;
-      }
+  // Readers and writers reach the resource directly under the lock
+  const bool writer = world.rank() % writer_period == 1 % writer_period;
+  std::vector<int> local(size);
+  for (int round = 0; round < rounds; round++) {
+    if (writer) {
+      lock->lock();
+      MPI_Get(local.data(), size, MPI_INT, 0, 0, size, MPI_INT, data_win);
+      MPI_Win_flush(0, data_win);
+      for (auto& val : local) val += 100;
+      MPI_Put(local.data(), size, MPI_INT, 0, 0, size, MPI_INT, data_win);
+      MPI_Win_flush(0, data_win);
+      lock->unlock();
+    } else {
+      lock->lock_shared();
+      MPI_Get(local.data(), size, MPI_INT, 0, 0, size, MPI_INT, data_win);
+      MPI_Win_flush(0, data_win);
+      lock->unlock_shared();
     }
-    res = shared_resource;
-  } else {
-    std::string role = (world.rank() % 2 == 0) ? "reader" : "writer";
-    if (role == "writer") {
-      std::string response;
-      do {
-        world.send(0, 0, std::string("write_entry"));
-        world.recv(0, 1, response);
-      } while (response == "wait");
-
-      if (response == "proceed") {
-        world.recv(0, 3, shared_resource);
-
-        // Simulate recording
-        for (auto& val : shared_resource) val += 100;
-
-        world.send(0, 2, shared_resource);
-        world.send(0, 0, std::string("write_exit"));
-        world.recv(0, 1, response);
-      }
-    } else if (role == "reader") {
-      world.send(0, 0, std::string("read_entry"));
-      std::string response;
-      world.recv(0, 1, response);
-      if (response == "proceed") {
-        // Simulate reading
-        world.recv(0, 3, shared_resource);
-        std::this_thread::sleep_for(std::chrono::milliseconds(5));
-
-        world.send(0, 0, std::string("read_exit"));
-        world.recv(0, 1, response);
-      }
-    }
-    world.send(0, 0, std::string("terminate"));
   }
   world.barrier();
+  if (world.rank() == 0) {
+    res.resize(size);
+    MPI_Get(res.data(), size, MPI_INT, 0, 0, size, MPI_INT, data_win);
+    MPI_Win_flush(0, data_win);
+  }
   return true;
 }
 
@@ -158,5 +202,8 @@ bool koshkin_n_readers_writers_mpi::TestMPITaskParallel::post_processing() {
     auto* output = reinterpret_cast<int*>(taskData->outputs[0]);
     std::copy(res.begin(), res.end(), output);
   }
+  lock.reset();
+  MPI_Win_unlock_all(data_win);
+  MPI_Win_free(&data_win);
   return true;
-}
\ No newline at end of file
+}
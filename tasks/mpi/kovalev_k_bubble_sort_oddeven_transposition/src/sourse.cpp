@@ -1,5 +1,7 @@
 #include "mpi/kovalev_k_bubble_sort_oddeven_transposition/include/header.hpp"
 
+#include <algorithm>
+
 template <class T>
 bool kovalev_k_bubble_sort_oddeven_transposition_mpi::BubbleSortOddEvenTranspositionPar<T>::bubble_sort_mpi() {
   for (size_t i = 0; i < loc_v.size() - 1; i++)
@@ -100,11 +102,11 @@ bool kovalev_k_bubble_sort_oddeven_transposition_mpi::BubbleSortOddEvenTransposi
   gather(world, loc_v.data(), loc_v.size(), glob_v.data(), 0);
 
   if (world.rank() == 0) {
-    for (size_t i = 0; i < remainder.size(); i++) {
-      size_t j = 0;
-      while (j < glob_v.size() && remainder[i] > glob_v[j]) j++;
-      glob_v.insert(glob_v.begin() + j, remainder[i]);
-    }
+    // One linear merge instead of a scan and an insert per leftover element
+    std::sort(remainder.begin(), remainder.end());
+    size_t sorted_length = glob_v.size();
+    glob_v.insert(glob_v.end(), remainder.begin(), remainder.end());
+    std::inplace_merge(glob_v.begin(), glob_v.begin() + sorted_length, glob_v.end());
     remainder.clear();
   }
 
@@ -200,3 +200,36 @@ TEST(kozlova_e_lexic_order, Test_empty_strings) {
     ASSERT_EQ(resMPI, resSeq);
   }
 }
+
+TEST(kozlova_e_lexic_order, Test_Long_Strings) {
+  boost::mpi::communicator world;
+  // Mixed case letters in order, broken inside the prefix checked first, on its border and within the slices
+  std::string ordered;
+  for (int i = 0; i < 10000; i++) ordered += static_cast<char>((i % 2 == 0 ? 'a' : 'A') + i * 26 / 10000);
+  for (int pos : {100, 4096, 5000, 9999}) {
+    std::vector<std::string> input_strings = {ordered, ordered};
+    input_strings[1][pos] = '0';
+    std::vector<int> resMPI(2, 0);
+    std::vector<int> answer = {1, 0};
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+    if (world.rank() == 0) {
+      for (const auto &str : input_strings) {
+        taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(const_cast<char *>(str.c_str())));
+      }
+      taskDataPar->inputs_count.emplace_back(2);
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(resMPI.data()));
+      taskDataPar->outputs_count.emplace_back(resMPI.size());
+    }
+
+    kozlova_e_lexic_order_mpi::StringComparatorMPI testMpiTaskParallel(taskDataPar);
+    ASSERT_EQ(testMpiTaskParallel.validation(), true);
+    testMpiTaskParallel.pre_processing();
+    testMpiTaskParallel.run();
+    testMpiTaskParallel.post_processing();
+
+    if (world.rank() == 0) {
+      EXPECT_EQ(resMPI, answer) << pos;
+    }
+  }
+}
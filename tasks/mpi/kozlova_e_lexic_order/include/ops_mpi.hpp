@@ -15,6 +15,8 @@
 
 namespace kozlova_e_lexic_order_mpi {
 
+// Whether the characters of str never decrease, ignoring case
+bool IsOrdered(const char* str, size_t len);
 std::vector<int> LexicographicallyOrdered(const std::string& str1, const std::string& str2);
 
 class StringComparatorSeq : public ppc::core::Task {
@@ -1,34 +1,23 @@
 // Copyright 2023 Nesterov Alexander
 #include "mpi/kozlova_e_lexic_order/include/ops_mpi.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
-std::vector<int> kozlova_e_lexic_order_mpi::LexicographicallyOrdered(const std::string& str1, const std::string& str2) {
-  int flag1 = 1;
-  int flag2 = 1;
-  std::vector<int> localres;
-  std::string lowerStr1 = str1;
-  std::transform(lowerStr1.begin(), lowerStr1.end(), lowerStr1.begin(), ::tolower);
-
-  std::string lowerStr2 = str2;
-  std::transform(lowerStr2.begin(), lowerStr2.end(), lowerStr2.begin(), ::tolower);
-  for (size_t i = 0; i < lowerStr1.size() - 1; ++i) {
-    if (lowerStr1[i] > lowerStr1[i + 1]) {
-      flag1 = 0;
-      break;
-    }
+bool kozlova_e_lexic_order_mpi::IsOrdered(const char* str, size_t len) {
+  // tolower of the "C" locale, without a call per character
+  auto lower = [](char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; };
+  for (size_t i = 1; i < len; ++i) {
+    if (lower(str[i - 1]) > lower(str[i])) return false;
   }
+  return true;
+}
 
-  for (size_t i = 0; i < lowerStr2.size() - 1; ++i) {
-    if (lowerStr2[i] > lowerStr2[i + 1]) {
-      flag2 = 0;
-      break;
-    }
-  }
-  localres.emplace_back(flag1);
-  localres.emplace_back(flag2);
-  return localres;
+std::vector<int> kozlova_e_lexic_order_mpi::LexicographicallyOrdered(const std::string& str1, const std::string& str2) {
+  return {IsOrdered(str1.data(), str1.size()) ? 1 : 0, IsOrdered(str2.data(), str2.size()) ? 1 : 0};
 }
 
 bool kozlova_e_lexic_order_mpi::StringComparatorSeq::pre_processing() {
@@ -94,57 +83,51 @@ bool kozlova_e_lexic_order_mpi::StringComparatorMPI::validation() {
 
 bool kozlova_e_lexic_order_mpi::StringComparatorMPI::run() {
   internal_order_test();
-  for (int i = 0; i < 2; i++) boost::mpi::broadcast(world, input_strings[i], 0);
+  // Unordered strings mostly break early, so the root checks a prefix of each string, and the pairs across the
+  // borders of the slices, before sending anything. Only a string ordered so far is scattered, and each process
+  // checks the pairs within its slice.
+  constexpr int kPrefix = 4096;
   std::vector<int> local_res(2, 1);
-  int len1 = input_strings[0].size();
-  int len2 = input_strings[1].size();
-  int delta1 = (len1 + world.size() - 1) / world.size();
-  int delta2 = (len2 + world.size() - 1) / world.size();
-  int start1 = world.rank() * delta1;
-  int end1 = std::min(start1 + delta1, len1);
-  int start2 = world.rank() * delta2;
-  int end2 = std::min(start2 + delta2, len2);
-
-  std::string local_string1 = (start1 < len1) ? input_strings[0].substr(start1, end1 - start1) : "";
-  std::string local_string2 = (start2 < len2) ? input_strings[1].substr(start2, end2 - start2) : "";
-
-  if (!local_string1.empty()) {
-    local_res[0] = LexicographicallyOrdered(local_string1, local_string2)[0];
-  }
-  if (!local_string2.empty()) {
-    local_res[1] = LexicographicallyOrdered(local_string1, local_string2)[1];
-  }
-
-  if (world.rank() < world.size() - 1) {
-    if (end1 > 0 && end1 < len1) {
-      char last_char1 = std::tolower(input_strings[0][end1 - 1]);
-      char first_char1_next = std::tolower(input_strings[0][end1]);
-      if (last_char1 > first_char1_next) {
-        local_res[0] = 0;
-      }
+  for (int s = 0; s < 2; s++) {
+    const std::string& str = input_strings[s];
+    int len = 0;
+    if (world.rank() == 0) {
+      len = static_cast<int>(str.size());
     }
-    if (end2 > 0 && end2 < len2) {
-      char last_char2 = std::tolower(input_strings[1][end2 - 1]);
-      char first_char2_next = std::tolower(input_strings[1][end2]);
-      if (last_char2 > first_char2_next) {
-        local_res[1] = 0;
+    boost::mpi::broadcast(world, len, 0);
+    const int prefix = std::min(len, kPrefix);
+    auto cut = [&](int proc) {
+      return proc == world.size() ? len : prefix + static_cast<int>(int64_t(len - prefix) * proc / world.size());
+    };
+    bool check_slices = false;
+    if (world.rank() == 0) {
+      bool ordered = IsOrdered(str.data(), prefix);
+      for (int proc = 0; proc < world.size() && ordered; proc++) {
+        const int border = cut(proc);
+        if (border > 0 && border < len) ordered = IsOrdered(str.data() + border - 1, 2);
       }
+      local_res[s] = ordered ? 1 : 0;
+      check_slices = ordered && prefix < len;
     }
-  }
-
-  std::vector<int> global_results(2 * world.size());
-  boost::mpi::gather(world, local_res.data(), local_res.size(), global_results.data(), 0);
-
-  if (world.rank() == 0) {
-    int is_ordered1 = 1;
-    int is_ordered2 = 1;
-    for (int i = 0; i < world.size(); ++i) {
-      if (global_results[i * 2] == 0) is_ordered1 = 0;
-      if (global_results[i * 2 + 1] == 0) is_ordered2 = 0;
+    boost::mpi::broadcast(world, check_slices, 0);
+    if (!check_slices) continue;
+
+    std::vector<int> sizes(world.size());
+    std::vector<int> displs(world.size());
+    for (int proc = 0; proc < world.size(); proc++) {
+      displs[proc] = cut(proc);
+      sizes[proc] = cut(proc + 1) - cut(proc);
     }
-    res[0] = is_ordered1;
-    res[1] = is_ordered2;
+    std::vector<char> local_input(sizes[world.rank()]);
+    if (world.rank() == 0) {
+      boost::mpi::scatterv(world, str.data(), sizes, displs, local_input.data(), sizes[0], 0);
+    } else {
+      boost::mpi::scatterv(world, local_input.data(), sizes[world.rank()], 0);
+    }
+    if (!IsOrdered(local_input.data(), local_input.size())) local_res[s] = 0;
   }
+
+  boost::mpi::reduce(world, local_res.data(), 2, res.data(), std::logical_and<int>(), 0);
   return true;
 }
 
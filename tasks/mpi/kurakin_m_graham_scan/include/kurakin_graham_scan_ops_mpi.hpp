@@ -10,12 +10,15 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/geometry/include/geometry.hpp"
 
 namespace kurakin_m_graham_scan_mpi {
 
-bool isLeftAngle(std::vector<double>& p1, std::vector<double>& p2, std::vector<double>& p3);
+using Point = ppc::util::Point2<double>;
 
-int grahamScan(std::vector<std::vector<double>>& input_);
+// Hull including points in the middle of its edges, counter-clockwise from the lowest point (the rightmost
+// of equally low ones)
+std::vector<Point> grahamScan(const std::vector<Point>& points);
 
 int getCountPoint(int count_point, int size, int rank);
 
@@ -29,8 +32,7 @@ class TestMPITaskSequential : public ppc::core::Task {
 
  private:
   int count_point{};
-  std::vector<std::vector<double>> input_;
-  std::vector<double> res;
+  std::vector<Point> input_;
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -44,10 +46,7 @@ class TestMPITaskParallel : public ppc::core::Task {
  private:
   boost::mpi::communicator world;
   int count_point{};
-  std::vector<double> input_;
-  int local_count_point{};
-  std::vector<double> local_input_;
-  std::vector<std::vector<double>> graham_input_;
+  std::vector<Point> hull_;
 };
 
 }  // namespace kurakin_m_graham_scan_mpi
\ No newline at end of file
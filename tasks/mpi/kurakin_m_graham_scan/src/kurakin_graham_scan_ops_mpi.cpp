@@ -1,36 +1,24 @@
 #include "mpi/kurakin_m_graham_scan/include/kurakin_graham_scan_ops_mpi.hpp"
 
 #include <algorithm>
-#include <cmath>
-#include <functional>
-#include <random>
-#include <thread>
 #include <vector>
 
-bool kurakin_m_graham_scan_mpi::isLeftAngle(std::vector<double>& p1, std::vector<double>& p2, std::vector<double>& p3) {
-  return ((p2[0] - p1[0]) * (p3[1] - p1[1]) - (p3[0] - p1[0]) * (p2[1] - p1[1])) < 0;
-}
-
-int kurakin_m_graham_scan_mpi::grahamScan(std::vector<std::vector<double>>& input_) {
-  int count_point = input_.size();
-  int ind_min_y = std::min_element(input_.begin(), input_.end(),
-                                   [&](std::vector<double> a, std::vector<double> b) {
-                                     return a[1] < b[1] || (a[1] == b[1] && a[0] > b[0]);
-                                   }) -
-                  input_.begin();
-  std::swap(input_[0], input_[ind_min_y]);
-  std::sort(input_.begin() + 1, input_.end(),
-            [&](std::vector<double> a, std::vector<double> b) { return isLeftAngle(a, input_[0], b); });
-
-  int k = 1;
-  for (int i = 2; i < count_point; i++) {
-    while (k > 0 && isLeftAngle(input_[k - 1], input_[k], input_[i])) {
-      k--;
-    }
-    std::swap(input_[i], input_[k + 1]);
-    k++;
+std::vector<kurakin_m_graham_scan_mpi::Point> kurakin_m_graham_scan_mpi::grahamScan(const std::vector<Point>& points) {
+  // Interior points never reach the scan; Andrew's monotone chain is the Graham scan over x-sorted points
+  auto candidates = ppc::util::akl_toussaint(points);
+  auto hull = ppc::util::monotone_chain(candidates, true);
+  auto start = std::min_element(hull.begin(), hull.end(),
+                                [](const Point& a, const Point& b) { return a.y < b.y || (a.y == b.y && a.x > b.x); });
+  std::rotate(hull.begin(), start, hull.end());
+
+  // Repeated input points stay in the answer, each copy next to the others
+  std::sort(candidates.begin(), candidates.end(), ppc::util::lex_less<double>);
+  std::vector<Point> res;
+  for (const auto& p : hull) {
+    auto [first, last] = std::equal_range(candidates.begin(), candidates.end(), p, ppc::util::lex_less<double>);
+    res.insert(res.end(), first, last);
   }
-  return k + 1;
+  return res;
 }
 
 int kurakin_m_graham_scan_mpi::getCountPoint(int count_point, int size, int rank) {
@@ -48,12 +36,8 @@ bool kurakin_m_graham_scan_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
 
   count_point = (int)taskData->inputs_count[0] / 2;
-  input_ = std::vector<std::vector<double>>(count_point, std::vector<double>(2, 0));
-  auto* tmp_ptr = reinterpret_cast<double*>(taskData->inputs[0]);
-  for (int i = 0; i < count_point * 2; i += 2) {
-    input_[i / 2][0] = tmp_ptr[i];
-    input_[i / 2][1] = tmp_ptr[i + 1];
-  }
+  auto* tmp_ptr = reinterpret_cast<Point*>(taskData->inputs[0]);
+  input_.assign(tmp_ptr, tmp_ptr + count_point);
 
   return true;
 }
@@ -69,7 +53,8 @@ bool kurakin_m_graham_scan_mpi::TestMPITaskSequential::validation() {
 bool kurakin_m_graham_scan_mpi::TestMPITaskSequential::run() {
   internal_order_test();
 
-  count_point = grahamScan(input_);
+  input_ = grahamScan(input_);
+  count_point = static_cast<int>(input_.size());
 
   return true;
 }
@@ -78,10 +63,7 @@ bool kurakin_m_graham_scan_mpi::TestMPITaskSequential::post_processing() {
   internal_order_test();
 
   reinterpret_cast<int*>(taskData->outputs[0])[0] = count_point;
-  for (int i = 0; i < count_point * 2; i += 2) {
-    reinterpret_cast<double*>(taskData->outputs[1])[i] = input_[i / 2][0];
-    reinterpret_cast<double*>(taskData->outputs[1])[i + 1] = input_[i / 2][1];
-  }
+  std::copy(input_.begin(), input_.end(), reinterpret_cast<Point*>(taskData->outputs[1]));
 
   return true;
 }
@@ -107,76 +89,36 @@ bool kurakin_m_graham_scan_mpi::TestMPITaskParallel::validation() {
 bool kurakin_m_graham_scan_mpi::TestMPITaskParallel::run() {
   internal_order_test();
 
-  if (world.rank() == 0) {
-    count_point = (int)taskData->inputs_count[0] / 2;
-    input_ = std::vector<double>((int)taskData->inputs_count[0]);
-    auto* tmp_ptr = reinterpret_cast<double*>(taskData->inputs[0]);
-    for (int i = 0; i < count_point * 2; i += 2) {
-      input_[i] = tmp_ptr[i];
-      input_[i + 1] = tmp_ptr[i + 1];
-    }
-  }
+  if (world.rank() == 0) count_point = (int)taskData->inputs_count[0] / 2;
   broadcast(world, count_point, 0);
 
+  // Points travel as coordinate pairs; the hull of the local hulls is the hull of all points
+  std::vector<int> sizes(world.size());
+  for (int i = 0; i < world.size(); i++) sizes[i] = getCountPoint(count_point, world.size(), i) * 2;
+  std::vector<Point> local(sizes[world.rank()] / 2);
   if (world.rank() == 0) {
-    local_count_point = getCountPoint(count_point, world.size(), world.rank());
-    local_input_ = std::vector<double>(input_.begin(), input_.begin() + local_count_point * 2);
-
-    int sum_next_count_point = local_count_point;
-    for (int i = 1; i < world.size(); i++) {
-      int next_count_point = getCountPoint(count_point, world.size(), i);
-      if (next_count_point != 0) {
-        world.send(i, 0, input_.data() + sum_next_count_point * 2, next_count_point * 2);
-      }
-      sum_next_count_point += next_count_point;
-    }
+    std::vector<int> displs(world.size(), 0);
+    for (int i = 1; i < world.size(); i++) displs[i] = displs[i - 1] + sizes[i - 1];
+    boost::mpi::scatterv(world, reinterpret_cast<double*>(taskData->inputs[0]), sizes, displs,
+                         reinterpret_cast<double*>(local.data()), sizes[0], 0);
   } else {
-    local_count_point = getCountPoint(count_point, world.size(), world.rank());
-    if (local_count_point != 0) {
-      local_input_ = std::vector<double>(local_count_point * 2);
-      world.recv(0, 0, local_input_.data(), local_count_point * 2);
-    }
-  }
-
-  if (local_count_point != 0) {
-    graham_input_ = std::vector<std::vector<double>>(local_count_point, std::vector<double>(2, 0));
-    for (int i = 0; i < local_count_point * 2; i += 2) {
-      graham_input_[i / 2][0] = local_input_[i];
-      graham_input_[i / 2][1] = local_input_[i + 1];
-    }
-    local_count_point = grahamScan(graham_input_);
-    for (int i = 0; i < local_count_point * 2; i += 2) {
-      local_input_[i] = graham_input_[i / 2][0];
-      local_input_[i + 1] = graham_input_[i / 2][1];
-    }
+    boost::mpi::scatterv(world, reinterpret_cast<double*>(local.data()), sizes[world.rank()], 0);
   }
+  if (!local.empty()) local = grahamScan(local);
 
+  int local_size = static_cast<int>(local.size()) * 2;
   if (world.rank() == 0) {
-    std::copy(local_input_.begin(), local_input_.begin() + local_count_point * 2, input_.begin());
-    int sum_next_count_point = local_count_point;
-    for (int i = 1; i < world.size(); i++) {
-      int next_count_point;
-      world.recv(i, 0, &next_count_point, 1);
-      if (next_count_point != 0) {
-        world.recv(i, 0, input_.data() + sum_next_count_point * 2, next_count_point * 2);
-      }
-      sum_next_count_point += next_count_point;
-    }
-    local_count_point = sum_next_count_point;
+    boost::mpi::gather(world, local_size, sizes, 0);
+    std::vector<int> displs(world.size(), 0);
+    for (int i = 1; i < world.size(); i++) displs[i] = displs[i - 1] + sizes[i - 1];
+    std::vector<Point> candidates((displs.back() + sizes.back()) / 2);
+    boost::mpi::gatherv(world, reinterpret_cast<double*>(local.data()), local_size,
+                        reinterpret_cast<double*>(candidates.data()), sizes, displs, 0);
+    hull_ = grahamScan(candidates);
+    count_point = static_cast<int>(hull_.size());
   } else {
-    world.send(0, 0, &local_count_point, 1);
-    if (local_count_point != 0) {
-      world.send(0, 0, local_input_.data(), local_count_point * 2);
-    }
-  }
-
-  if (world.rank() == 0) {
-    graham_input_ = std::vector<std::vector<double>>(local_count_point, std::vector<double>(2, 0));
-    for (int i = 0; i < local_count_point * 2; i += 2) {
-      graham_input_[i / 2][0] = input_[i];
-      graham_input_[i / 2][1] = input_[i + 1];
-    }
-    count_point = grahamScan(graham_input_);
+    boost::mpi::gather(world, local_size, 0);
+    boost::mpi::gatherv(world, reinterpret_cast<double*>(local.data()), local_size, 0);
   }
 
   return true;
@@ -187,10 +129,7 @@ bool kurakin_m_graham_scan_mpi::TestMPITaskParallel::post_processing() {
 
   if (world.rank() == 0) {
     reinterpret_cast<int*>(taskData->outputs[0])[0] = count_point;
-    for (int i = 0; i < count_point * 2; i += 2) {
-      reinterpret_cast<double*>(taskData->outputs[1])[i] = graham_input_[i / 2][0];
-      reinterpret_cast<double*>(taskData->outputs[1])[i + 1] = graham_input_[i / 2][1];
-    }
+    std::copy(hull_.begin(), hull_.end(), reinterpret_cast<Point*>(taskData->outputs[1]));
   }
 
   return true;
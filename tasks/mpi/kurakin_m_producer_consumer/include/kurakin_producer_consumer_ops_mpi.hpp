@@ -1,12 +1,13 @@
 #pragma once
 
 #include <gtest/gtest.h>
+#include <mpi.h>
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <memory>
 #include <numeric>
-#include <queue>
 #include <string>
 #include <utility>
 #include <vector>
@@ -17,6 +18,43 @@ namespace kurakin_m_producer_consumer_mpi {
 
 int getRandomInt(int start, int end);
 
+// Bounded ring of items in an MPI window on rank 0, shared by all ranks without a manager process. Producers and
+// consumers take tickets with one atomic fetch-and-add per batch; ticket t uses slot t % capacity, whose
+// sequence number tells whose turn it is: 2t while it is free for the writer of t, 2t + 1 while it holds the item
+// of t, 2 (t + capacity) once read. Constructing and destroying the ring is collective.
+class RmaRing {
+ public:
+  static constexpr int kTail = 0;  // next ticket for producers
+  static constexpr int kHead = 1;  // next ticket for consumers
+
+  RmaRing(MPI_Comm comm, int64_t capacity);
+  ~RmaRing();
+  RmaRing(const RmaRing&) = delete;
+  RmaRing& operator=(const RmaRing&) = delete;
+
+  // First of n consecutive tickets taken from the counter kTail or kHead
+  int64_t claim(int counter, int64_t n);
+  // Writes (reads) the items of the tickets from ticket on whose slots are ready, up to n and at most to the end
+  // of the ring; returns how many. Each call is one batch of a few round trips to rank 0, whatever its size.
+  int64_t push(int64_t ticket, const int64_t* items, int64_t n);
+  int64_t pop(int64_t ticket, int64_t* items, int64_t n);
+  // Called between attempts that made no progress: lets the other processes run and serves their operations on
+  // this rank's window, which some one-sided implementations only process inside MPI calls to other ranks
+  void idle();
+
+ private:
+  // Reads the sequences of count slots from slot on; returns for how many in a row the ticket's turn has come,
+  // ready being 0 for writers and 1 for readers
+  int64_t ready_run(int64_t ticket, int64_t ready, int64_t slot, int64_t count);
+  void publish(int64_t ticket, int64_t handed, int64_t slot, int64_t count);
+
+  int64_t capacity_;
+  MPI_Comm comm_;
+  MPI_Win win_{};
+  int64_t* base_ = nullptr;
+  std::vector<int64_t> sequences_;
+};
+
 class TestMPITaskParallel : public ppc::core::Task {
  public:
   explicit TestMPITaskParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
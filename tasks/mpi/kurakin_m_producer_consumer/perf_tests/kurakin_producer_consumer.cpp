@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <boost/mpi/timer.hpp>
+#include <numeric>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
@@ -15,8 +16,8 @@ TEST(kurakin_m_producer_consumer_mpi_perf_test, test_pipeline_run) {
 
   if (world.rank() == 0) {
     int producer_count = world.size() / 2;
-    int buffer_size = producer_count;
-    data_counts = std::vector<int>(producer_count, 1);
+    int buffer_size = 256;
+    data_counts = std::vector<int>(producer_count, 20000);
 
     taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(data_counts.data()));
     taskDataPar->inputs_count.emplace_back(data_counts.size());
@@ -46,7 +47,7 @@ TEST(kurakin_m_producer_consumer_mpi_perf_test, test_pipeline_run) {
   perfAnalyzer->pipeline_run(perfAttr, perfResults);
   if (world.rank() == 0) {
     ppc::core::Perf::print_perf_statistic(perfResults);
-    ASSERT_EQ(data_counts.size(), (size_t)data_counts_sum[0]);
+    ASSERT_EQ(std::accumulate(data_counts.begin(), data_counts.end(), 0), data_counts_sum[0]);
   }
 }
 
@@ -59,8 +60,8 @@ TEST(kurakin_m_producer_consumer_mpi_perf_test, test_task_run) {
 
   if (world.rank() == 0) {
     int producer_count = world.size() / 2;
-    int buffer_size = producer_count;
-    data_counts = std::vector<int>(producer_count, 1);
+    int buffer_size = 256;
+    data_counts = std::vector<int>(producer_count, 20000);
 
     taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(data_counts.data()));
     taskDataPar->inputs_count.emplace_back(data_counts.size());
@@ -90,6 +91,46 @@ TEST(kurakin_m_producer_consumer_mpi_perf_test, test_task_run) {
   perfAnalyzer->task_run(perfAttr, perfResults);
   if (world.rank() == 0) {
     ppc::core::Perf::print_perf_statistic(perfResults);
-    ASSERT_EQ(data_counts.size(), (size_t)data_counts_sum[0]);
+    ASSERT_EQ(std::accumulate(data_counts.begin(), data_counts.end(), 0), data_counts_sum[0]);
+  }
+}
+
+// The extreme producer:consumer ratios on 40000 items; items per second are 40000 over the printed time
+TEST(kurakin_m_producer_consumer_mpi_perf_test, test_task_run_ratios) {
+  boost::mpi::communicator world;
+  if (world.size() < 3) {
+    GTEST_SKIP();
+  }
+  for (int producer_count : {1, world.size() - 1}) {
+    std::vector<int> data_counts;
+    std::vector<int32_t> data_counts_sum(1, 0);
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      data_counts = std::vector<int>(producer_count, 40000 / producer_count);
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(data_counts.data()));
+      taskDataPar->inputs_count.emplace_back(data_counts.size());
+      taskDataPar->inputs_count.emplace_back(producer_count);
+      taskDataPar->inputs_count.emplace_back(256);
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(data_counts_sum.data()));
+      taskDataPar->outputs_count.emplace_back(data_counts_sum.size());
+    }
+
+    auto testMpiTaskParallel = std::make_shared<kurakin_m_producer_consumer_mpi::TestMPITaskParallel>(taskDataPar);
+    ASSERT_EQ(testMpiTaskParallel->validation(), true);
+    testMpiTaskParallel->pre_processing();
+    testMpiTaskParallel->run();
+    testMpiTaskParallel->post_processing();
+
+    auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+    perfAttr->num_running = 10;
+    const boost::mpi::timer current_timer;
+    perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+    auto perfResults = std::make_shared<ppc::core::PerfResults>();
+    auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testMpiTaskParallel);
+    perfAnalyzer->task_run(perfAttr, perfResults);
+    if (world.rank() == 0) {
+      ppc::core::Perf::print_perf_statistic(perfResults);
+      ASSERT_EQ(std::accumulate(data_counts.begin(), data_counts.end(), 0), data_counts_sum[0]);
+    }
   }
 }
@@ -2,7 +2,7 @@
 
 #include <algorithm>
 #include <functional>
-#include <queue>
+#include <numeric>
 #include <random>
 #include <string>
 #include <thread>
@@ -32,141 +32,144 @@ bool kurakin_m_producer_consumer_mpi::TestMPITaskParallel::validation() {
   return true;
 }
 
-bool kurakin_m_producer_consumer_mpi::TestMPITaskParallel::run() {
-  internal_order_test();
-  int producer_count;
-  res = 0;
-
-  if (world.rank() == 0) {
-    producer_count = taskData->inputs_count[1];
+kurakin_m_producer_consumer_mpi::RmaRing::RmaRing(MPI_Comm comm, int64_t capacity) : capacity_(capacity), comm_(comm) {
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+  // Layout on rank 0: the two ticket counters, the sequences of the slots, the items of the slots
+  const int64_t words = rank == 0 ? 2 + 2 * capacity_ : 0;
+  MPI_Win_allocate(static_cast<MPI_Aint>(words * sizeof(int64_t)), sizeof(int64_t), MPI_INFO_NULL, comm, &base_,
+                   &win_);
+  if (rank == 0) {
+    MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, win_);
+    base_[kTail] = 0;
+    base_[kHead] = 0;
+    for (int64_t i = 0; i < capacity_; i++) base_[2 + i] = 2 * i;
+    MPI_Win_unlock(0, win_);
   }
-  boost::mpi::broadcast(world, producer_count, 0);
-
-  if (world.rank() == 0) {
-    input_ = std::vector<int>(taskData->inputs_count[0]);
-    auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+  MPI_Barrier(comm);
+  MPI_Win_lock_all(0, win_);
+}
 
-    int data_count = input_[0];
-    for (int i = 1; i < producer_count; i++) {
-      int input = input_[i];
-      world.send(i, 0, &input, 1);
-    }
+kurakin_m_producer_consumer_mpi::RmaRing::~RmaRing() {
+  MPI_Win_unlock_all(win_);
+  MPI_Win_free(&win_);
+}
 
-    int buffer_size = taskData->inputs_count[2];
-    // int producer_count = taskData->inputs_count[1];
-    int consumer_count = world.size() - producer_count;
+void kurakin_m_producer_consumer_mpi::RmaRing::idle() {
+  int flag;
+  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm_, &flag, MPI_STATUS_IGNORE);
+  std::this_thread::yield();
+}
 
-    // buffer and producer with rank 0
-    std::queue<int> buffer;
-    std::queue<int> producer;
-    std::queue<int> producer_exit;
-    std::queue<int> consumer;
+int64_t kurakin_m_producer_consumer_mpi::RmaRing::claim(int counter, int64_t n) {
+  int64_t first;
+  MPI_Fetch_and_op(&n, &first, MPI_INT64_T, 0, counter, MPI_SUM, win_);
+  MPI_Win_flush(0, win_);
+  return first;
+}
 
-    int data_0 = 0;
-    while (true) {
-      if (data_count > 0) {
-        data_0 = getRandomInt();
-        producer.push(0);
-        data_count--;
-      } else if (data_count == 0) {
-        producer_count--;
-        data_count--;
-      }
-      std::vector<int> message_bw(2);
-      world.recv(boost::mpi::any_source, 0, message_bw.data(), 2);
-      if (message_bw[1] == 0) {  // exit producer
-        producer_count--;
-        producer_exit.push(message_bw[0]);
-      } else if (message_bw[1] == 1) {  // want put producer
-        producer.push(message_bw[0]);
-      } else if (message_bw[1] == 2) {  // wand get comsumer
-        consumer.push(message_bw[0]);
-      }
-      while (buffer.size() < (size_t)buffer_size && !producer.empty()) {
-        int producer_rank = producer.front();
-        producer.pop();
-        int data = 0;
-        if (producer_rank != 0) {
-          world.send(producer_rank, 0, &data, 1);
-          world.recv(producer_rank, 0, &data, 1);
-        } else {
-          data = data_0;
-        }
-        buffer.push(data);
-      }
-      while (!buffer.empty() && !consumer.empty()) {
-        int consumer_rank = consumer.front();
-        consumer.pop();
-        int data = buffer.front();
-        buffer.pop();
-        std::vector<int> message_fw = {data, 2};
-        world.send(consumer_rank, 0, message_fw.data(), 2);
-      }
-      if (producer_count == 0 && buffer.empty() && consumer.size() == (size_t)consumer_count) {
-        while (!consumer.empty()) {
-          int consumer_rank = consumer.front();
-          consumer.pop();
-          std::vector<int> message_fw = {0, 0};
-          world.send(consumer_rank, 0, message_fw.data(), 2);
-        }
-        while (!producer_exit.empty()) {
-          int producer_rank = producer_exit.front();
-          producer_exit.pop();
-          int message_fw = 0;
-          world.send(producer_rank, 0, &message_fw, 1);
-        }
-        break;
-      }
-    }
+int64_t kurakin_m_producer_consumer_mpi::RmaRing::ready_run(int64_t ticket, int64_t ready, int64_t slot,
+                                                            int64_t count) {
+  // Sequences change under concurrent accumulates, so they are read atomically as well
+  sequences_.resize(count);
+  MPI_Get_accumulate(nullptr, 0, MPI_INT64_T, sequences_.data(), static_cast<int>(count), MPI_INT64_T, 0, 2 + slot,
+                     static_cast<int>(count), MPI_INT64_T, MPI_NO_OP, win_);
+  MPI_Win_flush(0, win_);
+  int64_t run = 0;
+  while (run < count && sequences_[run] == 2 * (ticket + run) + ready) run++;
+  return run;
+}
 
-    reduce(world, 0, res, std::plus(), 0);
-  } else if (world.rank() < producer_count) {  // producer
-    int data_count;
-    world.recv(0, 0, &data_count, 1);
+void kurakin_m_producer_consumer_mpi::RmaRing::publish(int64_t ticket, int64_t handed, int64_t slot,
+                                                      int64_t count) {
+  sequences_.resize(count);
+  for (int64_t i = 0; i < count; i++) sequences_[i] = 2 * (ticket + i) + handed;
+  MPI_Accumulate(sequences_.data(), static_cast<int>(count), MPI_INT64_T, 0, 2 + slot, static_cast<int>(count),
+                 MPI_INT64_T, MPI_REPLACE, win_);
+  MPI_Win_flush(0, win_);
+}
 
-    for (int i = 0; i < data_count; i++) {
-      int data = getRandomInt();
-      std::vector<int> message_fw = {world.rank(), 1};
-      world.send(0, 0, message_fw.data(), 2);
+int64_t kurakin_m_producer_consumer_mpi::RmaRing::push(int64_t ticket, const int64_t* items, int64_t n) {
+  const int64_t slot = ticket % capacity_;
+  const int64_t run = ready_run(ticket, 0, slot, std::min(n, capacity_ - slot));
+  if (run == 0) return 0;
+  // The items must have landed before the sequences hand the slots to the consumers
+  MPI_Put(items, static_cast<int>(run), MPI_INT64_T, 0, 2 + capacity_ + slot, static_cast<int>(run), MPI_INT64_T,
+          win_);
+  MPI_Win_flush(0, win_);
+  publish(ticket, 1, slot, run);
+  return run;
+}
 
-      int get_put;
-      world.recv(0, 0, &get_put, 1);
-      world.send(0, 0, &data, 1);
+int64_t kurakin_m_producer_consumer_mpi::RmaRing::pop(int64_t ticket, int64_t* items, int64_t n) {
+  const int64_t slot = ticket % capacity_;
+  const int64_t run = ready_run(ticket, 1, slot, std::min(n, capacity_ - slot));
+  if (run == 0) return 0;
+  MPI_Get(items, static_cast<int>(run), MPI_INT64_T, 0, 2 + capacity_ + slot, static_cast<int>(run), MPI_INT64_T,
+          win_);
+  MPI_Win_flush(0, win_);
+  publish(ticket, 2 * capacity_, slot, run);
+  return run;
+}
 
-      int x = getRandomInt(1, 5);
-      std::this_thread::sleep_for(std::chrono::milliseconds(x));
+bool kurakin_m_producer_consumer_mpi::TestMPITaskParallel::run() {
+  internal_order_test();
+  // Producers are the ranks below producer_count, rank 0 included; everyone else consumes. Items go through the
+  // ring on rank 0 directly, so no rank has to relay them.
+  int producer_count;
+  int buffer_size;
+  std::vector<int> counts;
+  if (world.rank() == 0) {
+    producer_count = taskData->inputs_count[1];
+    buffer_size = taskData->inputs_count[2];
+    auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
+    input_.assign(tmp_ptr, tmp_ptr + taskData->inputs_count[0]);
+    counts.assign(world.size(), 0);
+    std::copy(input_.begin(), input_.end(), counts.begin());
+  }
+  boost::mpi::broadcast(world, producer_count, 0);
+  boost::mpi::broadcast(world, buffer_size, 0);
+  int data_count;
+  boost::mpi::scatter(world, counts, data_count, 0);
+  int64_t total = std::accumulate(counts.begin(), counts.end(), int64_t{0});
+  boost::mpi::broadcast(world, total, 0);
+
+  RmaRing ring(world, buffer_size);
+  // A batch takes a share of the ring, so that all producers (consumers) can have one in flight at once
+  int64_t cnt_data = 0;
+  std::vector<int64_t> batch;
+  if (world.rank() < producer_count) {
+    const int64_t batch_size = std::max(1, buffer_size / producer_count);
+    std::mt19937 gen(std::random_device{}());
+    for (int64_t first = 0; first < data_count; first += batch_size) {
+      batch.resize(std::min<int64_t>(batch_size, data_count - first));
+      for (auto& data : batch) data = static_cast<int64_t>(gen() % 100);
+      const auto size = static_cast<int64_t>(batch.size());
+      const int64_t ticket = ring.claim(RmaRing::kTail, size);
+      for (int64_t done = 0; done < size;) {
+        const int64_t pushed = ring.push(ticket + done, batch.data() + done, size - done);
+        if (pushed == 0) ring.idle();
+        done += pushed;
+      }
     }
-
-    std::vector<int> message = {world.rank(), 0};
-    world.send(0, 0, message.data(), 2);
-
-    int exit;
-    world.recv(0, 0, &exit, 1);
-    reduce(world, 0, res, std::plus(), 0);
-  } else {  // consumer
-    int cnt_data = 0;
-
+  } else {
+    const int64_t batch_size = std::max(1, buffer_size / (world.size() - producer_count));
+    batch.resize(batch_size);
     while (true) {
-      std::vector<int> message_fw = {world.rank(), 2};
-      world.send(0, 0, message_fw.data(), 2);
-
-      std::vector<int> message_bw(2);
-      world.recv(0, 0, message_bw.data(), 2);
-
-      if (message_bw[1] == 0) {
-        break;
+      // Tickets past the total have no items: the consumer that draws one is done
+      const int64_t ticket = ring.claim(RmaRing::kHead, batch_size);
+      if (ticket >= total) break;
+      const int64_t size = std::min(batch_size, total - ticket);
+      for (int64_t done = 0; done < size;) {
+        const int64_t popped = ring.pop(ticket + done, batch.data() + done, size - done);
+        if (popped == 0) ring.idle();
+        done += popped;
       }
-      cnt_data++;
-
-      int x = getRandomInt(1, 5);
-      std::this_thread::sleep_for(std::chrono::milliseconds(x));
+      cnt_data += size;
     }
-
-    reduce(world, cnt_data, res, std::plus(), 0);
   }
+
+  reduce(world, static_cast<int>(cnt_data), res, std::plus(), 0);
   return true;
 }
 
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace lopatin_i_count_words_mpi {
 
@@ -24,7 +25,6 @@ class TestMPITaskSequential : public ppc::core::Task {
  private:
   std::vector<char> input_;
   int wordCount{};
-  int spaceCount{};
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -39,8 +39,6 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::vector<char> input_;
   std::vector<char> localInput_;
   int wordCount{};
-  int spaceCount{};
-  int localSpaceCount{};
   int chunkSize{};
   boost::mpi::communicator world;
 };
@@ -34,12 +34,7 @@ bool TestMPITaskSequential::validation() {
 
 bool TestMPITaskSequential::run() {
   internal_order_test();
-  for (char c : input_) {
-    if (c == ' ') {
-      spaceCount++;
-    }
-  }
-  wordCount = spaceCount + 1;
+  wordCount = static_cast<int>(ppc::util::count_runs(input_.data(), input_.size(), ~ppc::util::ByteClass::of(" ")));
   return true;
 }
 
@@ -72,42 +67,30 @@ bool TestMPITaskParallel::run() {
   unsigned long totalSize = 0;
   if (world.rank() == 0) {
     totalSize = input_.size();
-    chunkSize = taskData->inputs_count[0] / world.size();
   }
-  boost::mpi::broadcast(world, chunkSize, 0);
   boost::mpi::broadcast(world, totalSize, 0);
 
-  unsigned long startPos = world.rank() * chunkSize;
-  unsigned long actualChunkSize = (startPos + chunkSize <= totalSize) ? chunkSize : (totalSize - startPos);
-
-  localInput_.resize(actualChunkSize);
-
+  // Chunks are cut at any byte, remainder included: a word cut in two is joined when the tallies are added
+  std::vector<int> sizes(world.size());
+  std::vector<int> displs(world.size());
+  for (int proc = 0; proc < world.size(); proc++) {
+    displs[proc] = static_cast<int>(totalSize * proc / world.size());
+    sizes[proc] = static_cast<int>(totalSize * (proc + 1) / world.size()) - displs[proc];
+  }
+  chunkSize = sizes[world.rank()];
+  localInput_.resize(chunkSize);
   if (world.rank() == 0) {
-    for (int proc = 1; proc < world.size(); proc++) {
-      unsigned long procStartPos = proc * chunkSize;
-      unsigned long procChunkSize = (procStartPos + chunkSize <= totalSize) ? chunkSize : (totalSize - procStartPos);
-      if (procChunkSize > 0) {
-        world.send(proc, 0, input_.data() + procStartPos, procChunkSize);
-      }
-    }
-    localInput_.assign(input_.begin(), input_.begin() + actualChunkSize);
+    boost::mpi::scatterv(world, input_.data(), sizes, displs, localInput_.data(), chunkSize, 0);
   } else {
-    if (actualChunkSize > 0) {
-      world.recv(0, 0, localInput_.data(), actualChunkSize);
-    }
-  }
-
-  localSpaceCount = 0;
-  for (size_t i = 0; i < localInput_.size(); ++i) {
-    if (localInput_[i] == ' ') {
-      localSpaceCount++;
-    }
+    boost::mpi::scatterv(world, localInput_.data(), chunkSize, 0);
   }
 
-  boost::mpi::reduce(world, localSpaceCount, spaceCount, std::plus<>(), 0);
+  auto localTally = ppc::util::tally_runs(localInput_.data(), localInput_.size(), ~ppc::util::ByteClass::of(" "));
+  ppc::util::RunTally tally;
+  boost::mpi::reduce(world, localTally, tally, std::plus<>(), 0);
 
   if (world.rank() == 0) {
-    wordCount = spaceCount + 1;
+    wordCount = static_cast<int>(tally.count());
   }
   return true;
 }
@@ -2,6 +2,7 @@
 
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <array>
 #include <memory>
 #include <random>
 
@@ -257,4 +258,28 @@ TEST(lysov_i_integration_the_trapezoid_method_mpi, TaskMpi_OutputSizeLessThan1)
     lysov_i_integration_the_trapezoid_method_mpi::TestMPITaskParallel testTaskMPIParallel(taskDataMPIParallel);
     ASSERT_EQ(testTaskMPIParallel.validation(), false);
   }
-}
\ No newline at end of file
+}
+
+TEST(lysov_i_integration_the_trapezoid_method_mpi, Test_Epsilon_Wider_Than_Interval) {
+  boost::mpi::communicator world;
+  // Epsilon wider than the interval leaves one split, fewer than processes; an empty interval integrates to 0
+  for (auto [a, b, expected] : {std::array<double, 3>{0.0, 1.0, 0.5}, std::array<double, 3>{1.0, 1.0, 0.0}}) {
+    double epsilon = 2.0;
+    std::vector<double> global_result(1, -1.0);
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&a));
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&b));
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&epsilon));
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    }
+    lysov_i_integration_the_trapezoid_method_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+    ASSERT_EQ(testMpiTaskParallel.validation(), true);
+    testMpiTaskParallel.pre_processing();
+    testMpiTaskParallel.run();
+    testMpiTaskParallel.post_processing();
+    if (world.rank() == 0) {
+      ASSERT_NEAR(global_result[0], expected, 1e-12);
+    }
+  }
+}
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 
 namespace lysov_i_integration_the_trapezoid_method_mpi {
 
@@ -28,7 +29,6 @@ class TestMPITaskSequential : public ppc::core::Task {
   double static function_square(double x) { return x * x; }
 
  private:
-  std::vector<int> input_;
   double res{};
   std::string ops;
 };
@@ -44,12 +44,12 @@ class TestMPITaskParallel : public ppc::core::Task {
   double b = 0.0;
   double h = 0.0;
   int cnt_of_splits = 0;
-  double local_a;
+  // First subinterval of this rank's block and its length
+  int local_first;
   int local_cnt_of_splits;
   static double function_square(double x) { return x * x; }
 
  private:
-  std::vector<int> input_, local_input_;
   double res;
   std::string ops;
   boost::mpi::communicator world;
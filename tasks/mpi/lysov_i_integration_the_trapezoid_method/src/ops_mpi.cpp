@@ -7,32 +7,22 @@
 
 bool lysov_i_integration_the_trapezoid_method_mpi::TestMPITaskSequential::validation() {
   internal_order_test();
-  return (taskData->inputs.size() == 3 && taskData->outputs.size() == 1);
+  return (taskData->inputs.size() == 3 && taskData->outputs.size() == 1 &&
+          *reinterpret_cast<double*>(taskData->inputs[2]) > 0);
 }
 bool lysov_i_integration_the_trapezoid_method_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
   a = *reinterpret_cast<double*>(taskData->inputs[0]);
   b = *reinterpret_cast<double*>(taskData->inputs[1]);
   epsilon = *reinterpret_cast<double*>(taskData->inputs[2]);
-  cnt_of_splits = static_cast<int>(std::abs((b - a)) / epsilon);
+  cnt_of_splits = std::max(1, static_cast<int>(std::abs((b - a)) / epsilon));
   h = (b - a) / cnt_of_splits;
-  input_.resize(cnt_of_splits + 1);
-  for (int i = 0; i <= cnt_of_splits; ++i) {
-    double x = a + i * h;
-    input_[i] = function_square(x);
-  }
   return true;
 }
 bool lysov_i_integration_the_trapezoid_method_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  double result = 0.0;
-  result += 0.5 * (function_square(a) + function_square(b));
-  for (int i = 1; i < cnt_of_splits; ++i) {
-    double x = a + i * h;
-    result += function_square(x);
-  }
-  result *= h;
-  res = result;
+  res = ppc::util::composite_quadrature([](double x) { return function_square(x); }, a, b,
+                                       static_cast<size_t>(cnt_of_splits), ppc::util::QuadratureRule::kTrapezoid);
   return true;
 }
 bool lysov_i_integration_the_trapezoid_method_mpi::TestMPITaskSequential::post_processing() {
@@ -60,7 +50,7 @@ bool lysov_i_integration_the_trapezoid_method_mpi::TestMPITaskParallel::pre_proc
     a = *reinterpret_cast<double*>(taskData->inputs[0]);
     b = *reinterpret_cast<double*>(taskData->inputs[1]);
     double epsilon = *reinterpret_cast<double*>(taskData->inputs[2]);
-    cnt_of_splits = static_cast<int>(std::abs((b - a)) / epsilon);
+    cnt_of_splits = std::max(1, static_cast<int>(std::abs((b - a)) / epsilon));
   }
 
   boost::mpi::broadcast(world, a, 0);
@@ -72,19 +62,16 @@ bool lysov_i_integration_the_trapezoid_method_mpi::TestMPITaskParallel::pre_proc
   if (world.rank() < cnt_of_splits % world.size()) {
     local_cnt_of_splits++;
   }
-  local_a = a + world.rank() * local_cnt_of_splits * h;
-  local_input_.resize(local_cnt_of_splits + 1);
+  local_first = world.rank() * (cnt_of_splits / world.size()) + std::min(world.rank(), cnt_of_splits % world.size());
   return true;
 }
 bool lysov_i_integration_the_trapezoid_method_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  double local_res = 0.0;
-  local_res += 0.5 * (function_square(local_a) + function_square(local_a + local_cnt_of_splits * h));
-  for (int i = 0; i < local_cnt_of_splits; i++) {
-    double x = local_a + i * h;
-    local_res += function_square(x);
-  }
-  local_res *= h;
+  auto first = static_cast<size_t>(local_first);
+  double local_res =
+      ppc::util::composite_quadrature([](double x) { return function_square(x); }, a, b,
+                                      static_cast<size_t>(cnt_of_splits), ppc::util::QuadratureRule::kTrapezoid,
+                                      first, first + local_cnt_of_splits);
   boost::mpi::reduce(world, local_res, res, std::plus<>(), 0);
   return true;
 }
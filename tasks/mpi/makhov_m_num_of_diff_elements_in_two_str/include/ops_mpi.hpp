@@ -41,7 +41,7 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::string str1{}, str1_local{}, str2{}, str2_local{};
+  std::string str_comb{};
   int sizeDiff{};
   int res{};
   boost::mpi::communicator world;
@@ -2,18 +2,17 @@
 #include "mpi/makhov_m_num_of_diff_elements_in_two_str/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <random>
 #include <string>
+#include <vector>
+
+#include "util/text/include/text.hpp"
 
 int makhov_m_num_of_diff_elements_in_two_str_mpi::countDiffElem(const std::string &str1_, const std::string &str2_) {
-  int count = 0;
-  int sizeDiff = std::abs(((int)str1_.size() - (int)str2_.size()));
-  size_t minSize = std::min(str1_.size(), str2_.size());
-  for (size_t i = 0; i < minSize; i++) {
-    if (str1_[i] != str2_[i]) count++;
-  }
-  return count + sizeDiff;
+  return static_cast<int>(ppc::util::hamming_distance(str1_.data(), str1_.size(), str2_.data(), str2_.size()));
 }
 
 std::string makhov_m_num_of_diff_elements_in_two_str_mpi::getShorterStr(std::string str1_, std::string str2_) {
@@ -51,12 +50,21 @@ bool makhov_m_num_of_diff_elements_in_two_str_mpi::TestMPITaskSequential::post_p
 bool makhov_m_num_of_diff_elements_in_two_str_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
 
-  // Init strings in root
+  // Init strings in root: positions past the shorter string all differ, and the common part is split between the
+  // processes. The part of each process is its slice of the first string followed by the same slice of the second,
+  // so that one scatterv sends both.
   if (world.rank() == 0) {
-    str1 = std::string(reinterpret_cast<char *>(taskData->inputs[0]), taskData->inputs_count[0]);
-    str2 = std::string(reinterpret_cast<char *>(taskData->inputs[1]), taskData->inputs_count[1]);
-    sizeDiff = std::abs((int)(str2.size() - str1.size()));
-    str2 = str2.substr(0, str1.size());
+    const auto *str1_ = reinterpret_cast<char *>(taskData->inputs[0]);
+    const auto *str2_ = reinterpret_cast<char *>(taskData->inputs[1]);
+    const size_t common = std::min(taskData->inputs_count[0], taskData->inputs_count[1]);
+    sizeDiff = std::abs(static_cast<int>(taskData->inputs_count[0]) - static_cast<int>(taskData->inputs_count[1]));
+    str_comb.resize(2 * common);
+    for (int process = 0; process < world.size(); process++) {
+      const size_t begin = common * process / world.size();
+      const size_t end = common * (process + 1) / world.size();
+      std::copy(str1_ + begin, str1_ + end, str_comb.begin() + 2 * begin);
+      std::copy(str2_ + begin, str2_ + end, str_comb.begin() + begin + end);
+    }
 
     // Init value for output
     res = 0;
@@ -75,55 +83,24 @@ bool makhov_m_num_of_diff_elements_in_two_str_mpi::TestMPITaskParallel::validati
 
 bool makhov_m_num_of_diff_elements_in_two_str_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  std::string str_comb;
-  size_t remLen;
-  unsigned int delta = 0;
-  if (world.rank() == 0) {
-    // Get delta
-    if (taskData->inputs_count[0] % world.size() == 0)
-      delta = taskData->inputs_count[0] / world.size();
-    else
-      delta = taskData->inputs_count[0] / world.size() + 1;
-  }
-  broadcast(world, delta, 0);
+  uint64_t common = str_comb.size() / 2;
+  broadcast(world, common, 0);
+  auto begin = [&](int process) { return static_cast<int>(common * process / world.size()); };
+  const int delta = begin(world.rank() + 1) - begin(world.rank());
+  std::string str_comb_local(2 * delta, ' ');
   if (world.rank() == 0) {
-    // Sending each process a string consisting of delta-long parts of the two original strings
-    std::string EmptStr((size_t)(delta * 2), ' ');
-    for (int process = 1; process < world.size(); process++) {
-      if (((int)str1.size() - process * delta) >= 0)
-        remLen = (size_t)((int)str1.size() - process * delta);
-      else
-        remLen = 0;
-
-      if (remLen >= (size_t)(delta)) {
-        str_comb = str1.substr((size_t)(process * delta), (size_t)(delta)) +
-                   str2.substr((size_t)(process * delta), (size_t)(delta));
-        world.send(process, 0, str_comb.data(), delta * 2);
-      } else if (remLen > 0) {
-        while (remLen < delta) {
-          str1 += ' ';
-          str2 += ' ';
-          remLen++;
-        }
-        str_comb = str1.substr((size_t)(process * delta), delta) + str2.substr((size_t)(process * delta), delta);
-        world.send(process, 0, str_comb.data(), delta * 2);
-      } else
-        world.send(process, 0, EmptStr.data(), delta * 2);
+    std::vector<int> sizes(world.size());
+    std::vector<int> displs(world.size());
+    for (int process = 0; process < world.size(); process++) {
+      sizes[process] = 2 * (begin(process + 1) - begin(process));
+      displs[process] = 2 * begin(process);
     }
-  }
-
-  if (world.rank() == 0) {
-    str1_local = str1.substr(0, delta);
-    str2_local = str2.substr(0, delta);
+    scatterv(world, str_comb.data(), sizes, displs, str_comb_local.data(), 2 * delta, 0);
   } else {
-    std::string buffer;
-    buffer.resize((size_t)(delta * 2));
-    world.recv(0, 0, buffer.data(), delta * 2);
-    std::string str_comb_local = std::string(buffer.data(), (size_t)(delta * 2));
-    str1_local = str_comb_local.substr(0, (size_t)(delta));
-    str2_local = str_comb_local.substr((size_t)(delta), (size_t)(delta));
+    scatterv(world, str_comb_local.data(), 2 * delta, 0);
   }
-  int local_res = countDiffElem(str1_local, str2_local);
+  const char *part1 = str_comb_local.data();
+  int local_res = static_cast<int>(ppc::util::count_mismatches(part1, part1 + delta, delta));
   reduce(world, local_res, res, std::plus(), 0);
   return true;
 }
@@ -7,7 +7,8 @@ namespace malyshev_v_monte_carlo_integration {
 
 bool TestMPITaskSequential::validation() {
   internal_order_test();
-  return (taskData->inputs.size() == 3 && taskData->outputs.size() == 1);
+  return (taskData->inputs.size() == 3 && taskData->outputs.size() == 1 &&
+          *reinterpret_cast<double*>(taskData->inputs[2]) > 0);
 }
 
 bool TestMPITaskSequential::pre_processing() {
@@ -25,14 +26,7 @@ bool TestMPITaskSequential::pre_processing() {
 
 bool TestMPITaskSequential::run() {
   internal_order_test();
-  double h = (b - a) / num_samples;
-  double sum = (function(a) + function(b)) / 2.0;
-
-  for (int i = 1; i < num_samples; ++i) {
-    sum += function(a + i * h);
-  }
-
-  res = h * sum;
+  res = ppc::util::composite_quadrature(function, a, b, num_samples, ppc::util::QuadratureRule::kTrapezoid);
   return true;
 }
 
@@ -72,25 +66,19 @@ bool TestMPITaskParallel::pre_processing() {
   boost::mpi::broadcast(world, a, 0);
   boost::mpi::broadcast(world, b, 0);
   boost::mpi::broadcast(world, num_samples, 0);
-  local_num_samples = num_samples / world.size();
+  // Each rank takes a contiguous block of the trapezoids, so the remainder is no longer dropped
+  size_t n = num_samples;
+  local_num_samples = static_cast<int>(n * (world.rank() + 1) / world.size() - n * world.rank() / world.size());
   return true;
 }
 
 bool TestMPITaskParallel::run() {
   internal_order_test();
-  double h = (b - a) / num_samples;
-  double local_sum = 0.0;
-
-  for (int i = world.rank() * local_num_samples; i < (world.rank() + 1) * local_num_samples; ++i) {
-    double x = a + i * h;
-    local_sum += function(x);
-  }
-
-  if (world.rank() == 0) {
-    local_sum += (function(a) + function(b)) / 2.0;
-  }
-
-  local_sum *= h;
+  size_t n = num_samples;
+  size_t first = n * world.rank() / world.size();
+  size_t last = first + local_num_samples;
+  double local_sum =
+      ppc::util::composite_quadrature(function, a, b, n, ppc::util::QuadratureRule::kTrapezoid, first, last);
   boost::mpi::reduce(world, local_sum, res, std::plus<>(), 0);
   return true;
 }
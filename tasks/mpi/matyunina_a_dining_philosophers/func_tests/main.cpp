@@ -93,3 +93,39 @@ TEST(matyunina_a_dining_philosophers_mpi, they_eat_once) {
     }
   }
 }
+
+TEST(matyunina_a_dining_philosophers_mpi, report_counts_every_meal) {
+  boost::mpi::communicator world;
+  std::vector<int> global_vec(1, 4);
+  std::vector<int32_t> average_value(1, 0);
+  ppc::util::ContentionReport report;
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
+    taskDataPar->inputs_count.emplace_back(global_vec.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(average_value.data()));
+    taskDataPar->outputs_count.emplace_back(average_value.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(&report));
+    taskDataPar->outputs_count.emplace_back(1);
+  }
+
+  matyunina_a_dining_philosophers_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+  if (world.size() < 3) {
+    if (world.rank() == 0) {
+      ASSERT_EQ(testMpiTaskParallel.validation(), false);
+    }
+  } else {
+    ASSERT_EQ(testMpiTaskParallel.validation(), true);
+    testMpiTaskParallel.pre_processing();
+    testMpiTaskParallel.run();
+    testMpiTaskParallel.post_processing();
+    if (world.rank() == 0) {
+      ASSERT_EQ(report.served.size(), static_cast<size_t>(world.size() - 1));
+      EXPECT_EQ(report.total_served(), static_cast<uint64_t>(global_vec[0] * (world.size() - 1)));
+      EXPECT_EQ(report.starved(), 0u);
+      EXPECT_EQ(report.all_waits().count(), report.total_served());
+      EXPECT_GT(report.throughput(), 0);
+    }
+  }
+}
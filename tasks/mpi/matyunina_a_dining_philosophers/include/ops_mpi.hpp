@@ -5,6 +5,7 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -12,6 +13,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/contention/include/contention.hpp"
 
 namespace matyunina_a_dining_philosophers_mpi {
 
@@ -27,6 +29,11 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::vector<int> input_;
   int nom;
   int res_{};
+  // For an optional second output, a ppc::util::ContentionReport on rank 0: every meal's wait from the first
+  // request to holding both forks
+  ppc::util::WaitHistogram waits;
+  uint64_t meals = 0;
+  double seconds = 0;
   boost::mpi::communicator world;
 };
 
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 
 #include <boost/mpi/timer.hpp>
+#include <iostream>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
@@ -56,6 +57,7 @@ TEST(matyunina_a_dining_philosophers_mpi, test_2) {
   boost::mpi::communicator world;
   std::vector<int> global_vec(1, 1);
   std::vector<int32_t> average_value(1, 0);
+  ppc::util::ContentionReport report;
   // Create TaskData
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
   if (world.rank() == 0) {
@@ -63,6 +65,8 @@ TEST(matyunina_a_dining_philosophers_mpi, test_2) {
     taskDataPar->inputs_count.emplace_back(global_vec.size());
     taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(average_value.data()));
     taskDataPar->outputs_count.emplace_back(average_value.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(&report));
+    taskDataPar->outputs_count.emplace_back(1);
   }
 
   auto testMpiTaskParallel = std::make_shared<matyunina_a_dining_philosophers_mpi::TestMPITaskParallel>(taskDataPar);
@@ -94,6 +98,11 @@ TEST(matyunina_a_dining_philosophers_mpi, test_2) {
     if (world.rank() == 0) {
       ppc::core::Perf::print_perf_statistic(perfResults);
       ASSERT_EQ(global_vec[0] * (world.size() - 1), average_value[0]);
+      // The last run, to compare with kazunin_n_dining_philosophers' protocols
+      auto all = report.all_waits();
+      std::cout << "waiter: " << report.throughput() << " meals/s, wait p50 " << all.quantile(0.5) * 1e3
+                << " ms, p99 " << all.quantile(0.99) * 1e3 << " ms, max " << report.max_wait() * 1e3 << " ms"
+                << std::endl;
     }
   }
 }
\ No newline at end of file
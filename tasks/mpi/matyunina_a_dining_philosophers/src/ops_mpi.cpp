@@ -2,6 +2,7 @@
 #include "mpi/matyunina_a_dining_philosophers/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <random>
 #include <thread>
@@ -12,6 +13,9 @@ using namespace std::chrono_literals;
 bool matyunina_a_dining_philosophers_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
   res_ = 0;
+  waits = {};
+  meals = 0;
+  seconds = 0;
   return true;
 }
 
@@ -25,6 +29,7 @@ bool matyunina_a_dining_philosophers_mpi::TestMPITaskParallel::validation() {
 
 bool matyunina_a_dining_philosophers_mpi::TestMPITaskParallel::run() {
   internal_order_test();
+  auto start = std::chrono::steady_clock::now();
   unsigned int tmp = 0;
   if (world.rank() == 0) {
     input_ = std::vector<int>(taskData->inputs_count[0]);
@@ -208,6 +213,7 @@ bool matyunina_a_dining_philosophers_mpi::TestMPITaskParallel::run() {
       std::random_device rand_dev;
       std::mt19937 rand_engine(rand_dev());
       std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(unif(rand_engine))));
+      auto hungry_since = std::chrono::steady_clock::now();
       while (true) {
         if (wish_eat == 0) {
           int m[4] = {world.rank(), 1, left_hand, right_hand};
@@ -224,6 +230,7 @@ bool matyunina_a_dining_philosophers_mpi::TestMPITaskParallel::run() {
           }
           if (left_hand + right_hand == 2) {
             wish_eat = 1;
+            waits.add(std::chrono::duration<double>(std::chrono::steady_clock::now() - hungry_since).count());
           }
         } else {
           int m[4] = {world.rank(), 2, left_hand, right_hand};
@@ -245,19 +252,32 @@ bool matyunina_a_dining_philosophers_mpi::TestMPITaskParallel::run() {
         }
       }
       quantity_food++;
+      meals++;
       int exit_m[4] = {world.rank(), 3, quantity_food, quantity_food};
       boost::mpi::request send_req = world.isend(0, 3, exit_m, 4);
       send_req.wait();
     }
     world.barrier();
   }
+  seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
   return true;
 }
 
 bool matyunina_a_dining_philosophers_mpi::TestMPITaskParallel::post_processing() {
   internal_order_test();
+  std::vector<ppc::util::WaitHistogram> all_waits;
+  std::vector<uint64_t> all_meals;
+  boost::mpi::gather(world, waits, all_waits, 0);
+  boost::mpi::gather(world, meals, all_meals, 0);
   if (world.rank() == 0) {
     reinterpret_cast<int*>(taskData->outputs[0])[0] = res_;
+    // Rank 0 is the waiter; every other rank a philosopher
+    if (taskData->outputs.size() > 1) {
+      auto* report = reinterpret_cast<ppc::util::ContentionReport*>(taskData->outputs[1]);
+      report->seconds = seconds;
+      report->served.assign(all_meals.begin() + 1, all_meals.end());
+      report->waits.assign(all_waits.begin() + 1, all_waits.end());
+    }
   }
   return true;
 }
@@ -171,3 +171,28 @@ TEST(morozov_e_writers_readers, Test_Main3) {
     ASSERT_EQ(ans[0], 0);
   }
 }
+
+TEST(morozov_e_writers_readers, Test_Main4_Initial_Value_Kept) {
+  boost::mpi::communicator world;
+  std::shared_ptr<ppc::core::TaskData> data = std::make_shared<ppc::core::TaskData>();
+  std::vector<int> vec{7};
+  std::vector<int> ans{0};
+  int countIteration = 1000;
+  int cur_value = 3;
+  if (world.rank() == 0) {
+    data->inputs.emplace_back(reinterpret_cast<uint8_t*>(vec.data()));
+    data->inputs.emplace_back(reinterpret_cast<uint8_t*>(new int{countIteration}));
+    data->inputs.emplace_back(reinterpret_cast<uint8_t*>(new int{cur_value}));
+    data->inputs_count.emplace_back(vec.size());
+    data->outputs.emplace_back(reinterpret_cast<uint8_t*>(ans.data()));
+    data->outputs_count.emplace_back(ans.size());
+  }
+  morozov_e_writers_readers::TestMPITaskParallel obj(data);
+  ASSERT_TRUE(obj.validation());
+  obj.pre_processing();
+  obj.run();
+  obj.post_processing();
+  if (world.rank() == 0) {
+    ASSERT_EQ(ans[0], 7);
+  }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <gtest/gtest.h>
+#include <mpi.h>
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
@@ -27,6 +28,8 @@ class TestMPITaskParallel : public ppc::core::Task {
  private:
   int curValue{};
   boost::mpi::communicator world;
+  MPI_Win win{};
+  int* shared = nullptr;
 };
 
 }  // namespace morozov_e_writers_readers
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace muradov_m_count_alpha_chars_mpi {
 
@@ -29,8 +29,8 @@ bool muradov_m_count_alpha_chars_mpi::AlphaCharCountTaskSequential::validation()
 bool muradov_m_count_alpha_chars_mpi::AlphaCharCountTaskSequential::run() {
   internal_order_test();
 
-  alpha_count_ = std::count_if(input_str_.begin(), input_str_.end(),
-                               [](char c) { return std::isalpha(static_cast<unsigned char>(c)); });
+  alpha_count_ = static_cast<int>(
+      ppc::util::count_class(input_str_.data(), input_str_.size(), ppc::util::ByteClass::ascii_alpha()));
   return true;
 }
 
@@ -91,8 +91,8 @@ bool muradov_m_count_alpha_chars_mpi::AlphaCharCountTaskParallel::run() {
 
   boost::mpi::scatterv(world, input_str_.data(), send_counts, displs, local_input_.data(), loc_vec_size, 0);
 
-  local_alpha_count_ = std::count_if(local_input_.begin(), local_input_.end(),
-                                     [](char c) { return std::isalpha(static_cast<unsigned char>(c)); });
+  local_alpha_count_ = static_cast<int>(
+      ppc::util::count_class(local_input_.data(), local_input_.size(), ppc::util::ByteClass::ascii_alpha()));
 
   boost::mpi::reduce(world, local_alpha_count_, total_alpha_count_, std::plus<>(), 0);
 
@@ -80,4 +80,147 @@ TEST(nasedkin_e_seidels_iterate_methods_mpi, test_random_matrix_10x10) {
   ASSERT_TRUE(seidel_task.pre_processing()) << "Pre-processing failed for random matrix";
   ASSERT_TRUE(seidel_task.run()) << "Run failed for random matrix";
   ASSERT_TRUE(seidel_task.post_processing()) << "Post-processing failed for random matrix";
-}
\ No newline at end of file
+}
+
+TEST(nasedkin_e_seidels_iterate_methods_mpi, test_update_norm_convergence_10x10) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs_count.push_back(10);
+
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI seidel_task(taskData);
+
+  std::vector<std::vector<double>> matrix;
+  std::vector<double> vector;
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::generate_random_matrix(10, matrix, vector);
+  seidel_task.set_matrix(matrix, vector);
+  seidel_task.set_convergence_check(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::UPDATE_NORM);
+
+  ASSERT_TRUE(seidel_task.validation());
+  ASSERT_TRUE(seidel_task.pre_processing());
+  ASSERT_TRUE(seidel_task.run());
+  ASSERT_TRUE(seidel_task.post_processing());
+
+  EXPECT_LT(seidel_task.get_iterations(), 1000);
+  EXPECT_LT(seidel_task.check_residual_norm(), 1e-4);
+}
+
+TEST(nasedkin_e_seidels_iterate_methods_mpi, test_residual_check_every_5_iterations) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs_count.push_back(10);
+
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI seidel_task(taskData);
+
+  std::vector<std::vector<double>> matrix;
+  std::vector<double> vector;
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::generate_random_matrix(10, matrix, vector);
+  seidel_task.set_matrix(matrix, vector);
+  seidel_task.set_convergence_check(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::RESIDUAL, 5);
+
+  ASSERT_TRUE(seidel_task.validation());
+  ASSERT_TRUE(seidel_task.pre_processing());
+  ASSERT_TRUE(seidel_task.run());
+  ASSERT_TRUE(seidel_task.post_processing());
+
+  EXPECT_EQ(seidel_task.get_iterations() % 5, 0);
+  EXPECT_LT(seidel_task.check_residual_norm(), 1e-6);
+}
+
+TEST(nasedkin_e_seidels_iterate_methods_mpi, test_update_norm_and_residual_give_same_solution) {
+  std::vector<std::vector<double>> matrix;
+  std::vector<double> vector;
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::generate_random_matrix(8, matrix, vector);
+
+  auto taskDataResidual = std::make_shared<ppc::core::TaskData>();
+  taskDataResidual->inputs_count.push_back(8);
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI residual_task(taskDataResidual);
+  residual_task.set_matrix(matrix, vector);
+  residual_task.set_convergence_check(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::RESIDUAL);
+  ASSERT_TRUE(residual_task.validation());
+  ASSERT_TRUE(residual_task.pre_processing());
+  ASSERT_TRUE(residual_task.run());
+
+  auto taskDataUpdate = std::make_shared<ppc::core::TaskData>();
+  taskDataUpdate->inputs_count.push_back(8);
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI update_task(taskDataUpdate);
+  update_task.set_matrix(matrix, vector);
+  update_task.set_convergence_check(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::UPDATE_NORM);
+  ASSERT_TRUE(update_task.validation());
+  ASSERT_TRUE(update_task.pre_processing());
+  ASSERT_TRUE(update_task.run());
+
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_NEAR(residual_task.get_solution()[i], update_task.get_solution()[i], 1e-5);
+  }
+}
+
+TEST(nasedkin_e_seidels_iterate_methods_mpi, test_sweep_orders_give_same_solution) {
+  const int size = 12;
+  std::vector<std::vector<double>> matrix;
+  std::vector<double> vector;
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::generate_random_matrix(size, matrix, vector);
+
+  std::vector<std::vector<double>> solutions;
+  std::vector<int> iterations;
+  for (auto order : {nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::JACOBI,
+                     nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::RED_BLACK,
+                     nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::WAVEFRONT}) {
+    auto taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs_count.push_back(size);
+    nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI seidel_task(taskData);
+    seidel_task.set_matrix(matrix, vector);
+    seidel_task.set_sweep_order(order);
+
+    ASSERT_TRUE(seidel_task.validation());
+    ASSERT_TRUE(seidel_task.pre_processing());
+    ASSERT_TRUE(seidel_task.run());
+    ASSERT_TRUE(seidel_task.post_processing());
+
+    EXPECT_LT(seidel_task.check_residual_norm(), 1e-3);
+    solutions.push_back(seidel_task.get_solution());
+    iterations.push_back(seidel_task.get_iterations());
+  }
+
+  for (int i = 0; i < size; ++i) {
+    EXPECT_NEAR(solutions[0][i], solutions[1][i], 1e-4);
+    EXPECT_NEAR(solutions[0][i], solutions[2][i], 1e-4);
+  }
+  EXPECT_LE(iterations[2], iterations[0]);
+}
+
+TEST(nasedkin_e_seidels_iterate_methods_mpi, test_wavefront_residual_check_every_3_iterations) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs_count.push_back(7);
+
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI seidel_task(taskData);
+
+  std::vector<std::vector<double>> matrix;
+  std::vector<double> vector;
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::generate_random_matrix(7, matrix, vector);
+  seidel_task.set_matrix(matrix, vector);
+  seidel_task.set_sweep_order(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::WAVEFRONT);
+  seidel_task.set_convergence_check(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::RESIDUAL, 3);
+
+  ASSERT_TRUE(seidel_task.validation());
+  ASSERT_TRUE(seidel_task.pre_processing());
+  ASSERT_TRUE(seidel_task.run());
+  ASSERT_TRUE(seidel_task.post_processing());
+
+  EXPECT_EQ(seidel_task.get_iterations() % 3, 0);
+  EXPECT_LT(seidel_task.check_residual_norm(), 1e-6);
+}
+
+TEST(nasedkin_e_seidels_iterate_methods_mpi, test_wavefront_default_system) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs_count.push_back(4);
+
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI seidel_task(taskData);
+  seidel_task.set_sweep_order(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::WAVEFRONT);
+
+  ASSERT_TRUE(seidel_task.validation());
+  ASSERT_TRUE(seidel_task.pre_processing());
+  ASSERT_TRUE(seidel_task.run());
+  ASSERT_TRUE(seidel_task.post_processing());
+
+  for (double value : seidel_task.get_solution()) {
+    EXPECT_NEAR(value, 1.0, 1e-4);
+  }
+}
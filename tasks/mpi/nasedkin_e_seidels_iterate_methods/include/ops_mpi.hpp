@@ -12,6 +12,14 @@ namespace nasedkin_e_seidels_iterate_methods_mpi {
 
 class SeidelIterateMethodsMPI : public ppc::core::Task {
  public:
+  // RESIDUAL recomputes ||Ax - b|| after the sweep, UPDATE_NORM reuses ||x_new - x|| accumulated inside the sweep
+  enum ConvergenceCriterion { RESIDUAL, UPDATE_NORM };
+  // JACOBI updates every unknown from the previous iterate on each rank, RED_BLACK relaxes even and then odd
+  // unknowns in two half-sweeps split by rows between ranks (a two-colour hybrid: Gauss-Seidel between the colours,
+  // Jacobi within one, so exact Gauss-Seidel only when A couples no two unknowns of one colour), WAVEFRONT is exact
+  // Gauss-Seidel pipelined over row blocks
+  enum SweepOrder { JACOBI, RED_BLACK, WAVEFRONT };
+
   explicit SeidelIterateMethodsMPI(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
 
   bool pre_processing() override;
@@ -23,6 +31,9 @@ class SeidelIterateMethodsMPI : public ppc::core::Task {
   static void generate_random_matrix(int size, std::vector<std::vector<double>>& matrix, std::vector<double>& vector);
   const std::vector<double>& get_solution() const { return x; }
   double check_residual_norm() const;
+  void set_convergence_check(ConvergenceCriterion criterion_, int check_interval_ = 1);
+  int get_iterations() const { return iterations; }
+  void set_sweep_order(SweepOrder sweep_order_) { sweep_order = sweep_order_; }
 
  private:
   boost::mpi::communicator world;
@@ -32,8 +43,18 @@ class SeidelIterateMethodsMPI : public ppc::core::Task {
   int n;
   double epsilon;
   int max_iterations;
+  int iterations = 0;
+  ConvergenceCriterion criterion = UPDATE_NORM;
+  int check_interval = 1;
+  SweepOrder sweep_order = WAVEFRONT;
+  std::vector<int> row_counts;
+  std::vector<int> row_displs;
 
   bool converge(const std::vector<double>& x_new);
+  bool need_to_stop(double update_norm, const std::vector<double>& x_new);
+  void run_jacobi();
+  void run_red_black();
+  void run_wavefront();
 };
 
 }  // namespace nasedkin_e_seidels_iterate_methods_mpi
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <boost/mpi/communicator.hpp>
 #include <boost/mpi/timer.hpp>
+#include <iostream>
+#include <utility>
 
 #include "core/perf/include/perf.hpp"
 #include "mpi/nasedkin_e_seidels_iterate_methods/include/ops_mpi.hpp"
@@ -54,4 +57,88 @@ TEST(nasedkin_e_seidels_iterate_methods_mpi, test_task_run) {
   perfAnalyzer->task_run(perfAttr, perfResults);
 
   ppc::core::Perf::print_perf_statistic(perfResults);
-}
\ No newline at end of file
+}
+
+TEST(nasedkin_e_seidels_iterate_methods_mpi, test_convergence_check_cost) {
+  const int size = 400;
+  std::vector<std::vector<double>> matrix;
+  std::vector<double> vector;
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::generate_random_matrix(size, matrix, vector);
+  for (int i = 0; i < size; ++i) {
+    matrix[i][i] *= 2.0;
+  }
+
+  auto measure = [&](nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::ConvergenceCriterion criterion,
+                     int check_interval) {
+    auto taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs_count.push_back(size);
+    nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI seidel_task(taskData);
+    seidel_task.set_matrix(matrix, vector);
+    seidel_task.set_convergence_check(criterion, check_interval);
+    EXPECT_TRUE(seidel_task.validation());
+    EXPECT_TRUE(seidel_task.pre_processing());
+
+    const boost::mpi::timer current_timer;
+    seidel_task.run();
+    double elapsed = current_timer.elapsed();
+    EXPECT_LT(seidel_task.check_residual_norm(), 1e-1);
+    return std::make_pair(seidel_task.get_iterations(), elapsed);
+  };
+
+  auto [residual_iterations, residual_time] =
+      measure(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::RESIDUAL, 1);
+  auto [update_iterations, update_time] =
+      measure(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::UPDATE_NORM, 1);
+  auto [interval_iterations, interval_time] =
+      measure(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::RESIDUAL, 8);
+
+  std::cout << "residual check:         " << residual_iterations << " iterations, "
+            << residual_time / residual_iterations << " s/iteration" << std::endl;
+  std::cout << "fused update norm:      " << update_iterations << " iterations, " << update_time / update_iterations
+            << " s/iteration" << std::endl;
+  std::cout << "residual every 8 iters: " << interval_iterations << " iterations, "
+            << interval_time / interval_iterations << " s/iteration" << std::endl;
+}
+
+TEST(nasedkin_e_seidels_iterate_methods_mpi, test_sweep_order_against_jacobi) {
+  boost::mpi::communicator world;
+  const int size = 600;
+  std::vector<std::vector<double>> matrix;
+  std::vector<double> vector;
+  nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::generate_random_matrix(size, matrix, vector);
+  for (int i = 0; i < size; ++i) {
+    matrix[i][i] *= 1.2;
+  }
+
+  auto measure = [&](nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::SweepOrder order) {
+    auto taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs_count.push_back(size);
+    nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI seidel_task(taskData);
+    seidel_task.set_matrix(matrix, vector);
+    seidel_task.set_sweep_order(order);
+    EXPECT_TRUE(seidel_task.validation());
+    EXPECT_TRUE(seidel_task.pre_processing());
+
+    world.barrier();
+    const boost::mpi::timer current_timer;
+    seidel_task.run();
+    double elapsed = current_timer.elapsed();
+    return std::make_pair(seidel_task.get_iterations(), elapsed);
+  };
+
+  auto [jacobi_iterations, jacobi_time] =
+      measure(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::JACOBI);
+  auto [red_black_iterations, red_black_time] =
+      measure(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::RED_BLACK);
+  auto [wavefront_iterations, wavefront_time] =
+      measure(nasedkin_e_seidels_iterate_methods_mpi::SeidelIterateMethodsMPI::WAVEFRONT);
+
+  if (world.rank() == 0) {
+    std::cout << "jacobi sweep:          " << jacobi_iterations << " iterations, " << jacobi_time << " s" << std::endl;
+    std::cout << "red-black sweep:       " << red_black_iterations << " iterations, " << red_black_time << " s"
+              << std::endl;
+    std::cout << "wavefront sweep:       " << wavefront_iterations << " iterations, " << wavefront_time << " s"
+              << std::endl;
+  }
+  EXPECT_LE(wavefront_iterations, jacobi_iterations);
+}
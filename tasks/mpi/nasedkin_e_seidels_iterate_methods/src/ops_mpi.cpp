@@ -1,6 +1,10 @@
 #include "mpi/nasedkin_e_seidels_iterate_methods/include/ops_mpi.hpp"
 
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/collectives/all_gatherv.hpp>
 #include <cmath>
+#include <functional>
 #include <iostream>
 
 namespace nasedkin_e_seidels_iterate_methods_mpi {
@@ -15,6 +19,32 @@ bool SeidelIterateMethodsMPI::pre_processing() {
 
   x.resize(n, 0.0);
 
+  // Rank 0 owns the system, the other ranks receive it in one message
+  std::vector<double> system(n * (n + 1));
+  if (world.rank() == 0) {
+    for (int i = 0; i < n; ++i) {
+      std::copy(A[i].begin(), A[i].end(), system.begin() + i * n);
+    }
+    std::copy(b.begin(), b.end(), system.begin() + n * n);
+  }
+  boost::mpi::broadcast(world, system.data(), static_cast<int>(system.size()), 0);
+  for (int i = 0; i < n; ++i) {
+    std::copy(system.begin() + i * n, system.begin() + (i + 1) * n, A[i].begin());
+  }
+  std::copy(system.begin() + n * n, system.end(), b.begin());
+
+  int proc = world.size();
+  row_counts.assign(proc, n / proc);
+  row_displs.assign(proc, 0);
+  for (int p = 0; p < proc; ++p) {
+    if (p < n % proc) {
+      row_counts[p]++;
+    }
+    if (p > 0) {
+      row_displs[p] = row_displs[p - 1] + row_counts[p - 1];
+    }
+  }
+
   return taskData->inputs_count.size() <= 1 || taskData->inputs_count[1] != 0;
 }
 
@@ -28,6 +58,8 @@ bool SeidelIterateMethodsMPI::validation() {
     return false;
   }
 
+  // A system passed through set_matrix() is kept, otherwise the default one is generated
+  bool has_system = static_cast<int>(A.size()) == n && static_cast<int>(b.size()) == n;
   A.resize(n, std::vector<double>(n, 0.0));
   b.resize(n, 0.0);
 
@@ -40,7 +72,7 @@ bool SeidelIterateMethodsMPI::validation() {
       }
       b[i] = 1.0;
     }
-  } else {
+  } else if (!has_system) {
     for (int i = 0; i < n; ++i) {
       for (int j = 0; j < n; ++j) {
         A[i][j] = (i == j) ? 2.0 : 1.0;
@@ -59,10 +91,29 @@ bool SeidelIterateMethodsMPI::validation() {
 }
 
 bool SeidelIterateMethodsMPI::run() {
+  iterations = 0;
+  if (sweep_order == RED_BLACK) {
+    run_red_black();
+  } else if (sweep_order == WAVEFRONT) {
+    run_wavefront();
+  } else {
+    run_jacobi();
+  }
+  return true;
+}
+
+bool SeidelIterateMethodsMPI::need_to_stop(double update_norm, const std::vector<double>& x_new) {
+  if (iterations % check_interval != 0) {
+    return false;
+  }
+  return (criterion == UPDATE_NORM) ? std::sqrt(update_norm) < epsilon : converge(x_new);
+}
+
+void SeidelIterateMethodsMPI::run_jacobi() {
   std::vector<double> x_new(n, 0.0);
-  int iteration = 0;
 
-  while (iteration < max_iterations) {
+  while (iterations < max_iterations) {
+    double update_norm = 0.0;
     for (int i = 0; i < n; ++i) {
       x_new[i] = b[i];
       for (int j = 0; j < n; ++j) {
@@ -71,33 +122,193 @@ bool SeidelIterateMethodsMPI::run() {
         }
       }
       x_new[i] /= A[i][i];
+      update_norm += (x_new[i] - x[i]) * (x_new[i] - x[i]);
     }
 
-    if (converge(x_new)) {
+    ++iterations;
+    bool converged = need_to_stop(update_norm, x_new);
+
+    x.swap(x_new);
+    if (converged) {
       break;
     }
+  }
+}
 
-    x = x_new;
-    ++iteration;
+void SeidelIterateMethodsMPI::run_red_black() {
+  int rank = world.rank();
+  int begin = row_displs[rank];
+  int count = row_counts[rank];
+
+  // Every rank sends its rows followed by the partial update norm of the half-sweep
+  std::vector<int> sizes(world.size());
+  std::vector<int> displs(world.size());
+  for (int p = 0; p < world.size(); ++p) {
+    sizes[p] = row_counts[p] + 1;
+    displs[p] = row_displs[p] + p;
   }
+  std::vector<double> local_x(count + 1);
+  std::vector<double> gathered(n + world.size());
 
-  return true;
+  // The odd unknowns see the even ones of this sweep, but unknowns of one colour only see each other's previous
+  // values. A dense A couples them, so the sweep is a two-colour hybrid of Jacobi and Gauss-Seidel and may need
+  // more iterations than WAVEFRONT; it matches Gauss-Seidel for matrices like the 1D Laplacian.
+  while (iterations < max_iterations) {
+    double update_norm = 0.0;
+    for (int color = 0; color < 2; ++color) {
+      double color_norm = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : color_norm)
+#endif
+      for (int k = 0; k < count; ++k) {
+        int i = begin + k;
+        local_x[k] = x[i];
+        if (i % 2 == color) {
+          double sum = b[i];
+          for (int j = 0; j < n; ++j) {
+            if (j != i) {
+              sum -= A[i][j] * x[j];
+            }
+          }
+          local_x[k] = sum / A[i][i];
+          color_norm += (local_x[k] - x[i]) * (local_x[k] - x[i]);
+        }
+      }
+      local_x[count] = color_norm;
+
+      boost::mpi::all_gatherv(world, local_x.data(), gathered.data(), sizes, displs);
+      for (int p = 0; p < world.size(); ++p) {
+        std::copy(gathered.begin() + displs[p], gathered.begin() + displs[p] + row_counts[p],
+                  x.begin() + row_displs[p]);
+        update_norm += gathered[displs[p] + row_counts[p]];
+      }
+    }
+
+    ++iterations;
+    if (need_to_stop(update_norm, x)) {
+      break;
+    }
+  }
+}
+
+void SeidelIterateMethodsMPI::run_wavefront() {
+  int rank = world.rank();
+  int begin = row_displs[rank];
+  int count = row_counts[rank];
+
+  // sum[k] holds b_i minus the contributions of the blocks already known for this sweep, next_sum[k] collects
+  // the blocks after ours as they arrive, so they are ready for the following sweep
+  std::vector<double> sum(count);
+  std::vector<double> next_sum(count);
+  for (int k = 0; k < count; ++k) {
+    int i = begin + k;
+    next_sum[k] = b[i];
+    for (int j = begin + count; j < n; ++j) {
+      next_sum[k] -= A[i][j] * x[j];
+    }
+  }
+  std::vector<double> block(*std::max_element(row_counts.begin(), row_counts.end()));
+
+  while (iterations < max_iterations) {
+    sum.swap(next_sum);
+    for (int k = 0; k < count; ++k) {
+      next_sum[k] = b[begin + k];
+    }
+
+    double update_norm = 0.0;
+    for (int q = 0; q < world.size(); ++q) {
+      int q_begin = row_displs[q];
+      int q_count = row_counts[q];
+      if (q_count == 0) {
+        continue;
+      }
+
+      if (q == rank) {
+        for (int k = 0; k < count; ++k) {
+          int i = begin + k;
+          double s = sum[k];
+          for (int j = begin; j < i; ++j) {
+            s -= A[i][j] * block[j - begin];
+          }
+          for (int j = i + 1; j < begin + count; ++j) {
+            s -= A[i][j] * x[j];
+          }
+          block[k] = s / A[i][i];
+        }
+      }
+      boost::mpi::broadcast(world, block.data(), q_count, q);
+
+      for (int k = 0; k < q_count; ++k) {
+        update_norm += (block[k] - x[q_begin + k]) * (block[k] - x[q_begin + k]);
+      }
+      std::copy(block.begin(), block.begin() + q_count, x.begin() + q_begin);
+
+      if (q != rank) {
+        std::vector<double>& target = (q < rank) ? sum : next_sum;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int k = 0; k < count; ++k) {
+          int i = begin + k;
+          double s = 0.0;
+          for (int j = q_begin; j < q_begin + q_count; ++j) {
+            s += A[i][j] * x[j];
+          }
+          target[k] -= s;
+        }
+      }
+    }
+
+    ++iterations;
+    if (need_to_stop(update_norm, x)) {
+      break;
+    }
+  }
 }
 
 bool SeidelIterateMethodsMPI::post_processing() { return true; }
 
 bool SeidelIterateMethodsMPI::converge(const std::vector<double>& x_new) {
+  // The row-split sweeps leave x_new on every rank, so each rank checks its own rows only
+  int row_begin = 0;
+  int row_end = n;
+  if (sweep_order != JACOBI) {
+    row_begin = row_displs[world.rank()];
+    row_end = row_begin + row_counts[world.rank()];
+  }
+
   double residual_norm = 0.0;
-  for (int i = 0; i < n; ++i) {
+  for (int i = row_begin; i < row_end; ++i) {
     double Ax_i = 0.0;
     for (int j = 0; j < n; ++j) {
       Ax_i += A[i][j] * x_new[j];
     }
     residual_norm += std::pow(Ax_i - b[i], 2);
   }
+  if (sweep_order != JACOBI) {
+    double local_norm = residual_norm;
+    boost::mpi::all_reduce(world, local_norm, residual_norm, std::plus<double>());
+  }
   return std::sqrt(residual_norm) < epsilon;
 }
 
+double SeidelIterateMethodsMPI::check_residual_norm() const {
+  double residual_norm = 0.0;
+  for (int i = 0; i < n; ++i) {
+    double Ax_i = 0.0;
+    for (int j = 0; j < n; ++j) {
+      Ax_i += A[i][j] * x[j];
+    }
+    residual_norm += (Ax_i - b[i]) * (Ax_i - b[i]);
+  }
+  return std::sqrt(residual_norm);
+}
+
+void SeidelIterateMethodsMPI::set_convergence_check(ConvergenceCriterion criterion_, int check_interval_) {
+  criterion = criterion_;
+  check_interval = std::max(check_interval_, 1);
+}
+
 void SeidelIterateMethodsMPI::set_matrix(const std::vector<std::vector<double>>& matrix,
                                          const std::vector<double>& vector) {
   A = matrix;
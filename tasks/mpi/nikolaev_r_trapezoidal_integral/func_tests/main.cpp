@@ -423,4 +423,38 @@ TEST(nikolaev_r_trapezoidal_integral_mpi, test_int_mixed_func) {
 
     ASSERT_NEAR(global_result[0], reference_result[0], 0.01);
   }
-}
\ No newline at end of file
+}
+
+TEST(nikolaev_r_trapezoidal_integral_mpi, test_int_mixed_func_romberg) {
+  boost::mpi::communicator world;
+  std::vector<double> global_result(1, 0);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  double a = 1.0;
+  double b = 3.0;
+  int n = 1 << 16;
+
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&a));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&b));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&n));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralParallel testMpiTaskParallel(taskDataPar);
+  testMpiTaskParallel.set_function([](double x) { return 3 * x * x + std::pow(5, x) - std::exp(x); });
+  testMpiTaskParallel.set_tolerance(1e-9);
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+
+  if (world.rank() == 0) {
+    const double expected = 26.0 + (std::pow(5, 3) - 5) / std::log(5) - (std::exp(3) - std::exp(1));
+    ASSERT_NEAR(global_result[0], expected, 1e-8);
+  }
+}
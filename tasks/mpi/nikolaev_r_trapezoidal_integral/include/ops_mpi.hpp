@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 
 namespace nikolaev_r_trapezoidal_integral_mpi {
 
@@ -20,13 +21,18 @@ class TrapezoidalIntegralSequential : public ppc::core::Task {
   bool validation() override;
   bool run() override;
   bool post_processing() override;
-  void set_function(const std::function<double(double)>& f);
+  // Any double(double) callable; a lambda is inlined into the batched quadrature loop
+  template <ppc::util::ScalarIntegrand F>
+  void set_function(F f) {
+    function_ = ppc::util::make_batch_integrand(std::move(f));
+  }
+  // Romberg refinement to epsilon instead of a single pass; n becomes the cap on the number of subintervals
+  void set_tolerance(double epsilon) { epsilon_ = epsilon; }
 
  private:
   double a_{}, b_{}, n_{}, res_{};
-  std::function<double(double)> function_;
-
-  static double integrate_function(double a, double b, int n, const std::function<double(double)>& f);
+  double epsilon_{};
+  ppc::util::BatchIntegrand function_;
 };
 
 class TrapezoidalIntegralParallel : public ppc::core::Task {
@@ -36,13 +42,17 @@ class TrapezoidalIntegralParallel : public ppc::core::Task {
   bool validation() override;
   bool run() override;
   bool post_processing() override;
-  void set_function(const std::function<double(double)>& f);
+  template <ppc::util::ScalarIntegrand F>
+  void set_function(F f) {
+    function_ = ppc::util::make_batch_integrand(std::move(f));
+  }
+  // Romberg refinement to epsilon instead of a single pass; n becomes the cap on the number of subintervals
+  void set_tolerance(double epsilon) { epsilon_ = epsilon; }
 
  private:
   double a_{}, b_{}, n_{}, res_{};
-  std::function<double(double)> function_;
+  double epsilon_{};
+  ppc::util::BatchIntegrand function_;
   boost::mpi::communicator world;
-
-  double integrate_function(double a, double b, int n, const std::function<double(double)>& f);
 };
 }  // namespace nikolaev_r_trapezoidal_integral_mpi
\ No newline at end of file
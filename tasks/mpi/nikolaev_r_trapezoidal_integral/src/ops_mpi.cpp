@@ -16,12 +16,20 @@ bool nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralSequential::pre_pro
 
 bool nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralSequential::validation() {
   internal_order_test();
-  return taskData->outputs_count[0] == 1;
+  return taskData->outputs_count[0] == 1 && *reinterpret_cast<int*>(taskData->inputs[2]) > 0;
 }
 
 bool nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralSequential::run() {
   internal_order_test();
-  res_ = integrate_function(a_, b_, n_, function_);
+  if (epsilon_ > 0) {
+    ppc::util::RombergOptions options;
+    options.epsilon = epsilon_;
+    options.max_intervals = static_cast<size_t>(n_);
+    res_ = ppc::util::romberg(function_, a_, b_, options).value;
+    return true;
+  }
+  res_ = ppc::util::composite_quadrature(function_, a_, b_, static_cast<size_t>(n_),
+                                        ppc::util::QuadratureRule::kTrapezoid);
   return true;
 }
 
@@ -44,7 +52,7 @@ bool nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralParallel::pre_proce
 bool nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralParallel::validation() {
   internal_order_test();
   if (world.rank() == 0) {
-    return taskData->outputs_count[0] == 1;
+    return taskData->outputs_count[0] == 1 && *reinterpret_cast<int*>(taskData->inputs[2]) > 0;
   }
   return true;
 }
@@ -58,7 +66,25 @@ bool nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralParallel::run() {
     params[2] = static_cast<double>(n_);
   }
   boost::mpi::broadcast(world, params, std::size(params), 0);
-  double local_res = integrate_function(params[0], params[1], static_cast<int>(params[2]), function_);
+  if (epsilon_ > 0) {
+    // New midpoints of every level are dealt out block-cyclically, so each halving stays balanced
+    ppc::util::RombergOptions options;
+    options.epsilon = epsilon_;
+    options.max_intervals = static_cast<size_t>(params[2]);
+    auto sum = [&](std::vector<double>& sums) {
+      double total = 0.0;
+      boost::mpi::all_reduce(world, sums[0], total, std::plus());
+      sums[0] = total;
+    };
+    res_ = ppc::util::romberg(function_, params[0], params[1], options, world.rank(), world.size(), sum).value;
+    return true;
+  }
+  // Each rank takes a contiguous block of the subintervals
+  auto n = static_cast<size_t>(params[2]);
+  size_t first = n * world.rank() / world.size();
+  size_t last = n * (world.rank() + 1) / world.size();
+  double local_res = ppc::util::composite_quadrature(function_, params[0], params[1], n,
+                                                     ppc::util::QuadratureRule::kTrapezoid, first, last);
   boost::mpi::reduce(world, local_res, res_, std::plus(), 0);
   return true;
 }
@@ -70,44 +96,3 @@ bool nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralParallel::post_proc
   }
   return true;
 }
-
-void nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralSequential::set_function(
-    const std::function<double(double)>& f) {
-  function_ = f;
-}
-
-void nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralParallel::set_function(
-    const std::function<double(double)>& f) {
-  function_ = f;
-}
-
-double nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralSequential::integrate_function(
-    double a, double b, int n, const std::function<double(double)>& f) {
-  const double width = (b - a) / n;
-  double result = 0.0;
-  for (int step = 0; step < n; step++) {
-    const double x1 = a + step * width;
-    const double x2 = a + (step + 1) * width;
-
-    result += 0.5 * (x2 - x1) * (f(x1) + f(x2));
-  }
-
-  return result;
-}
-
-double nikolaev_r_trapezoidal_integral_mpi::TrapezoidalIntegralParallel::integrate_function(
-    double a, double b, int n, const std::function<double(double)>& f) {
-  int rank = world.rank();
-  int size = world.size();
-
-  const double width = (b - a) / n;
-  double result = 0.0;
-  for (int step = rank; step < n; step += size) {
-    const double x1 = a + step * width;
-    const double x2 = a + (step + 1) * width;
-
-    result += 0.5 * (x2 - x1) * (f(x1) + f(x2));
-  }
-
-  return result;
-}
\ No newline at end of file
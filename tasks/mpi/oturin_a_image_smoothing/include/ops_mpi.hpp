@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/convolution/include/convolution.hpp"
 
 namespace oturin_a_image_smoothing_mpi {
 
@@ -31,9 +32,12 @@ const int INFO_HEADER_SIZE = 40;
 // https://stackoverflow.com/questions/9296059
 std::vector<uint8_t> ReadBMP(const char* filename, int& w, int& h);
 
-int clamp(int n, int lo, int hi);
+// 3x3 Gaussian with sigma 1.5, normalized to unit sum
+ppc::util::ConvolutionKernel<float> CreateKernel(int radius);
 
-float* CreateKernel();
+// Applies the kernel to output rows [first_row, last_row); src holds the image from row src_first_row on
+void SmoothRows(const uint8_t* src, int src_first_row, uint8_t* dst, int first_row, int last_row, int width,
+                int height, int radius);
 
 class TestMPITaskSequential : public ppc::core::Task {
  public:
@@ -43,15 +47,12 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
-  void SmoothPixel(int x, int y);
-
  private:
   int width = 0;
   int height = 0;
   std::vector<uint8_t> input;
   std::vector<uint8_t> result;
   int radius = 1;  // do not change
-  float* kernel;
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -62,15 +63,12 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
-  void SmoothPixel(uint8_t* out, int x, int y);
-
  private:
   int width = 0;
   int height = 0;
   std::vector<uint8_t> input;
   std::vector<uint8_t> result;
   int radius = 1;  // do not change
-  float* kernel;
 
   boost::mpi::communicator world;
 };
@@ -16,52 +16,22 @@ bool oturin_a_image_smoothing_mpi::TestMPITaskSequential::pre_processing() {
   input = std::vector<uint8_t>(tmp_ptr, tmp_ptr + width * height * 3);
   // Init values for output
   result = std::vector<uint8_t>(width * height * 3);
-  kernel = CreateKernel();
   return true;
 }
 
 bool oturin_a_image_smoothing_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  for (int y = 0; y < height; y++) {
-    for (int x = 0; x < width; x++) {
-      SmoothPixel(x, y);
-    }
-  }
+  SmoothRows(input.data(), 0, result.data(), 0, height, width, height, radius);
   return true;
 }
 
 bool oturin_a_image_smoothing_mpi::TestMPITaskSequential::post_processing() {
   internal_order_test();
-  delete[] kernel;
   auto* result_ptr = reinterpret_cast<uint8_t*>(taskData->outputs[0]);
   std::copy(result.begin(), result.end(), result_ptr);
   return true;
 }
 
-void oturin_a_image_smoothing_mpi::TestMPITaskSequential::SmoothPixel(int x, int y) {
-  int stride = width * 3;
-  size_t sizek = 2 * radius + 1;
-  float outR = 0.0f;
-  float outG = 0.0f;
-  float outB = 0.0f;
-  for (int ry = -radius; ry <= radius; ry++) {
-    for (int rx = -radius; rx <= radius; rx++) {
-      int idX = clamp(x + rx, 0, width - 1);
-      int idY = clamp(y + ry, 0, height - 1);
-      int pos = idY * stride + idX * 3;
-      int kernelPos = (ry + radius) * sizek + rx + radius;
-
-      outR += input[pos] * kernel[kernelPos];
-      outG += input[pos + 1] * kernel[kernelPos];
-      outB += input[pos + 2] * kernel[kernelPos];
-    }
-  }
-  int pos = y * stride + x * 3;
-  result[pos] = (uint8_t)outR;
-  result[pos + 1] = (uint8_t)outG;
-  result[pos + 2] = (uint8_t)outB;
-}
-
 bool oturin_a_image_smoothing_mpi::TestMPITaskParallel::validation() {
   internal_order_test();
   // Check elements count in i/o
@@ -77,87 +47,55 @@ bool oturin_a_image_smoothing_mpi::TestMPITaskParallel::pre_processing() {
   if (world.rank() == 0) {
     width = taskData->inputs_count[0];
     height = taskData->inputs_count[1];
-    // input = std::vector<uint8_t>(width * height * 3);
     auto* tmp_ptr = reinterpret_cast<uint8_t*>(taskData->inputs[0]);
     input = std::vector<uint8_t>(tmp_ptr, tmp_ptr + width * height * 3);
     // Init values for output
     result = std::vector<uint8_t>(width * height * 3);
   }
-  kernel = CreateKernel();
   return true;
 }
 
 bool oturin_a_image_smoothing_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  constexpr int TAG_EXIT = 0;
-  constexpr int TAG_INFO = 2;
-  constexpr int TAG_DATA = 3;
-  constexpr int TAG_RESULT = 5;
-
-#if defined(_MSC_VER) && !defined(__clang__)
-  if (world.size() == 1) {
-    for (int y = 0; y < height; y++) {
-      for (int x = 0; x < width; x++) {
-        SmoothPixel(&result.data()[y * width * 3 + x * 3], x, y);
-      }
-    }
-    return true;
+  boost::mpi::broadcast(world, width, 0);
+  boost::mpi::broadcast(world, height, 0);
+
+  // Each rank smooths a contiguous band of rows and receives it together with its ghost rows, so the
+  // overlapping windows need no further exchange
+  const int row_bytes = width * BYTES_PER_PIXEL;
+  std::vector<int> halo_counts(world.size());
+  std::vector<int> halo_displs(world.size());
+  std::vector<int> band_counts(world.size());
+  std::vector<int> band_displs(world.size());
+  for (int p = 0; p < world.size(); p++) {
+    auto band = ppc::util::row_band(height, p, world.size(), radius);
+    halo_counts[p] = band.halo_rows() * row_bytes;
+    halo_displs[p] = band.halo_first * row_bytes;
+    band_counts[p] = band.rows() * row_bytes;
+    band_displs[p] = band.first * row_bytes;
   }
-#endif
+  auto band = ppc::util::row_band(height, world.rank(), world.size(), radius);
 
+  std::vector<uint8_t> local(halo_counts[world.rank()]);
   if (world.rank() == 0) {
-    int satellites = world.size() - 1;
-    int escape = 0;
-    int noescape = 1;
-
-    for (int i = 1; i <= satellites; i++)  // send width
-      world.send(i, TAG_INFO, &width, 1);
-
-    int row = 0;
-    while (row < height - 2) {
-      for (int i = 0; i < std::min(satellites, height - 2 - row); i++) {
-        world.send(i + 1, TAG_EXIT, &noescape, 1);
-        world.send(i + 1, TAG_DATA, &input[(row + i) * width * 3], width * 3 * 3);
-      }
-      for (int i = 0; i < std::min(satellites, height - 2 - row); i++) {
-        world.recv(i + 1, TAG_RESULT, &result[(row + i + 1) * width * 3], width * 3);
-      }
-      row += satellites;
-    }
-    for (int i = 1; i <= satellites; i++)  // close all satellite processes
-      world.send(i, TAG_EXIT, &escape, 1);
-
-    for (int x = 0; x < width; x++) {  // calculate bottom row
-      SmoothPixel(&result[x * 3], x, 0);
-    }
-    for (int x = 0; x < width; x++) {  // calculate top row
-      SmoothPixel(&result[(height - 1) * width * 3 + x * 3], x, height - 1);
-    }
+    boost::mpi::scatterv(world, input.data(), halo_counts, halo_displs, local.data(), halo_counts[0], 0);
   } else {
-    world.recv(0, TAG_INFO, &width, 1);
-    input = std::vector<uint8_t>(width * 3 * 3);  // 3 RGB rows
-    result = std::vector<uint8_t>(width * 3);     // 1 RGB row
-    int escape = 0;
-    height = INT_MAX;
-    while (true) {
-      world.recv(0, TAG_EXIT, &escape, 1);
-      if (escape == 0) break;
-      world.recv(0, TAG_DATA, input.data(), width * 3 * 3);
+    boost::mpi::scatterv(world, local.data(), halo_counts[world.rank()], 0);
+  }
 
-      for (int x = 0; x < width; x++) {
-        SmoothPixel(&result[x * 3], x, 1);
-      }
+  std::vector<uint8_t> local_result(band_counts[world.rank()]);
+  SmoothRows(local.data(), band.halo_first, local_result.data(), band.first, band.last, width, height, radius);
 
-      world.send(0, TAG_RESULT, result.data(), width * 3);
-    }
+  if (world.rank() == 0) {
+    boost::mpi::gatherv(world, local_result.data(), band_counts[0], result.data(), band_counts, band_displs, 0);
+  } else {
+    boost::mpi::gatherv(world, local_result.data(), band_counts[world.rank()], 0);
   }
-
   return true;
 }
 
 bool oturin_a_image_smoothing_mpi::TestMPITaskParallel::post_processing() {
   internal_order_test();
-  delete[] kernel;
   if (world.rank() == 0) {
     auto* result_ptr = reinterpret_cast<uint8_t*>(taskData->outputs[0]);
     std::copy(result.begin(), result.end(), result_ptr);
@@ -165,34 +103,9 @@ bool oturin_a_image_smoothing_mpi::TestMPITaskParallel::post_processing() {
   return true;
 }
 
-void oturin_a_image_smoothing_mpi::TestMPITaskParallel::SmoothPixel(uint8_t* out, int x, int y) {
-  int stride = width * 3;
-  size_t sizek = 2 * radius + 1;
-  float outR = 0.0f;
-  float outG = 0.0f;
-  float outB = 0.0f;
-  for (int ry = -radius; ry <= radius; ry++) {
-    for (int rx = -radius; rx <= radius; rx++) {
-      int idX = clamp(x + rx, 0, width - 1);
-      int idY = clamp(y + ry, 0, height - 1);
-      int pos = idY * stride + idX * 3;
-      int kernelPos = (ry + radius) * sizek + rx + radius;
-
-      outR += input[pos] * kernel[kernelPos];
-      outG += input[pos + 1] * kernel[kernelPos];
-      outB += input[pos + 2] * kernel[kernelPos];
-    }
-  }
-  out[0] = (uint8_t)outR;
-  out[1] = (uint8_t)outG;
-  out[2] = (uint8_t)outB;
-}
-
-// must be used before image processing
-float* oturin_a_image_smoothing_mpi::CreateKernel() {
-  int radius = 1;
+ppc::util::ConvolutionKernel<float> oturin_a_image_smoothing_mpi::CreateKernel(int radius) {
   int size = 2 * radius + 1;
-  auto* kernel = new float[size * size]{0};
+  std::vector<float> kernel(size * size);
   float sigma = 1.5;
   float norm = 0;
 
@@ -204,10 +117,21 @@ float* oturin_a_image_smoothing_mpi::CreateKernel() {
   }
 
   for (int i = 0; i < size * size; i++) {
-    kernel[i] /= norm;  // NOLINT: supressed false-positive uninitialized memory warning
+    kernel[i] /= norm;
   }
 
-  return kernel;
+  return {radius, std::move(kernel)};
+}
+
+void oturin_a_image_smoothing_mpi::SmoothRows(const uint8_t* src, int src_first_row, uint8_t* dst, int first_row,
+                                              int last_row, int width, int height, int radius) {
+  if (first_row == last_row) return;
+  ppc::util::ConvolutionOptions options;
+  // Kept as the 2D sum so the output matches the sequential reference images bit for bit
+  options.use_separable = false;
+  ppc::util::convolve(
+      src, src_first_row, dst, first_row, last_row, {width, height, BYTES_PER_PIXEL}, CreateKernel(radius),
+      [](float sum, int, int) { return static_cast<uint8_t>(sum); }, options);
 }
 
 #if defined(_WIN32) || defined(WIN32)
@@ -261,5 +185,3 @@ std::vector<uint8_t> oturin_a_image_smoothing_mpi::ReadBMP(const char* filename,
 
   return data;
 }
-
-int oturin_a_image_smoothing_mpi::clamp(int n, int lo, int hi) { return std::min(std::max(n, lo), hi); }
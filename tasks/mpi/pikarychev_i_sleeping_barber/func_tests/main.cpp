@@ -56,3 +56,37 @@ TEST(pikarychev_i_sleeping_barber_mpi_test, fails_validation) {
     EXPECT_FALSE(testMpiTaskParallel.validation());
   }
 }
+
+TEST(pikarychev_i_sleeping_barber_mpi_test, report_accounts_for_every_customer) {
+  boost::mpi::communicator world;
+  for (int capacity : {1, world.size()}) {
+    ppc::util::ContentionReport report;
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&capacity));
+      taskDataPar->inputs_count.emplace_back(1);
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(&report));
+      taskDataPar->outputs_count.emplace_back(1);
+    }
+
+    pikarychev_i_sleeping_barber_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+    if (!testMpiTaskParallel.validation()) {
+      GTEST_SKIP();
+    }
+    testMpiTaskParallel.pre_processing();
+    testMpiTaskParallel.run();
+    testMpiTaskParallel.post_processing();
+
+    if (world.rank() == 0) {
+      // Served once or turned away; with room for everyone nobody is turned away
+      const auto customers = static_cast<size_t>(world.size() - 2);
+      ASSERT_EQ(report.served.size(), customers);
+      EXPECT_EQ(report.total_served() + report.starved(), customers);
+      EXPECT_EQ(report.all_waits().count(), report.total_served());
+      EXPECT_GE(report.total_served(), 1u);
+      if (capacity >= world.size()) {
+        EXPECT_EQ(report.starved(), 0u);
+      }
+    }
+  }
+}
@@ -4,10 +4,12 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <memory>
 #include <utility>
 
 #include "core/task/include/task.hpp"
+#include "util/contention/include/contention.hpp"
 
 namespace pikarychev_i_sleeping_barber_mpi {
 
@@ -21,6 +23,11 @@ class TestMPITaskParallel : public ppc::core::Task {
 
  private:
   int capacity;
+  // For an optional output, a ppc::util::ContentionReport on rank 0: a customer's wait lasts from arriving to
+  // being taken by the barber
+  ppc::util::WaitHistogram waits;
+  uint64_t served = 0;
+  double seconds = 0;
   boost::mpi::communicator world;
 };
 
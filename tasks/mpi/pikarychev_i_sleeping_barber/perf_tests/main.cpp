@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/timer.hpp>
+#include <iostream>
+#include <memory>
+
+#include "core/perf/include/perf.hpp"
+#include "mpi/pikarychev_i_sleeping_barber/include/ops_mpi.hpp"
+
+// A waiting room for one (most customers turned away) and one for everyone (long waits instead)
+static void run_perf(int capacity, bool pipeline) {
+  boost::mpi::communicator world;
+  ppc::util::ContentionReport report;
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&capacity));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(&report));
+    taskDataPar->outputs_count.emplace_back(1);
+  }
+
+  auto testMpiTaskParallel = std::make_shared<pikarychev_i_sleeping_barber_mpi::TestMPITaskParallel>(taskDataPar);
+  if (!testMpiTaskParallel->validation()) {
+    GTEST_SKIP();
+  }
+  testMpiTaskParallel->pre_processing();
+  testMpiTaskParallel->run();
+  testMpiTaskParallel->post_processing();
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 5;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testMpiTaskParallel);
+  if (pipeline) {
+    perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  } else {
+    perfAnalyzer->task_run(perfAttr, perfResults);
+  }
+
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    auto all = report.all_waits();
+    std::cout << "capacity " << capacity << ": " << report.throughput() << " customers/s, turned away "
+              << report.starved() << " of " << report.served.size() << ", wait p50 " << all.quantile(0.5) * 1e3
+              << " ms, max " << report.max_wait() * 1e3 << " ms" << std::endl;
+    EXPECT_EQ(report.total_served() + report.starved(), report.served.size());
+  }
+}
+
+TEST(pikarychev_i_sleeping_barber_mpi_perf, test_pipeline_run) { run_perf(1, true); }
+
+TEST(pikarychev_i_sleeping_barber_mpi_perf, test_task_run) {
+  boost::mpi::communicator world;
+  run_perf(world.size(), false);
+}
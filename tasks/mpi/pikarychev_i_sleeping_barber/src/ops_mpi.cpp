@@ -1,5 +1,6 @@
 #include "mpi/pikarychev_i_sleeping_barber/include/ops_mpi.hpp"
 
+#include <chrono>
 #include <random>
 #include <thread>
 #include <vector>
@@ -18,6 +19,9 @@ bool pikarychev_i_sleeping_barber_mpi::TestMPITaskParallel::pre_processing() {
   if (world.rank() == 0) {
     capacity = *reinterpret_cast<int*>(taskData->inputs[0]);
   }
+  waits = {};
+  served = 0;
+  seconds = 0;
   return true;
 }
 
@@ -33,6 +37,7 @@ bool pikarychev_i_sleeping_barber_mpi::TestMPITaskParallel::run() {
   std::mt19937 gen(dev());
 
   boost::mpi::broadcast(world, capacity, 0);
+  const auto start = std::chrono::steady_clock::now();
   const auto customers = world.size() - 2;
   const auto rank = world.rank();
 
@@ -87,6 +92,7 @@ bool pikarychev_i_sleeping_barber_mpi::TestMPITaskParallel::run() {
       std::this_thread::sleep_for(std::chrono::milliseconds(10 + gen() % 20));
 
       int waiting;
+      const auto arrived = std::chrono::steady_clock::now();
       world.send(RankCoordinator, JoinWaitingTag);
       world.recv(RankCoordinator, JoinWaitingTag, waiting);
       if (waiting >= capacity) {
@@ -94,6 +100,8 @@ bool pikarychev_i_sleeping_barber_mpi::TestMPITaskParallel::run() {
       }
 
       world.recv(RankBarber, AcceptingCustomerTag);
+      waits.add(std::chrono::duration<double>(std::chrono::steady_clock::now() - arrived).count());
+      ++served;
       std::this_thread::sleep_for(std::chrono::milliseconds(10 + gen() % 10));
       world.send(RankBarber, ReleasingBarberTag);
       world.recv(RankBarber, ReleasingBarberTag);
@@ -103,11 +111,23 @@ bool pikarychev_i_sleeping_barber_mpi::TestMPITaskParallel::run() {
   }
 
   world.barrier();
+  seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 
   return true;
 }
 
 bool pikarychev_i_sleeping_barber_mpi::TestMPITaskParallel::post_processing() {
   internal_order_test();
+  std::vector<ppc::util::WaitHistogram> all_waits;
+  std::vector<uint64_t> all_served;
+  boost::mpi::gather(world, waits, all_waits, 0);
+  boost::mpi::gather(world, served, all_served, 0);
+  if (world.rank() == RankCoordinator && !taskData->outputs.empty()) {
+    // Customers are the ranks after the barber's; those turned away count as starved
+    auto* report = reinterpret_cast<ppc::util::ContentionReport*>(taskData->outputs[0]);
+    report->seconds = seconds;
+    report->served.assign(all_served.begin() + RankBarber + 1, all_served.end());
+    report->waits.assign(all_waits.begin() + RankBarber + 1, all_waits.end());
+  }
   return true;
 }
@@ -3,6 +3,8 @@
 #include <boost/serialization/array.hpp>
 #include <boost/serialization/vector.hpp>
 
+#include "util/transport/include/transport.hpp"
+
 bool hasUniqueSolution(const std::vector<double>& augmentedMatrix1D, int n) {
   int m = n + 1;
   const double EPS = 1e-9;
@@ -140,8 +142,8 @@ bool polikanov_v_gauss_band_columns_mpi::GaussBandColumnsParallelMPI::run() {
     }
     boost::mpi::broadcast(world, iter_mat_rows, 0);
 
-    boost::mpi::broadcast(world, counts, 0);
-    boost::mpi::broadcast(world, factors, 0);
+    ppc::util::broadcast(world, counts, 0);
+    ppc::util::broadcast(world, factors, 0);
 
     std::vector<double> local_data(counts[rank]);
     std::vector<double> data_vector;
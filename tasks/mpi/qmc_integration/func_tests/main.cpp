@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <vector>
+
+#include "mpi/qmc_integration/include/ops_mpi.hpp"
+
+namespace {
+
+using ppc::util::QmcOptions;
+using ppc::util::SamplingMethod;
+
+std::shared_ptr<ppc::core::TaskData> makeTaskData(std::vector<double>& lower, std::vector<double>& upper,
+                                                  std::vector<double>& out) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(lower.data()));
+  taskData->inputs_count.emplace_back(lower.size());
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(upper.data()));
+  taskData->inputs_count.emplace_back(upper.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+  return taskData;
+}
+
+double sineProduct(const double* x, size_t dim) {
+  double r = 1.0;
+  for (size_t k = 0; k < dim; k++) r *= std::numbers::pi / 2 * std::sin(std::numbers::pi * x[k]);
+  return r;
+}
+
+template <class TaskType>
+std::vector<double> runTask(const qmc_integration_mpi::Integrand& f, std::vector<double> lower,
+                            std::vector<double> upper, const QmcOptions& options) {
+  std::vector<double> out(3, 0.0);
+  TaskType task(makeTaskData(lower, upper, out), f, options);
+  EXPECT_TRUE(task.validation());
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+  return out;
+}
+
+}  // namespace
+
+TEST(qmc_integration_mpi, every_method_converges_on_sine_product) {
+  boost::mpi::communicator world;
+  const size_t dim = 3;
+  auto f = [](const double* x) { return sineProduct(x, dim); };
+  for (auto method : {SamplingMethod::kMonteCarlo, SamplingMethod::kAntithetic, SamplingMethod::kStratified,
+                      SamplingMethod::kHalton, SamplingMethod::kSobol}) {
+    QmcOptions options;
+    options.method = method;
+    options.epsilon = 2e-3;
+    auto out = runTask<qmc_integration_mpi::QmcIntegrationParallel>(f, std::vector<double>(dim, 0.0),
+                                                                     std::vector<double>(dim, 1.0), options);
+    if (world.rank() == 0) {
+      EXPECT_LE(out[1], options.epsilon);
+      EXPECT_NEAR(out[0], 1.0, 5 * options.epsilon);
+    }
+  }
+}
+
+TEST(qmc_integration_mpi, parallel_matches_sequential) {
+  boost::mpi::communicator world;
+  auto f = [](const double* x) { return std::exp(-(x[0] * x[0] + x[1] * x[1])); };
+  std::vector<double> lower{-2.0, -2.0};
+  std::vector<double> upper{2.0, 2.0};
+  for (auto method : {SamplingMethod::kMonteCarlo, SamplingMethod::kStratified, SamplingMethod::kSobol}) {
+    QmcOptions options;
+    options.method = method;
+    options.epsilon = 3e-3;
+    auto par = runTask<qmc_integration_mpi::QmcIntegrationParallel>(f, lower, upper, options);
+    if (world.rank() == 0) {
+      auto seq = runTask<qmc_integration_mpi::QmcIntegrationSequential>(f, lower, upper, options);
+      // The same samples are evaluated, only the summation order differs
+      EXPECT_NEAR(par[0], seq[0], 1e-10);
+      EXPECT_EQ(par[2], seq[2]);
+      double exact = std::pow(std::sqrt(std::numbers::pi) * std::erf(2.0), 2);
+      EXPECT_NEAR(par[0], exact, 5 * options.epsilon);
+    }
+  }
+}
+
+TEST(qmc_integration_mpi, gives_up_at_max_samples) {
+  boost::mpi::communicator world;
+  QmcOptions options;
+  options.method = SamplingMethod::kMonteCarlo;
+  options.epsilon = 1e-9;
+  options.max_samples = 4096;
+  std::vector<double> out(3, 0.0);
+  std::vector<double> lower{0.0};
+  std::vector<double> upper{1.0};
+  qmc_integration_mpi::QmcIntegrationParallel task(makeTaskData(lower, upper, out),
+                                                   [](const double* x) { return x[0] * x[0]; }, options);
+  ASSERT_TRUE(task.validation());
+  task.pre_processing();
+  task.run();
+  task.post_processing();
+  EXPECT_FALSE(task.get_result().converged);
+  if (world.rank() == 0) {
+    EXPECT_EQ(out[2], 4096.0);
+    EXPECT_NEAR(out[0], 1.0 / 3.0, 0.05);
+  }
+}
+
+TEST(qmc_integration_mpi, validation_rejects_empty_box) {
+  std::vector<double> out(3, 0.0);
+  std::vector<double> lower{0.0, 1.0};
+  std::vector<double> upper{1.0, 1.0};
+  qmc_integration_mpi::QmcIntegrationParallel task(makeTaskData(lower, upper, out),
+                                                   [](const double* x) { return x[0]; });
+  EXPECT_FALSE(task.validation());
+}
+
+TEST(qmc_integration_mpi, validation_rejects_too_many_sobol_dimensions) {
+  std::vector<double> out(3, 0.0);
+  std::vector<double> lower(ppc::util::SobolSequence::kMaxDimension + 1, 0.0);
+  std::vector<double> upper(lower.size(), 1.0);
+  qmc_integration_mpi::QmcIntegrationParallel task(makeTaskData(lower, upper, out),
+                                                   [](const double* x) { return x[0]; });
+  EXPECT_FALSE(task.validation());
+}
+
+TEST(qmc_integration_mpi, validation_rejects_wrong_output_size) {
+  std::vector<double> out(1, 0.0);
+  std::vector<double> lower{0.0};
+  std::vector<double> upper{1.0};
+  qmc_integration_mpi::QmcIntegrationSequential task(makeTaskData(lower, upper, out),
+                                                     [](const double* x) { return x[0]; });
+  EXPECT_FALSE(task.validation());
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "util/qmc/include/qmc_integrator.hpp"
+
+namespace qmc_integration_mpi {
+
+using Integrand = std::function<double(const double*)>;
+
+// Integral of f over the box given by inputs[0] (lower corner) and inputs[1] (upper corner), both
+// inputs_count[0] doubles. outputs[0] receives three doubles: the estimate, its standard error and the
+// number of integrand evaluations spent reaching options.epsilon.
+class QmcIntegrationSequential : public ppc::core::Task {
+ public:
+  explicit QmcIntegrationSequential(std::shared_ptr<ppc::core::TaskData> taskData_, Integrand f_,
+                                    ppc::util::QmcOptions options_ = {})
+      : Task(std::move(taskData_)), f(std::move(f_)), options(options_) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  const ppc::util::QmcResult& get_result() const { return result; }
+
+ private:
+  Integrand f;
+  ppc::util::QmcOptions options;
+  std::vector<double> lower;
+  std::vector<double> upper;
+  ppc::util::QmcResult result;
+};
+
+// Every batch of sample indices is split over the ranks, which reduce only the per-batch sums
+// (two doubles, or one per replicate for Sobol/Halton) and stop together once the error is small enough.
+class QmcIntegrationParallel : public ppc::core::Task {
+ public:
+  explicit QmcIntegrationParallel(std::shared_ptr<ppc::core::TaskData> taskData_, Integrand f_,
+                                  ppc::util::QmcOptions options_ = {})
+      : Task(std::move(taskData_)), f(std::move(f_)), options(options_) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  const ppc::util::QmcResult& get_result() const { return result; }
+
+ private:
+  Integrand f;
+  ppc::util::QmcOptions options;
+  std::vector<double> lower;
+  std::vector<double> upper;
+  ppc::util::QmcResult result;
+  boost::mpi::communicator world;
+};
+
+bool validBounds(const ppc::core::TaskData& data, const ppc::util::QmcOptions& options);
+
+}  // namespace qmc_integration_mpi
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/timer.hpp>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numbers>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "mpi/qmc_integration/include/ops_mpi.hpp"
+#include "mpi/vershinina_a_integration_the_monte_carlo_method/include/ops_mpi.hpp"
+
+namespace {
+
+const size_t kDim = 6;
+
+double sineProduct(const double* x) {
+  double r = 1.0;
+  for (size_t k = 0; k < kDim; k++) r *= std::numbers::pi / 2 * std::sin(std::numbers::pi * x[k]);
+  return r;
+}
+
+std::shared_ptr<ppc::core::TaskData> makeTaskData(std::vector<double>& lower, std::vector<double>& upper,
+                                                  std::vector<double>& out) {
+  boost::mpi::communicator world;
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(lower.data()));
+    taskData->inputs_count.emplace_back(lower.size());
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(upper.data()));
+    taskData->inputs_count.emplace_back(upper.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+  }
+  return taskData;
+}
+
+ppc::util::QmcOptions perfOptions() {
+  ppc::util::QmcOptions options;
+  options.method = ppc::util::SamplingMethod::kSobol;
+  options.epsilon = 5e-5;
+  return options;
+}
+
+}  // namespace
+
+TEST(qmc_integration_mpi, test_pipeline_run) {
+  boost::mpi::communicator world;
+  std::vector<double> lower(kDim, 0.0);
+  std::vector<double> upper(kDim, 1.0);
+  std::vector<double> out(3, 0.0);
+
+  auto task = std::make_shared<qmc_integration_mpi::QmcIntegrationParallel>(makeTaskData(lower, upper, out),
+                                                                            sineProduct, perfOptions());
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    EXPECT_NEAR(out[0], 1.0, 2.5e-4);
+  }
+}
+
+TEST(qmc_integration_mpi, test_task_run) {
+  boost::mpi::communicator world;
+  std::vector<double> lower(kDim, 0.0);
+  std::vector<double> upper(kDim, 1.0);
+  std::vector<double> out(3, 0.0);
+
+  auto task = std::make_shared<qmc_integration_mpi::QmcIntegrationParallel>(makeTaskData(lower, upper, out),
+                                                                            sineProduct, perfOptions());
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(task);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    EXPECT_NEAR(out[0], 1.0, 2.5e-4);
+  }
+}
+
+// Samples needed for a standard error of 1e-3 on the integral of x^2 over [0, 1], against the
+// hit-or-miss estimator of vershinina_a_integration_the_monte_carlo_method::TestMPITaskParallel::run
+TEST(qmc_integration_mpi, samples_to_tolerance) {
+  boost::mpi::communicator world;
+  const double epsilon = 1e-3;
+  const double exact = 1.0 / 3.0;
+
+  // Hit-or-miss in the unit box has standard error sqrt(p (1 - p) / N) with p = exact
+  auto hit_or_miss_samples = static_cast<int>(std::ceil(exact * (1 - exact) / (epsilon * epsilon)));
+  std::vector<double> in{0.0, 1.0, 0.0, 1.0, static_cast<double>(hit_or_miss_samples)};
+  std::vector<double> hit_or_miss(1, 0.0);
+  auto vershininaData = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    vershininaData->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    vershininaData->inputs_count.emplace_back(in.size());
+    vershininaData->outputs.emplace_back(reinterpret_cast<uint8_t*>(hit_or_miss.data()));
+    vershininaData->outputs_count.emplace_back(hit_or_miss.size());
+  }
+  vershinina_a_integration_the_monte_carlo_method::TestMPITaskParallel vershinina(vershininaData);
+  vershinina.p = [](double x) { return x * x; };
+  ASSERT_TRUE(vershinina.validation());
+  vershinina.pre_processing();
+  vershinina.run();
+  vershinina.post_processing();
+
+  if (world.rank() == 0) {
+    std::cout << std::left << std::setw(34) << "method" << std::setw(12) << "samples" << "|error|\n";
+    std::cout << std::setw(34) << "hit-or-miss (vershinina)" << std::setw(12) << hit_or_miss_samples
+              << std::abs(hit_or_miss[0] - exact) << '\n';
+  }
+
+  const std::pair<const char*, ppc::util::SamplingMethod> methods[] = {
+      {"monte carlo", ppc::util::SamplingMethod::kMonteCarlo},
+      {"antithetic", ppc::util::SamplingMethod::kAntithetic},
+      {"stratified", ppc::util::SamplingMethod::kStratified},
+      {"scrambled halton", ppc::util::SamplingMethod::kHalton},
+      {"scrambled sobol", ppc::util::SamplingMethod::kSobol}};
+  for (const auto& [name, method] : methods) {
+    std::vector<double> lower{0.0};
+    std::vector<double> upper{1.0};
+    std::vector<double> out(3, 0.0);
+    ppc::util::QmcOptions options;
+    options.method = method;
+    options.epsilon = epsilon;
+    options.batch = 256;
+    qmc_integration_mpi::QmcIntegrationParallel task(makeTaskData(lower, upper, out),
+                                                     [](const double* x) { return x[0] * x[0]; }, options);
+    ASSERT_TRUE(task.validation());
+    task.pre_processing();
+    task.run();
+    task.post_processing();
+    if (world.rank() == 0) {
+      std::cout << std::setw(34) << name << std::setw(12) << static_cast<uint64_t>(out[2]) << std::abs(out[0] - exact)
+                << '\n';
+      EXPECT_LT(out[2], hit_or_miss_samples);
+    }
+  }
+}
@@ -0,0 +1,101 @@
+#include "mpi/qmc_integration/include/ops_mpi.hpp"
+
+#include <boost/serialization/vector.hpp>
+#include <functional>
+#include <vector>
+
+bool qmc_integration_mpi::validBounds(const ppc::core::TaskData& data, const ppc::util::QmcOptions& options) {
+  if (data.inputs.size() != 2 || data.inputs_count.size() != 2 || data.outputs.size() != 1 ||
+      data.outputs_count.size() != 1 || data.outputs_count[0] != 3) {
+    return false;
+  }
+  size_t dim = data.inputs_count[0];
+  if (dim == 0 || data.inputs_count[1] != dim || options.epsilon <= 0.0) {
+    return false;
+  }
+  if ((options.method == ppc::util::SamplingMethod::kSobol && dim > ppc::util::SobolSequence::kMaxDimension) ||
+      (options.method == ppc::util::SamplingMethod::kHalton && dim > ppc::util::HaltonSequence::kMaxDimension)) {
+    return false;
+  }
+  const auto* lo = reinterpret_cast<const double*>(data.inputs[0]);
+  const auto* hi = reinterpret_cast<const double*>(data.inputs[1]);
+  for (size_t k = 0; k < dim; k++) {
+    if (!(lo[k] < hi[k])) return false;
+  }
+  return true;
+}
+
+bool qmc_integration_mpi::QmcIntegrationSequential::pre_processing() {
+  internal_order_test();
+  auto* lo = reinterpret_cast<double*>(taskData->inputs[0]);
+  auto* hi = reinterpret_cast<double*>(taskData->inputs[1]);
+  lower.assign(lo, lo + taskData->inputs_count[0]);
+  upper.assign(hi, hi + taskData->inputs_count[1]);
+  return true;
+}
+
+bool qmc_integration_mpi::QmcIntegrationSequential::validation() {
+  internal_order_test();
+  return f && validBounds(*taskData, options);
+}
+
+bool qmc_integration_mpi::QmcIntegrationSequential::run() {
+  internal_order_test();
+  result = ppc::util::qmc_integrate(f, lower, upper, options);
+  return true;
+}
+
+bool qmc_integration_mpi::QmcIntegrationSequential::post_processing() {
+  internal_order_test();
+  auto* out = reinterpret_cast<double*>(taskData->outputs[0]);
+  out[0] = result.value;
+  out[1] = result.error;
+  out[2] = static_cast<double>(result.samples);
+  return true;
+}
+
+bool qmc_integration_mpi::QmcIntegrationParallel::pre_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    auto* lo = reinterpret_cast<double*>(taskData->inputs[0]);
+    auto* hi = reinterpret_cast<double*>(taskData->inputs[1]);
+    lower.assign(lo, lo + taskData->inputs_count[0]);
+    upper.assign(hi, hi + taskData->inputs_count[1]);
+  }
+  boost::mpi::broadcast(world, lower, 0);
+  boost::mpi::broadcast(world, upper, 0);
+  return true;
+}
+
+bool qmc_integration_mpi::QmcIntegrationParallel::validation() {
+  internal_order_test();
+  bool valid = true;
+  if (world.rank() == 0) {
+    valid = validBounds(*taskData, options);
+  }
+  boost::mpi::broadcast(world, valid, 0);
+  return valid && f;
+}
+
+bool qmc_integration_mpi::QmcIntegrationParallel::run() {
+  internal_order_test();
+  std::vector<double> reduced;
+  auto reduce = [&](std::vector<double>& sums) {
+    reduced.resize(sums.size());
+    boost::mpi::all_reduce(world, sums.data(), static_cast<int>(sums.size()), reduced.data(), std::plus<double>());
+    sums.swap(reduced);
+  };
+  result = ppc::util::qmc_integrate(f, lower, upper, options, world.rank(), world.size(), reduce);
+  return true;
+}
+
+bool qmc_integration_mpi::QmcIntegrationParallel::post_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    auto* out = reinterpret_cast<double*>(taskData->outputs[0]);
+    out[0] = result.value;
+    out[1] = result.error;
+    out[2] = static_cast<double>(result.samples);
+  }
+  return true;
+}
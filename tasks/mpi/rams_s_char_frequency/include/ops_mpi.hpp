@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace rams_s_char_frequency_mpi {
 
@@ -27,6 +28,7 @@ class TestMPITaskSequential : public ppc::core::Task {
   std::string input_;
   char target_;
   int res;
+  ppc::util::ByteHistogram histogram_;
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -40,7 +42,8 @@ class TestMPITaskParallel : public ppc::core::Task {
  private:
   std::string input_, local_input_;
   char target_;
-  int res, local_res;
+  int res;
+  ppc::util::ByteHistogram histogram_;
   boost::mpi::communicator world;
 };
 
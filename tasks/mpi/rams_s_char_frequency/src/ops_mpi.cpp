@@ -30,7 +30,8 @@ bool rams_s_char_frequency_mpi::TestMPITaskSequential::validation() {
 
 bool rams_s_char_frequency_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  res = std::count(input_.begin(), input_.end(), target_);
+  histogram_ = ppc::util::ByteHistogram(input_.data(), input_.size());
+  res = static_cast<int>(histogram_.count(target_));
   return true;
 }
 
@@ -49,7 +50,6 @@ bool rams_s_char_frequency_mpi::TestMPITaskParallel::pre_processing() {
   }
 
   res = 0;
-  local_res = 0;
   return true;
 }
 
@@ -84,8 +84,11 @@ bool rams_s_char_frequency_mpi::TestMPITaskParallel::run() {
   local_input_.resize(local_delta);
 
   boost::mpi::scatterv(world, input_.data(), sizes, displs, local_input_.data(), local_delta, 0);
-  local_res = std::count(local_input_.begin(), local_input_.end(), target_);
-  reduce(world, local_res, res, std::plus(), 0);
+  // The local histograms add up to that of the whole string: one reduce of all 256 bins
+  const ppc::util::ByteHistogram local_histogram(local_input_.data(), local_input_.size());
+  boost::mpi::reduce(world, local_histogram.data(), static_cast<int>(ppc::util::ByteHistogram::kBins),
+                     histogram_.data(), std::plus<uint64_t>(), 0);
+  res = static_cast<int>(histogram_.count(target_));
   return true;
 }
 
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <random>
+#include <vector>
+
+#include "mpi/sample_sort/include/ops_mpi.hpp"
+
+namespace sample_sort_mpi {
+
+template <class T>
+std::vector<T> getRandomVector(int sz, T low, T high) {
+  std::random_device dev;
+  std::mt19937 gen(dev());
+  std::vector<T> vec(sz);
+  for (int i = 0; i < sz; i++) {
+    if constexpr (std::is_integral_v<T>) {
+      vec[i] = std::uniform_int_distribution<T>(low, high)(gen);
+    } else {
+      vec[i] = std::uniform_real_distribution<T>(low, high)(gen);
+    }
+  }
+  return vec;
+}
+
+}  // namespace sample_sort_mpi
+
+template <class T>
+void run_sample_sort_test(std::vector<T> in) {
+  boost::mpi::communicator world;
+  std::vector<T> out(in.size());
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskDataPar->inputs_count.emplace_back(in.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskDataPar->outputs_count.emplace_back(out.size());
+  }
+
+  sample_sort_mpi::SampleSortParallel<T> sampleSortParallel(taskDataPar);
+  ASSERT_TRUE(sampleSortParallel.validation());
+  sampleSortParallel.pre_processing();
+  sampleSortParallel.run();
+  sampleSortParallel.post_processing();
+
+  if (world.rank() == 0) {
+    std::sort(in.begin(), in.end());
+    ASSERT_EQ(in, out);
+  }
+}
+
+TEST(sample_sort_mpi, test_empty_input_fails_validation) {
+  boost::mpi::communicator world;
+  std::vector<int> in;
+  std::vector<int> out;
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskDataPar->inputs_count.emplace_back(in.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskDataPar->outputs_count.emplace_back(out.size());
+  }
+
+  sample_sort_mpi::SampleSortParallel<int> sampleSortParallel(taskDataPar);
+  if (world.rank() == 0) {
+    ASSERT_FALSE(sampleSortParallel.validation());
+  }
+}
+
+TEST(sample_sort_mpi, test_single_element) { run_sample_sort_test<int>({42}); }
+
+TEST(sample_sort_mpi, test_fewer_elements_than_processes) { run_sample_sort_test<int>({3, -1, 2}); }
+
+TEST(sample_sort_mpi, test_reversed_int) {
+  std::vector<int> in(1001);
+  for (int i = 0; i < 1001; i++) {
+    in[i] = 1001 - i;
+  }
+  run_sample_sort_test<int>(in);
+}
+
+TEST(sample_sort_mpi, test_all_equal_int) { run_sample_sort_test<int>(std::vector<int>(777, 5)); }
+
+TEST(sample_sort_mpi, test_many_duplicates_int) {
+  run_sample_sort_test<int>(sample_sort_mpi::getRandomVector<int>(5000, 0, 3));
+}
+
+TEST(sample_sort_mpi, test_random_int_10007) {
+  run_sample_sort_test<int>(sample_sort_mpi::getRandomVector<int>(10007, -100000, 100000));
+}
+
+TEST(sample_sort_mpi, test_random_double_9973) {
+  run_sample_sort_test<double>(sample_sort_mpi::getRandomVector<double>(9973, -1e6, 1e6));
+}
+
+TEST(sample_sort_mpi, test_sample_sort_keeps_pieces_in_rank_order) {
+  boost::mpi::communicator world;
+  std::vector<double> local = sample_sort_mpi::getRandomVector<double>(500 + 37 * world.rank(), -1.0, 1.0);
+  size_t local_size = local.size();
+
+  std::vector<double> sorted = sample_sort_mpi::sample_sort(world, local);
+  ASSERT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+
+  size_t total_in = 0;
+  size_t total_out = 0;
+  boost::mpi::all_reduce(world, local_size, total_in, std::plus<>());
+  boost::mpi::all_reduce(world, sorted.size(), total_out, std::plus<>());
+  ASSERT_EQ(total_in, total_out);
+
+  // The largest key of a rank must not exceed the smallest key of any later rank
+  double my_max = sorted.empty() ? -2.0 : sorted.back();
+  std::vector<double> maxima;
+  boost::mpi::all_gather(world, my_max, maxima);
+  double seen_max = -2.0;
+  for (int r = 0; r < world.rank(); r++) {
+    seen_max = std::max(seen_max, maxima[r]);
+  }
+  if (!sorted.empty()) {
+    ASSERT_LE(seen_max, sorted.front());
+  }
+}
+
+TEST(sample_sort_mpi, test_kway_merge) {
+  std::vector<int> data = {1, 4, 9, 2, 3, 10, 0, 5};
+  std::vector<int> offsets = {0, 3, 3, 6, 8};
+  std::vector<int> expected = {0, 1, 2, 3, 4, 5, 9, 10};
+  ASSERT_EQ(sample_sort_mpi::kway_merge(data, offsets), expected);
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace sample_sort_mpi {
+
+// Merges the sorted runs [offsets[k], offsets[k + 1]) of data with a min-heap over the run heads
+template <class T>
+std::vector<T> kway_merge(const std::vector<T>& data, const std::vector<int>& offsets) {
+  using Head = std::pair<T, int>;
+  auto greater = [](const Head& a, const Head& b) { return a.first > b.first; };
+  std::priority_queue<Head, std::vector<Head>, decltype(greater)> heap(greater);
+
+  int runs = static_cast<int>(offsets.size()) - 1;
+  std::vector<int> pos(offsets.begin(), offsets.end() - 1);
+  for (int k = 0; k < runs; k++) {
+    if (pos[k] < offsets[k + 1]) {
+      heap.emplace(data[pos[k]], k);
+    }
+  }
+
+  std::vector<T> result;
+  result.reserve(data.size());
+  while (!heap.empty()) {
+    auto [value, k] = heap.top();
+    heap.pop();
+    result.push_back(value);
+    if (++pos[k] < offsets[k + 1]) {
+      heap.emplace(data[pos[k]], k);
+    }
+  }
+  return result;
+}
+
+// Parallel sorting by regular sampling. Every rank sorts its part, p regular samples per rank give p - 1
+// global splitters, one all-to-all moves each element to the rank owning its splitter interval and the p
+// received runs are merged locally. Ranks end up with consecutive, individually sorted pieces of the result.
+template <class T>
+std::vector<T> sample_sort(const boost::mpi::communicator& world, std::vector<T> local) {
+  int p = world.size();
+  std::sort(local.begin(), local.end());
+  if (p == 1) {
+    return local;
+  }
+
+  // A rank with fewer than p elements repeats its samples, an empty rank sends T{} placeholders that are dropped below
+  std::vector<T> samples(p, T{});
+  int local_size = static_cast<int>(local.size());
+  std::vector<int> sample_counts;
+  boost::mpi::all_gather(world, local_size, sample_counts);
+  for (int i = 0; i < p && local_size > 0; i++) {
+    samples[i] = local[static_cast<size_t>(i) * local_size / p];
+  }
+
+  std::vector<T> all_samples(p * p);
+  boost::mpi::all_gather(world, samples.data(), p, all_samples.data());
+  // Samples of empty ranks carry no information about the distribution
+  std::vector<T> valid_samples;
+  for (int r = 0; r < p; r++) {
+    if (sample_counts[r] > 0) {
+      valid_samples.insert(valid_samples.end(), all_samples.begin() + r * p, all_samples.begin() + (r + 1) * p);
+    }
+  }
+  std::sort(valid_samples.begin(), valid_samples.end());
+
+  std::vector<int> send_counts(p, 0);
+  int begin = 0;
+  for (int r = 0; r < p; r++) {
+    int end = local_size;
+    if (r + 1 < p && !valid_samples.empty()) {
+      const T& splitter = valid_samples[static_cast<size_t>(r + 1) * valid_samples.size() / p];
+      end = static_cast<int>(std::upper_bound(local.begin() + begin, local.end(), splitter) - local.begin());
+    }
+    send_counts[r] = end - begin;
+    begin = end;
+  }
+
+  std::vector<int> recv_counts(p);
+  boost::mpi::all_to_all(world, send_counts, recv_counts);
+
+  std::vector<int> send_displs(p, 0);
+  std::vector<int> recv_displs(p + 1, 0);
+  for (int r = 1; r < p; r++) {
+    send_displs[r] = send_displs[r - 1] + send_counts[r - 1];
+  }
+  for (int r = 0; r < p; r++) {
+    recv_displs[r + 1] = recv_displs[r] + recv_counts[r];
+  }
+
+  std::vector<T> received(recv_displs[p]);
+  MPI_Alltoallv(local.data(), send_counts.data(), send_displs.data(), boost::mpi::get_mpi_datatype<T>(),
+                received.data(), recv_counts.data(), recv_displs.data(), boost::mpi::get_mpi_datatype<T>(), world);
+
+  return kway_merge(received, recv_displs);
+}
+
+template <class T>
+class SampleSortParallel : public ppc::core::Task {
+ public:
+  explicit SampleSortParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  std::vector<T> input_;
+  std::vector<T> res_;
+  int size_ = 0;
+  boost::mpi::communicator world;
+};
+
+}  // namespace sample_sort_mpi
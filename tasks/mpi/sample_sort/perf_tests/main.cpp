@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/timer.hpp>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "mpi/kondratev_ya_radix_sort_batcher_merge/include/ops_mpi.hpp"
+#include "mpi/kovalev_k_bubble_sort_oddeven_transposition/include/header.hpp"
+#include "mpi/sample_sort/include/ops_mpi.hpp"
+
+namespace {
+
+std::vector<double> getRandomVector(int sz) {
+  std::random_device dev;
+  std::mt19937 gen(dev());
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  std::vector<double> vec(sz);
+  for (int i = 0; i < sz; i++) {
+    vec[i] = dist(gen);
+  }
+  return vec;
+}
+
+std::shared_ptr<ppc::core::TaskData> makeTaskData(std::vector<double>& in, std::vector<double>& out) {
+  boost::mpi::communicator world;
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskDataPar->inputs_count.emplace_back(in.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskDataPar->outputs_count.emplace_back(out.size());
+  }
+  return taskDataPar;
+}
+
+double measure(ppc::core::Task& task) {
+  boost::mpi::communicator world;
+  task.validation();
+  task.pre_processing();
+  world.barrier();
+  const boost::mpi::timer current_timer;
+  task.run();
+  double elapsed = current_timer.elapsed();
+  task.post_processing();
+  return elapsed;
+}
+
+}  // namespace
+
+TEST(sample_sort_mpi, test_pipeline_run) {
+  boost::mpi::communicator world;
+  std::vector<double> in = getRandomVector(2000000);
+  std::vector<double> out(in.size());
+
+  auto sampleSortParallel =
+      std::make_shared<sample_sort_mpi::SampleSortParallel<double>>(makeTaskData(in, out));
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(sampleSortParallel);
+  perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    ASSERT_TRUE(std::is_sorted(out.begin(), out.end()));
+  }
+}
+
+TEST(sample_sort_mpi, test_task_run) {
+  boost::mpi::communicator world;
+  std::vector<double> in = getRandomVector(2000000);
+  std::vector<double> out(in.size());
+
+  auto sampleSortParallel =
+      std::make_shared<sample_sort_mpi::SampleSortParallel<double>>(makeTaskData(in, out));
+  sampleSortParallel->validation();
+  sampleSortParallel->pre_processing();
+  sampleSortParallel->run();
+  sampleSortParallel->post_processing();
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(sampleSortParallel);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    ASSERT_TRUE(std::is_sorted(out.begin(), out.end()));
+  }
+}
+
+// Weak scaling: the number of elements per process stays fixed while the process count grows. The bubble sort
+// task sorts every block in O(m^2), so it gets a smaller block than the other two.
+TEST(sample_sort_mpi, test_weak_scaling_against_odd_even_sorts) {
+  boost::mpi::communicator world;
+  const int per_process = 200000;
+  const int per_process_bubble = 2000;
+
+  std::vector<double> in = getRandomVector(per_process * world.size());
+  std::vector<double> out(in.size());
+  sample_sort_mpi::SampleSortParallel<double> sampleSort(makeTaskData(in, out));
+  double sample_time = measure(sampleSort);
+
+  std::vector<double> out_radix(in.size());
+  kondratev_ya_radix_sort_batcher_merge_mpi::TestMPITaskParallel radixOddEven(makeTaskData(in, out_radix));
+  double radix_time = measure(radixOddEven);
+
+  std::vector<double> in_bubble = getRandomVector(per_process_bubble * world.size());
+  std::vector<double> out_bubble(in_bubble.size());
+  std::vector<double> out_bubble_sample(in_bubble.size());
+  kovalev_k_bubble_sort_oddeven_transposition_mpi::BubbleSortOddEvenTranspositionPar<double> bubbleOddEven(
+      makeTaskData(in_bubble, out_bubble));
+  double bubble_time = measure(bubbleOddEven);
+  sample_sort_mpi::SampleSortParallel<double> sampleSortSmall(makeTaskData(in_bubble, out_bubble_sample));
+  double sample_small_time = measure(sampleSortSmall);
+
+  if (world.rank() == 0) {
+    std::cout << "processes: " << world.size() << std::endl;
+    std::cout << per_process << " per process: sample sort " << sample_time << " s, radix + odd-even merge "
+              << radix_time << " s" << std::endl;
+    std::cout << per_process_bubble << " per process: sample sort " << sample_small_time
+              << " s, bubble + odd-even transposition " << bubble_time << " s" << std::endl;
+    ASSERT_EQ(out, out_radix);
+    ASSERT_EQ(out_bubble, out_bubble_sample);
+  }
+}
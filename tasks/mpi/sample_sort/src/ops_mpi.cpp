@@ -0,0 +1,69 @@
+#include "mpi/sample_sort/include/ops_mpi.hpp"
+
+#include <boost/mpi/collectives/gatherv.hpp>
+#include <boost/mpi/collectives/scatterv.hpp>
+#include <cstring>
+
+template <class T>
+bool sample_sort_mpi::SampleSortParallel<T>::pre_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    auto* input = reinterpret_cast<T*>(taskData->inputs[0]);
+    size_ = static_cast<int>(taskData->inputs_count[0]);
+    input_.assign(input, input + size_);
+    res_.resize(size_);
+  }
+  return true;
+}
+
+template <class T>
+bool sample_sort_mpi::SampleSortParallel<T>::validation() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    return !taskData->inputs.empty() && !taskData->outputs.empty() && !taskData->inputs_count.empty() &&
+           !taskData->outputs_count.empty() && taskData->inputs_count[0] > 0 &&
+           taskData->inputs_count[0] == taskData->outputs_count[0];
+  }
+  return true;
+}
+
+template <class T>
+bool sample_sort_mpi::SampleSortParallel<T>::run() {
+  internal_order_test();
+  boost::mpi::broadcast(world, size_, 0);
+
+  std::vector<int> sizes(world.size(), size_ / world.size());
+  for (int i = 0; i < size_ % world.size(); i++) {
+    sizes[i]++;
+  }
+  std::vector<T> local(sizes[world.rank()]);
+  if (world.rank() == 0) {
+    boost::mpi::scatterv(world, input_.data(), sizes, local.data(), 0);
+  } else {
+    boost::mpi::scatterv(world, local.data(), sizes[world.rank()], 0);
+  }
+
+  std::vector<T> sorted = sample_sort(world, std::move(local));
+
+  int sorted_size = static_cast<int>(sorted.size());
+  std::vector<int> sorted_sizes;
+  boost::mpi::gather(world, sorted_size, sorted_sizes, 0);
+  if (world.rank() == 0) {
+    boost::mpi::gatherv(world, sorted.data(), sorted_size, res_.data(), sorted_sizes, 0);
+  } else {
+    boost::mpi::gatherv(world, sorted.data(), sorted_size, 0);
+  }
+  return true;
+}
+
+template <class T>
+bool sample_sort_mpi::SampleSortParallel<T>::post_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    memcpy(reinterpret_cast<T*>(taskData->outputs[0]), res_.data(), sizeof(T) * res_.size());
+  }
+  return true;
+}
+
+template class sample_sort_mpi::SampleSortParallel<int>;
+template class sample_sort_mpi::SampleSortParallel<double>;
@@ -2,6 +2,7 @@
 
 #include <boost/mpi.hpp>
 #include <string>
+#include <vector>
 
 #include "core/task/include/task.hpp"
 
@@ -29,7 +30,7 @@ class ParallelTask : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::string input_a_, input_b_;
+  std::vector<char> interleaved_;
   int result_{};
 
   boost::mpi::communicator world;
@@ -1,7 +1,12 @@
 #include "mpi/sarafanov_m_num_of_mismatch_characters_of_two_strings/include/ops_mpi.hpp"
 
+#include <algorithm>
 #include <boost/mpi.hpp>
+#include <cstdint>
 #include <string>
+#include <vector>
+
+#include "util/text/include/text.hpp"
 
 bool sarafanov_m_num_of_mismatch_characters_of_two_strings_mpi::SequentialTask::validation() {
   internal_order_test();
@@ -18,11 +23,7 @@ bool sarafanov_m_num_of_mismatch_characters_of_two_strings_mpi::SequentialTask::
 
 bool sarafanov_m_num_of_mismatch_characters_of_two_strings_mpi::SequentialTask::run() {
   internal_order_test();
-  for (size_t i = 0; i < input_a_.size(); ++i) {
-    if (input_a_[i] != input_b_[i]) {
-      result_++;
-    }
-  }
+  result_ = static_cast<int>(ppc::util::count_mismatches(input_a_.data(), input_b_.data(), input_a_.size()));
   return true;
 }
 
@@ -43,8 +44,17 @@ bool sarafanov_m_num_of_mismatch_characters_of_two_strings_mpi::ParallelTask::va
 bool sarafanov_m_num_of_mismatch_characters_of_two_strings_mpi::ParallelTask::pre_processing() {
   internal_order_test();
   if (world.rank() == 0) {
-    input_a_.assign(reinterpret_cast<char *>(taskData->inputs[0]), taskData->inputs_count[0]);
-    input_b_.assign(reinterpret_cast<char *>(taskData->inputs[1]), taskData->inputs_count[1]);
+    // The part of each process is its slice of a followed by the same slice of b, so that one scatterv sends both
+    const size_t size = taskData->inputs_count[0];
+    const auto *a = reinterpret_cast<char *>(taskData->inputs[0]);
+    const auto *b = reinterpret_cast<char *>(taskData->inputs[1]);
+    interleaved_.resize(2 * size);
+    for (int p = 0; p < world.size(); ++p) {
+      const size_t begin = size * p / world.size();
+      const size_t end = size * (p + 1) / world.size();
+      std::copy(a + begin, a + end, interleaved_.begin() + 2 * begin);
+      std::copy(b + begin, b + end, interleaved_.begin() + begin + end);
+    }
     result_ = 0;
   }
   return true;
@@ -52,34 +62,25 @@ bool sarafanov_m_num_of_mismatch_characters_of_two_strings_mpi::ParallelTask::pr
 
 bool sarafanov_m_num_of_mismatch_characters_of_two_strings_mpi::ParallelTask::run() {
   internal_order_test();
-  std::string local_input_a;
-  std::string local_input_b;
+  uint64_t size = interleaved_.size() / 2;
+  boost::mpi::broadcast(world, size, 0);
+  auto begin = [&](int p) { return static_cast<int>(size * p / world.size()); };
+  const int local_size = begin(world.rank() + 1) - begin(world.rank());
+  std::vector<char> local_input(2 * local_size);
   if (world.rank() == 0) {
-    auto base_size = input_a_.size() / world.size();
-    auto remainder = input_a_.size() % world.size();
-    local_input_a = input_a_.substr(0, base_size);
-    local_input_b = input_b_.substr(0, base_size);
-
-    auto start = base_size;
-    for (int p = 1; p < world.size(); ++p) {
-      auto size = base_size + (p <= int(remainder) ? 1 : 0);
-
-      world.send(p, 0, input_a_.substr(start, size));
-      world.send(p, 0, input_b_.substr(start, size));
-
-      start += size;
+    std::vector<int> sizes(world.size());
+    std::vector<int> displs(world.size());
+    for (int p = 0; p < world.size(); ++p) {
+      sizes[p] = 2 * (begin(p + 1) - begin(p));
+      displs[p] = 2 * begin(p);
     }
+    boost::mpi::scatterv(world, interleaved_.data(), sizes, displs, local_input.data(), 2 * local_size, 0);
   } else {
-    world.recv(0, 0, local_input_a);
-    world.recv(0, 0, local_input_b);
+    boost::mpi::scatterv(world, local_input.data(), 2 * local_size, 0);
   }
 
-  auto local_result = 0;
-  for (size_t i = 0; i < local_input_a.size(); ++i) {
-    if (local_input_a[i] != local_input_b[i]) {
-      local_result++;
-    }
-  }
+  const auto local_result =
+      static_cast<int>(ppc::util::count_mismatches(local_input.data(), local_input.data() + local_size, local_size));
   boost::mpi::reduce(world, local_result, result_, std::plus(), 0);
   return true;
 }
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace shkurinskaya_e_count_sentences_mpi {
 
@@ -36,7 +37,6 @@ class TestMPITaskParallel : public ppc::core::Task {
  private:
   std::string text, local_input_;
   int res{};
-  int local_res{};
   boost::mpi::communicator world;
 };
 
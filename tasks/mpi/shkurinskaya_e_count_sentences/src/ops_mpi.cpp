@@ -21,18 +21,10 @@ bool shkurinskaya_e_count_sentences_mpi::TestMPITaskSequential::validation() {
 
 bool shkurinskaya_e_count_sentences_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  bool in_end = false;
-  for (size_t i = 0; i < text.size(); i++) {
-    char ch = text[i];
-    if (ch == '!' || ch == '?' || ch == '.') {
-      if (!in_end) {
-        res++;
-        in_end = true;
-      }
-    } else if (ch != ' ') {
-      in_end = false;
-    }
-  }
+  // A terminator opens a new ending unless the last non-space character before it was a terminator too
+  const auto ends = ppc::util::ByteClass::sentence_end();
+  const auto spaces = ppc::util::ByteClass::of(" ");
+  res = static_cast<int>(ppc::util::count_preceded(text.data(), text.size(), ends, ~(ends | spaces), spaces, true));
   return true;
 }
 
@@ -47,7 +39,6 @@ bool shkurinskaya_e_count_sentences_mpi::TestMPITaskParallel::pre_processing() {
   if (world.rank() == 0) {
     text = *reinterpret_cast<std::string*>(taskData->inputs[0]);
   }
-  local_res = 0;
   return true;
 }
 
@@ -61,47 +52,32 @@ bool shkurinskaya_e_count_sentences_mpi::TestMPITaskParallel::validation() {
 
 bool shkurinskaya_e_count_sentences_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  size_t delta;
-  size_t remainder;
+  size_t total_size = 0;
   if (world.rank() == 0) {
-    size_t total_size = text.size();
-    delta = total_size / world.size();
-    remainder = total_size % world.size();
+    total_size = text.size();
+  }
+  broadcast(world, total_size, 0);
+  // Cut anywhere: instead of passing the state from rank to rank, each rank tallies its part independently and
+  // the tallies are joined in rank order by the reduction
+  std::vector<int> sizes(world.size());
+  std::vector<int> displs(world.size());
+  for (int proc = 0; proc < world.size(); ++proc) {
+    displs[proc] = static_cast<int>(total_size * proc / world.size());
+    sizes[proc] = static_cast<int>(total_size * (proc + 1) / world.size()) - displs[proc];
   }
-  broadcast(world, delta, 0);
-  broadcast(world, remainder, 0);
+  local_input_.resize(sizes[world.rank()]);
   if (world.rank() == 0) {
-    for (int proc = 1; proc < world.size(); ++proc) {
-      size_t start_index = proc * delta;
-      size_t length = (proc == world.size() - 1) ? delta + remainder : delta;
-      world.send(proc, 0, text.data() + start_index, length);
-    }
-    size_t length = (world.size() == 1) ? text.size() : delta;
-    local_input_.assign(text.begin(), text.begin() + length);
+    scatterv(world, text.data(), sizes, displs, local_input_.data(), sizes[0], 0);
   } else {
-    size_t length = (world.rank() == world.size() - 1) ? delta + remainder : delta;
-    local_input_.resize(length);
-    world.recv(0, 0, local_input_.data(), length);
-  }
-  bool in_end = false;
-  if (world.rank() != 0) {
-    world.recv(world.rank() - 1, 0, in_end);
-  }
-  for (size_t i = 0; i < local_input_.size(); ++i) {
-    char ch = local_input_[i];
-    if (ch == '!' || ch == '?' || ch == '.') {
-      if (!in_end) {
-        local_res++;
-        in_end = true;
-      }
-    } else if (ch != ' ') {
-      in_end = false;
-    }
-  }
-  if (world.rank() != world.size() - 1) {
-    world.send(world.rank() + 1, 0, in_end);
+    scatterv(world, local_input_.data(), sizes[world.rank()], 0);
   }
-  boost::mpi::reduce(world, local_res, res, std::plus<>(), 0);
+  const auto ends = ppc::util::ByteClass::sentence_end();
+  const auto spaces = ppc::util::ByteClass::of(" ");
+  const auto local_tally =
+      ppc::util::tally_preceded(local_input_.data(), local_input_.size(), ends, ~(ends | spaces), spaces);
+  ppc::util::PrecededTally tally;
+  reduce(world, local_tally, tally, std::plus<>(), 0);
+  res = static_cast<int>(tally.count(true));
   return true;
 }
 
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/contrast/include/contrast.hpp"
 
 namespace shuravina_o_contrast {
 
@@ -17,7 +18,7 @@ class ContrastTaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<uint8_t> input_, local_input_, output_;
+  std::vector<uint8_t> input_, local_input_, local_output_;
   uint8_t min_val_, max_val_;
   boost::mpi::communicator world;
 };
@@ -2,21 +2,18 @@
 
 #include <algorithm>
 #include <boost/mpi/collectives.hpp>
-#include <limits>
 
 namespace shuravina_o_contrast {
 
 bool ContrastTaskParallel::pre_processing() {
   internal_order_test();
 
-  if (taskData->inputs_count.empty() || taskData->outputs_count.empty()) {
-    return false;
-  }
-
-  input_ = std::vector<uint8_t>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<uint8_t*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
+  if (world.rank() == 0) {
+    if (taskData->inputs_count.empty() || taskData->outputs_count.empty()) {
+      return false;
+    }
+    auto* tmp_ptr = reinterpret_cast<uint8_t*>(taskData->inputs[0]);
+    input_.assign(tmp_ptr, tmp_ptr + taskData->inputs_count[0]);
   }
 
   return true;
@@ -34,48 +31,43 @@ bool ContrastTaskParallel::validation() {
 bool ContrastTaskParallel::run() {
   internal_order_test();
 
-  unsigned int delta = taskData->inputs_count[0] / world.size();
-  broadcast(world, delta, 0);
+  unsigned int total = input_.size();
+  broadcast(world, total, 0);
 
-  local_input_ = std::vector<uint8_t>(delta);
+  // Every byte is dealt out, the remainder included
+  std::vector<int> counts(world.size());
+  std::vector<int> displs(world.size());
+  for (int proc = 0; proc < world.size(); proc++) {
+    displs[proc] = static_cast<int>(static_cast<uint64_t>(total) * proc / world.size());
+    counts[proc] = static_cast<int>(static_cast<uint64_t>(total) * (proc + 1) / world.size()) - displs[proc];
+  }
+
+  local_input_.resize(counts[world.rank()]);
   if (world.rank() == 0) {
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + proc * delta, delta);
-    }
-    local_input_ = std::vector<uint8_t>(input_.begin(), input_.begin() + delta);
+    boost::mpi::scatterv(world, input_.data(), counts, displs, local_input_.data(), counts[0], 0);
   } else {
-    world.recv(0, 0, local_input_.data(), delta);
+    boost::mpi::scatterv(world, local_input_.data(), counts[world.rank()], 0);
   }
 
-  min_val_ = *std::min_element(local_input_.begin(), local_input_.end());
-  max_val_ = *std::max_element(local_input_.begin(), local_input_.end());
+  // Every rank needs the global range, so min and max go through one all_reduce as the minimum of {min, -max}
+  auto stats = ppc::util::channel_stats(local_input_.data(), local_input_.size());
+  int local_bounds[2]{stats.min, -stats.max};
+  int bounds[2];
+  boost::mpi::all_reduce(world, local_bounds, 2, bounds, boost::mpi::minimum<int>());
+  min_val_ = bounds[0];
+  max_val_ = -bounds[1];
 
-  uint8_t global_min;
-  uint8_t global_max;
-  reduce(world, min_val_, global_min, boost::mpi::minimum<uint8_t>(), 0);
-  reduce(world, max_val_, global_max, boost::mpi::maximum<uint8_t>(), 0);
-  min_val_ = global_min;
-  max_val_ = global_max;
-
-  output_ = std::vector<uint8_t>(delta);
-  if (max_val_ == min_val_) {
-    std::fill(output_.begin(), output_.end(), 128);
-  } else {
-    for (size_t i = 0; i < local_input_.size(); ++i) {
-      output_[i] = static_cast<uint8_t>((local_input_[i] - min_val_) * 255.0 / (max_val_ - min_val_));
-    }
-  }
+  auto lut = ppc::util::make_lut([this](uint8_t v) {
+    return max_val_ == min_val_ ? 128 : static_cast<int>((v - min_val_) * 255.0 / (max_val_ - min_val_));
+  });
+  local_output_.resize(local_input_.size());
+  ppc::util::apply_lut(lut, local_input_.data(), local_output_.data(), local_input_.size());
 
   if (world.rank() == 0) {
     auto* tmp_ptr = reinterpret_cast<uint8_t*>(taskData->outputs[0]);
-    for (unsigned i = 0; i < delta; i++) {
-      tmp_ptr[i] = output_[i];
-    }
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.recv(proc, 0, tmp_ptr + proc * delta, delta);
-    }
+    boost::mpi::gatherv(world, local_output_.data(), counts[0], tmp_ptr, counts, displs, 0);
   } else {
-    world.send(0, 0, output_.data(), delta);
+    boost::mpi::gatherv(world, local_output_.data(), counts[world.rank()], 0);
   }
 
   return true;
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace shvedova_v_char_freq_mpi {
 
@@ -29,6 +30,7 @@ class CharFrequencySequential : public ppc::core::Task {
   std::vector<char> input_str_;
   char target_char_;
   int res{};
+  ppc::util::ByteHistogram histogram_;
 };
 
 class CharFrequencyParallel : public ppc::core::Task {
@@ -45,7 +47,7 @@ class CharFrequencyParallel : public ppc::core::Task {
   std::vector<char> local_input_;
   char target_char_;
   int res{};
-  int local_res{};
+  ppc::util::ByteHistogram histogram_;
 
   boost::mpi::communicator world;
 };
@@ -32,7 +32,8 @@ bool shvedova_v_char_freq_mpi::CharFrequencySequential::validation() {
 bool shvedova_v_char_freq_mpi::CharFrequencySequential::run() {
   internal_order_test();
 
-  res = std::count(input_str_.begin(), input_str_.end(), target_char_);
+  histogram_ = ppc::util::ByteHistogram(input_str_.data(), input_str_.size());
+  res = static_cast<int>(histogram_.count(target_char_));
   return true;
 }
 
@@ -78,7 +79,6 @@ bool shvedova_v_char_freq_mpi::CharFrequencyParallel::pre_processing() {
 
   boost::mpi::scatterv(world, input_str_.data(), send_counts, displs, local_input_.data(), loc_vec_size, 0);
 
-  local_res = 0;
   res = 0;
   return true;
 }
@@ -93,9 +93,11 @@ bool shvedova_v_char_freq_mpi::CharFrequencyParallel::validation() {
 
 bool shvedova_v_char_freq_mpi::CharFrequencyParallel::run() {
   internal_order_test();
-  local_res = std::count(local_input_.begin(), local_input_.end(), target_char_);
-
-  boost::mpi::reduce(world, local_res, res, std::plus<>(), 0);
+  // The local histograms add up to that of the whole string: one reduce of all 256 bins
+  const ppc::util::ByteHistogram local_histogram(local_input_.data(), local_input_.size());
+  boost::mpi::reduce(world, local_histogram.data(), static_cast<int>(ppc::util::ByteHistogram::kBins),
+                     histogram_.data(), std::plus<uint64_t>(), 0);
+  res = static_cast<int>(histogram_.count(target_char_));
   return true;
 }
 
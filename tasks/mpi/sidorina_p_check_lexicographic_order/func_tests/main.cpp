@@ -436,4 +436,31 @@ TEST(sidorina_p_check_lexicographic_order_mpi, Test_difference_3_and_2_equal_ele
     ASSERT_EQ(ref_res[0], res[0]);
     ASSERT_EQ(1, res[0]);
   }
-}
\ No newline at end of file
+}
+TEST(sidorina_p_check_lexicographic_order_mpi, Test_difference_after_long_equal_part) {
+  boost::mpi::communicator world;
+  // Differences inside the prefix compared first, in the slices sent to the processes, and only in the length
+  for (int pos : {1000, 4096, 6000, 9999, 10000}) {
+    std::vector<std::vector<char>> str_ = {std::vector<char>(10000, 'k'), std::vector<char>(10001, 'k')};
+    if (pos < 10000) str_[1][pos] = 'a';
+    std::vector<int32_t> res(1, 0);
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(str_[0].data()));
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(str_[1].data()));
+      taskDataPar->inputs_count.emplace_back(str_.size());
+      taskDataPar->inputs_count.emplace_back(str_[0].size());
+      taskDataPar->inputs_count.emplace_back(str_[1].size());
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(res.data()));
+      taskDataPar->outputs_count.emplace_back(res.size());
+    }
+    sidorina_p_check_lexicographic_order_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+    ASSERT_EQ(testMpiTaskParallel.validation(), true);
+    testMpiTaskParallel.pre_processing();
+    testMpiTaskParallel.run();
+    testMpiTaskParallel.post_processing();
+    if (world.rank() == 0) {
+      EXPECT_EQ(pos < 10000 ? 1 : 0, res[0]) << pos;
+    }
+  }
+}
@@ -2,12 +2,15 @@
 #include "mpi/sidorina_p_check_lexicographic_order/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <random>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "util/text/include/text.hpp"
+
 using namespace std::chrono_literals;
 
 bool sidorina_p_check_lexicographic_order_mpi::TestMPITaskSequential::pre_processing() {
@@ -16,7 +19,7 @@ bool sidorina_p_check_lexicographic_order_mpi::TestMPITaskSequential::pre_proces
   for (unsigned int i = 0; i < 2; i++) input_[i].resize(taskData->inputs_count[i + 1]);
   for (size_t i = 0; i < taskData->inputs_count[0]; ++i) {
     const char* tmp_ptr = reinterpret_cast<const char*>(taskData->inputs[i]);
-    std::copy(tmp_ptr, tmp_ptr + taskData->inputs_count[1], input_[i].begin());
+    std::copy(tmp_ptr, tmp_ptr + taskData->inputs_count[i + 1], input_[i].begin());
   }
   res = 0;
   return true;
@@ -58,32 +61,13 @@ bool sidorina_p_check_lexicographic_order_mpi::TestMPITaskSequential::post_proce
 
 bool sidorina_p_check_lexicographic_order_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
-  if (world.rank() == 0) {
-    delta = std::min(taskData->inputs_count[1], taskData->inputs_count[2]) / world.size();
-  }
-  broadcast(world, delta, 0);
   if (world.rank() == 0) {
     input_.resize(taskData->inputs_count[0]);
-    for (unsigned int i = 0; i < 2; i++) input_[i].resize(taskData->inputs_count[i + 1]);
     for (unsigned int i = 0; i < taskData->inputs_count[0]; i++) {
       auto* tmp_ptr = reinterpret_cast<char*>(taskData->inputs[i]);
-      std::copy(tmp_ptr, tmp_ptr + taskData->inputs_count[1], input_[i].begin());
-    }
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_[0].data() + delta * proc, delta);
-      world.send(proc, 1, input_[1].data() + delta * proc, delta);
+      input_[i].assign(tmp_ptr, tmp_ptr + taskData->inputs_count[i + 1]);
     }
   }
-  if (world.rank() == 0) {
-    local_input1_ = std::vector<char>(input_[0].begin(), input_[0].begin() + delta);
-    local_input2_ = std::vector<char>(input_[1].begin(), input_[1].begin() + delta);
-  } else {
-    local_input1_.resize(delta);
-    local_input2_.resize(delta);
-    world.recv(0, 0, local_input1_.data(), delta);
-    world.recv(0, 1, local_input2_.data(), delta);
-  }
   res = 2;
   return true;
 }
@@ -98,32 +82,46 @@ bool sidorina_p_check_lexicographic_order_mpi::TestMPITaskParallel::validation()
 
 bool sidorina_p_check_lexicographic_order_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  int local_res = 2;
-  for (size_t i = 0; i < local_input1_.size(); i++) {
-    if (local_input1_[i] > local_input2_[i]) {
-      local_res = 1;
-      break;
+  // The root compares a prefix before sending anything, which decides most strings. Strings equal in it are
+  // scattered in slices aligned to 64 bytes; the first difference is the smallest offset found in any slice.
+  constexpr uint64_t kPrefix = 4096;
+  uint64_t header[2] = {0, 0};  // common length, first difference within the prefix
+  if (world.rank() == 0) {
+    header[0] = std::min(input_[0].size(), input_[1].size());
+    header[1] = ppc::util::first_mismatch(input_[0].data(), input_[1].data(), std::min(header[0], kPrefix));
+  }
+  boost::mpi::broadcast(world, header, 2, 0);
+  const uint64_t len = header[0];
+  uint64_t first = header[1];
+  if (first == std::min(len, kPrefix) && first < len) {
+    const uint64_t rest = len - first;
+    auto cut = [&](int proc) { return proc == world.size() ? len : first + rest * proc / world.size() / 64 * 64; };
+    std::vector<int> sizes(world.size());
+    std::vector<int> displs(world.size());
+    for (int proc = 0; proc < world.size(); proc++) {
+      displs[proc] = static_cast<int>(cut(proc));
+      sizes[proc] = static_cast<int>(cut(proc + 1) - cut(proc));
     }
-    if (local_input1_[i] < local_input2_[i]) {
-      local_res = 0;
-      break;
+    const int local_size = sizes[world.rank()];
+    local_input1_.resize(local_size);
+    local_input2_.resize(local_size);
+    if (world.rank() == 0) {
+      boost::mpi::scatterv(world, input_[0].data(), sizes, displs, local_input1_.data(), local_size, 0);
+      boost::mpi::scatterv(world, input_[1].data(), sizes, displs, local_input2_.data(), local_size, 0);
+    } else {
+      boost::mpi::scatterv(world, local_input1_.data(), local_size, 0);
+      boost::mpi::scatterv(world, local_input2_.data(), local_size, 0);
     }
+    const size_t local_first = ppc::util::first_mismatch(local_input1_.data(), local_input2_.data(), local_size);
+    const uint64_t local_offset = local_first < local_input1_.size() ? displs[world.rank()] + local_first : len;
+    boost::mpi::reduce(world, local_offset, first, boost::mpi::minimum<uint64_t>(), 0);
   }
-  std::vector<int> full_result;
-  boost::mpi::gather(world, local_res, full_result, 0);
+
   if (world.rank() == 0) {
-    for (int result : full_result) {
-      if (result != 2) {
-        res = result;
-        break;
-      }
-    }
-    if (res == 2 && input_[0].size() != input_[1].size()) {
-      if (input_[0].size() > input_[1].size()) {
-        res = 1;
-      } else {
-        res = 0;
-      }
+    if (first < len) {
+      res = input_[0][first] > input_[1][first] ? 1 : 0;
+    } else if (input_[0].size() != input_[1].size()) {
+      res = input_[0].size() > input_[1].size() ? 1 : 0;
     }
   }
   return true;
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 
 namespace smirnov_i_integration_by_rectangles {
 
@@ -21,14 +22,18 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
   void set_function(double (*func)(double));
+  // Other double(double) callables, inlined into the batched quadrature loop
+  template <ppc::util::ScalarIntegrand F>
+  void set_function(F func) {
+    f = ppc::util::make_batch_integrand(std::move(func));
+  }
 
  private:
   double res{};
   double left{};
   double right{};
   int n_{};
-  double seq_integrate_rect(double (*func)(double), double left_, double right_, int n);
-  double (*f)(double) = nullptr;
+  ppc::util::BatchIntegrand f;
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -40,6 +45,10 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
   void set_function(double (*func)(double));
+  template <ppc::util::ScalarIntegrand F>
+  void set_function(F func) {
+    f = ppc::util::make_batch_integrand(std::move(func));
+  }
 
  private:
   double glob_res{};
@@ -47,7 +56,6 @@ class TestMPITaskParallel : public ppc::core::Task {
   double right{};
   int n_{};
   boost::mpi::communicator world;
-  double mpi_integrate_rect(double (*func)(double), double left_, double right_, int n);
-  double (*f)(double) = nullptr;
+  ppc::util::BatchIntegrand f;
 };
 }  // namespace smirnov_i_integration_by_rectangles
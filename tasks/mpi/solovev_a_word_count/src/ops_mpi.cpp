@@ -23,11 +23,7 @@ bool solovev_a_word_count_mpi::TestMPITaskSequential::validation() {
 
 bool solovev_a_word_count_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  for (char symbol : input_) {
-    if (symbol == ' ' || symbol == '.') {
-      res++;
-    }
-  }
+  res = static_cast<int>(ppc::util::count_class(input_.data(), input_.size(), ppc::util::ByteClass::of(" .")));
   return true;
 }
 bool solovev_a_word_count_mpi::TestMPITaskSequential::post_processing() {
@@ -74,11 +70,7 @@ bool solovev_a_word_count_mpi::TestMPITaskParallel::run() {
   } else {
     world.recv(0, 0, l_input_.data(), delta);
   }
-  for (char symbol : input_) {
-    if (symbol == ' ' || symbol == '.') {
-      l_res++;
-    }
-  }
+  l_res = static_cast<int>(ppc::util::count_class(input_.data(), input_.size(), ppc::util::ByteClass::of(" .")));
   boost::mpi::reduce(world, l_res, res, std::plus<>(), 0);
   return true;
 }
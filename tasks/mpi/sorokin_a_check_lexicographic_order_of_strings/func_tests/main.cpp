@@ -235,3 +235,34 @@ TEST(sorokin_a_check_lexicographic_order_of_strings_mpi, Equal_strings) {
     ASSERT_EQ(2, res[0]);
   }
 }
+TEST(sorokin_a_check_lexicographic_order_of_strings_mpi, The_difference_is_after_a_long_equal_part) {
+  boost::mpi::communicator world;
+  // Differences inside the prefix compared first, on its border and in the slices sent to the processes
+  for (int pos : {10, 4096, 7777, 9999}) {
+    std::vector<std::vector<char>> strs(2, std::vector<char>(10000, 'p'));
+    strs[0][pos] = 'q';
+    strs[1][pos] = 'a';
+    std::vector<int32_t> res(1, 0);
+    // Create TaskData
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+    if (world.rank() == 0) {
+      for (unsigned int i = 0; i < strs.size(); i++)
+        taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t *>(strs[i].data()));
+      taskDataPar->inputs_count.emplace_back(strs.size());
+      taskDataPar->inputs_count.emplace_back(strs[0].size());
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t *>(res.data()));
+      taskDataPar->outputs_count.emplace_back(res.size());
+    }
+
+    sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+    ASSERT_EQ(testMpiTaskParallel.validation(), true);
+    testMpiTaskParallel.pre_processing();
+    testMpiTaskParallel.run();
+    testMpiTaskParallel.post_processing();
+
+    if (world.rank() == 0) {
+      EXPECT_EQ(1, res[0]) << pos;
+    }
+  }
+}
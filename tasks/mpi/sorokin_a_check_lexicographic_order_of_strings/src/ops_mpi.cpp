@@ -2,12 +2,15 @@
 #include "mpi/sorokin_a_check_lexicographic_order_of_strings/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <random>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "util/text/include/text.hpp"
+
 using namespace std::chrono_literals;
 
 bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskSequential::pre_processing() {
@@ -51,14 +54,6 @@ bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskSequential::
 
 bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
-  unsigned int remainder = 0;
-  if (world.rank() == 0) {
-    delta = taskData->inputs_count[1] / world.size();
-    remainder = taskData->inputs_count[1] % world.size();
-  }
-  broadcast(world, delta, 0);
-
   if (world.rank() == 0) {
     input_ = std::vector<std::vector<char>>(taskData->inputs_count[0], std::vector<char>(taskData->inputs_count[1]));
 
@@ -68,19 +63,6 @@ bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskParallel::pr
         input_[i][j] = tmp_ptr[j];
       }
     }
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_[0].data() + delta * proc + remainder, delta);
-      world.send(proc, 1, input_[1].data() + delta * proc + remainder, delta);
-    }
-  }
-  local_input1_ = std::vector<char>(delta);
-  local_input2_ = std::vector<char>(delta);
-  if (world.rank() == 0) {
-    local_input1_ = std::vector<char>(input_[0].begin(), input_[0].begin() + delta + remainder);
-    local_input2_ = std::vector<char>(input_[1].begin(), input_[1].begin() + delta + remainder);
-  } else {
-    world.recv(0, 0, local_input1_.data(), delta);
-    world.recv(0, 1, local_input2_.data(), delta);
   }
   res_ = 2;
   return true;
@@ -96,27 +78,43 @@ bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskParallel::va
 
 bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  int local_res = 2;
-  for (size_t i = 0; i < local_input1_.size(); ++i) {
-    if (static_cast<int>(local_input1_[i]) > static_cast<int>(local_input2_[i])) {
-      local_res = 1;
-      break;
+  // Most strings differ early, so the root compares a prefix before sending anything. Strings equal in it are
+  // scattered in slices aligned to 64 bytes, and the smallest offset of a difference in any slice is the first.
+  constexpr uint64_t kPrefix = 4096;
+  uint64_t header[2] = {0, 0};  // length, first difference within the prefix
+  if (world.rank() == 0) {
+    header[0] = input_[0].size();
+    header[1] = ppc::util::first_mismatch(input_[0].data(), input_[1].data(), std::min(header[0], kPrefix));
+  }
+  boost::mpi::broadcast(world, header, 2, 0);
+  const uint64_t len = header[0];
+  uint64_t first = header[1];
+  if (first == std::min(len, kPrefix) && first < len) {
+    const uint64_t rest = len - first;
+    auto cut = [&](int proc) { return proc == world.size() ? len : first + rest * proc / world.size() / 64 * 64; };
+    std::vector<int> sizes(world.size());
+    std::vector<int> displs(world.size());
+    for (int proc = 0; proc < world.size(); proc++) {
+      displs[proc] = static_cast<int>(cut(proc));
+      sizes[proc] = static_cast<int>(cut(proc + 1) - cut(proc));
     }
-    if (static_cast<int>(local_input1_[i]) < static_cast<int>(local_input2_[i])) {
-      local_res = 0;
-      break;
+    const int local_size = sizes[world.rank()];
+    local_input1_.resize(local_size);
+    local_input2_.resize(local_size);
+    if (world.rank() == 0) {
+      boost::mpi::scatterv(world, input_[0].data(), sizes, displs, local_input1_.data(), local_size, 0);
+      boost::mpi::scatterv(world, input_[1].data(), sizes, displs, local_input2_.data(), local_size, 0);
+    } else {
+      boost::mpi::scatterv(world, local_input1_.data(), local_size, 0);
+      boost::mpi::scatterv(world, local_input2_.data(), local_size, 0);
     }
+    const size_t local_first = ppc::util::first_mismatch(local_input1_.data(), local_input2_.data(), local_size);
+    const uint64_t local_offset = local_first < local_input1_.size() ? displs[world.rank()] + local_first : len;
+    boost::mpi::reduce(world, local_offset, first, boost::mpi::minimum<uint64_t>(), 0);
   }
-  std::vector<int> all_res;
-  boost::mpi::gather(world, local_res, all_res, 0);
 
-  if (world.rank() == 0) {
-    for (int result : all_res) {
-      if (result != 2) {
-        res_ = result;
-        break;
-      }
-    }
+  if (world.rank() == 0 && first < len) {
+    res_ = static_cast<int>(input_[0][first]) > static_cast<int>(input_[1][first]) ? 1 : 0;
   }
   return true;
 }
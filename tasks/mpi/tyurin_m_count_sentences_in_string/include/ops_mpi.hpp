@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace tyurin_m_count_sentences_in_string_mpi {
 
@@ -23,9 +24,6 @@ class SentenceCountTaskSequential : public ppc::core::Task {
  private:
   std::string input_str_;
   int sentence_count_ = 0;
-
-  static bool is_sentence_end(char c);
-  static bool is_whitespace(char c);
 };
 
 class SentenceCountTaskParallel : public ppc::core::Task {
@@ -40,12 +38,8 @@ class SentenceCountTaskParallel : public ppc::core::Task {
   std::string input_str_;
   std::string local_input_;
   int sentence_count_ = 0;
-  int local_sentence_count_ = 0;
 
   boost::mpi::communicator world;
-
-  static bool is_sentence_end(char c);
-  static bool is_whitespace(char c);
 };
 
 }  // namespace tyurin_m_count_sentences_in_string_mpi
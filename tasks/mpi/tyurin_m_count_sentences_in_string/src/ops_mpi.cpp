@@ -1,6 +1,7 @@
 #include "mpi/tyurin_m_count_sentences_in_string/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <thread>
 
 using namespace std::chrono_literals;
@@ -20,17 +21,11 @@ bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskSequential::valida
 bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskSequential::run() {
   internal_order_test();
 
-  bool inside_sentence = false;
-  for (char c : input_str_) {
-    if (is_sentence_end(c)) {
-      if (inside_sentence) {
-        sentence_count_++;
-        inside_sentence = false;
-      }
-    } else if (!is_whitespace(c)) {
-      inside_sentence = true;
-    }
-  }
+  // A terminator ends a sentence when the closest non-blank character before it is text, not a terminator
+  const auto ends = ppc::util::ByteClass::sentence_end();
+  const auto blanks = ppc::util::ByteClass::of(" \n\t");
+  sentence_count_ =
+      static_cast<int>(ppc::util::count_preceded(input_str_.data(), input_str_.size(), ends, ~(ends | blanks), blanks));
   return true;
 }
 
@@ -40,14 +35,6 @@ bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskSequential::post_p
   return true;
 }
 
-bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskSequential::is_sentence_end(char c) {
-  return c == '.' || c == '!' || c == '?';
-}
-
-bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskSequential::is_whitespace(char c) {
-  return c == ' ' || c == '\n' || c == '\t';
-}
-
 bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskParallel::pre_processing() {
   internal_order_test();
 
@@ -55,7 +42,6 @@ bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskParallel::pre_proc
     input_str_ = *reinterpret_cast<std::string*>(taskData->inputs[0]);
   }
 
-  local_sentence_count_ = 0;
   sentence_count_ = 0;
 
   return true;
@@ -78,37 +64,27 @@ bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskParallel::run() {
   }
   boost::mpi::broadcast(world, total_length, 0);
 
-  std::string local_segment;
-  size_t segment_size = total_length / world.size();
-  size_t remainder = 0;
-
+  // Segments are cut at any byte: the tallies carry the state across the cuts, so the count is the sequential one
+  std::vector<int> sizes(world.size());
+  std::vector<int> displs(world.size());
+  for (int rank = 0; rank < world.size(); rank++) {
+    displs[rank] = static_cast<int>(total_length * rank / world.size());
+    sizes[rank] = static_cast<int>(total_length * (rank + 1) / world.size()) - displs[rank];
+  }
+  local_input_.resize(sizes[world.rank()]);
   if (world.rank() == 0) {
-    remainder = total_length % world.size();
-
-    for (int rank = 1; rank < world.size(); rank++) {
-      world.send(rank, 0, input_str_.data() + rank * segment_size + remainder, segment_size);
-    }
-
-    local_segment.assign(input_str_, 0, segment_size + remainder);
+    boost::mpi::scatterv(world, input_str_.data(), sizes, displs, local_input_.data(), sizes[0], 0);
   } else {
-    local_segment.resize(segment_size);
-    world.recv(0, 0, local_segment.data(), segment_size);
-  }
-
-  bool in_sentence = false;
-
-  for (char character : local_segment) {
-    if (is_sentence_end(character)) {
-      if (in_sentence || character == local_segment.front()) {
-        local_sentence_count_++;
-        in_sentence = false;
-      }
-    } else if (!is_whitespace(character)) {
-      in_sentence = true;
-    }
+    boost::mpi::scatterv(world, local_input_.data(), sizes[world.rank()], 0);
   }
 
-  boost::mpi::reduce(world, local_sentence_count_, sentence_count_, std::plus<>(), 0);
+  const auto ends = ppc::util::ByteClass::sentence_end();
+  const auto blanks = ppc::util::ByteClass::of(" \n\t");
+  const auto local_tally =
+      ppc::util::tally_preceded(local_input_.data(), local_input_.size(), ends, ~(ends | blanks), blanks);
+  ppc::util::PrecededTally tally;
+  boost::mpi::reduce(world, local_tally, tally, std::plus<>(), 0);
+  sentence_count_ = static_cast<int>(tally.count());
 
   return true;
 }
@@ -122,11 +98,3 @@ bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskParallel::post_pro
 
   return true;
 }
-
-bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskParallel::is_sentence_end(char c) {
-  return c == '.' || c == '!' || c == '?';
-}
-
-bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskParallel::is_whitespace(char c) {
-  return c == ' ' || c == '\n' || c == '\t';
-}
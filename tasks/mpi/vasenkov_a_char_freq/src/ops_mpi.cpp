@@ -31,7 +31,8 @@ bool vasenkov_a_char_freq_mpi::CharFrequencySequential::validation() {
 bool vasenkov_a_char_freq_mpi::CharFrequencySequential::run() {
   internal_order_test();
 
-  res = std::count(str_input_.begin(), str_input_.end(), target_char_);
+  histogram_ = ppc::util::ByteHistogram(str_input_.data(), str_input_.size());
+  res = static_cast<int>(histogram_.count(target_char_));
   return true;
 }
 
@@ -75,8 +76,11 @@ bool vasenkov_a_char_freq_mpi::CharFrequencyParallel::pre_processing() {
 bool vasenkov_a_char_freq_mpi::CharFrequencyParallel::run() {
   internal_order_test();
 
-  local_res = std::count(local_input_.begin(), local_input_.end(), target_char_);
-  boost::mpi::reduce(world, local_res, res, std::plus<>(), 0);
+  // The local histograms add up to that of the whole string: one reduce of all 256 bins
+  const ppc::util::ByteHistogram local_histogram(local_input_.data(), local_input_.size());
+  boost::mpi::reduce(world, local_histogram.data(), static_cast<int>(ppc::util::ByteHistogram::kBins),
+                     histogram_.data(), std::plus<uint64_t>(), 0);
+  res = static_cast<int>(histogram_.count(target_char_));
 
   return true;
 }
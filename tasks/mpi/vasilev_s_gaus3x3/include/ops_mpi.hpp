@@ -11,35 +11,14 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/convolution/include/convolution.hpp"
 
 namespace vasilev_s_gaus3x3_mpi {
 
-std::vector<std::pair<int, int>> generateIndicesProcessedElements(int rows, int cols);
-
-void calculateIndicesSizesDispls(int total_elements, int cols, int num_proc, std::vector<int>& sizes,
-                                 std::vector<int>& displs);
-
-std::vector<std::vector<std::pair<int, int>>> makeWorkersIndices(const std::vector<std::pair<int, int>>& indices,
-                                                                 const std::vector<int>& sizes,
-                                                                 const std::vector<int>& displs);
-
-void calculateMatrixSizesDispls(const std::vector<std::vector<std::pair<int, int>>>& matrix, int cols,
-                                std::vector<int>& sizes, std::vector<int>& displs);
-
-inline int applyGaussianKernel(const std::vector<int>& neighborhood) {
-  double result = 0.0;
-  result += neighborhood[0] * 0.0625;
-  result += neighborhood[1] * 0.125;
-  result += neighborhood[2] * 0.0625;
-  result += neighborhood[3] * 0.125;
-  result += neighborhood[4] * 0.25;
-  result += neighborhood[5] * 0.125;
-  result += neighborhood[6] * 0.0625;
-  result += neighborhood[7] * 0.125;
-  result += neighborhood[8] * 0.0625;
-  int finalResult = static_cast<int>(std::round(result));
-  return std::clamp(finalResult, 0, 255);
-}
+// Smooths output rows [first_row, last_row) of a rows x cols image with the 3x3 binomial kernel, leaving the
+// one-pixel frame untouched. src starts at global row src_first_row and holds the rows plus one ghost row on
+// each side that lie inside the image.
+void smoothRows(const int* src, int src_first_row, int* dst, int first_row, int last_row, int rows, int cols);
 
 class Gaus3x3ParallelMPI : public ppc::core::Task {
  public:
@@ -53,12 +32,9 @@ class Gaus3x3ParallelMPI : public ppc::core::Task {
   std::vector<int> matrix;
   int rows;
   int cols;
-  std::vector<std::pair<int, int>> indices;
-  std::vector<int> indices_sizes;
-  std::vector<int> indices_displs;
-  std::vector<int> worker_sizes;
-  std::vector<int> worker_displs;
   std::vector<int> result_vector;
+  std::vector<int> local_input;
+  std::vector<int> local_result;
   boost::mpi::communicator world;
 };
 
@@ -9,118 +9,15 @@
 #include <numeric>
 #include <vector>
 
-std::vector<std::pair<int, int>> vasilev_s_gaus3x3_mpi::generateIndicesProcessedElements(int rows, int cols) {
-  int total = (rows - 2) * (cols - 2);
-  int row_start = 1;
-  int row_end = rows - 1;
-  int col_start = 1;
-  int col_end = cols - 1;
-
-  std::vector<std::pair<int, int>> indices;
-  indices.reserve(total);
-
-  for (int i = row_start; i < row_end; ++i) {
-    for (int j = col_start; j < col_end; ++j) {
-      indices.emplace_back(i, j);
-    }
-  }
-
-  return indices;
-}
-
-void vasilev_s_gaus3x3_mpi::calculateIndicesSizesDispls(int total_elements, int cols, int num_proc,
-                                                        std::vector<int>& sizes, std::vector<int>& displs) {
-  sizes.resize(num_proc, 0);
-  displs.resize(num_proc, 0);
-
-  if (num_proc > total_elements) {
-    for (int i = 0; i < total_elements; ++i) {
-      sizes[i] = cols;
-      displs[i] = i * cols;
-    }
-  } else {
-    int a = total_elements / num_proc;
-    int b = total_elements % num_proc;
-
-    int offset = 0;
-    for (int i = 0; i < num_proc; ++i) {
-      if (b-- > 0) {
-        sizes[i] = a + 1;
-      } else {
-        sizes[i] = a;
-      }
-      displs[i] = offset;
-      offset += sizes[i];
-    }
-  }
-}
-
-std::vector<std::vector<std::pair<int, int>>> vasilev_s_gaus3x3_mpi::makeWorkersIndices(
-    const std::vector<std::pair<int, int>>& indices, const std::vector<int>& sizes, const std::vector<int>& displs) {
-  std::vector<std::vector<std::pair<int, int>>> result;
-  result.reserve(sizes.size());
-
-  size_t total_indices = indices.size();
-
-  for (size_t i = 0; i < sizes.size(); ++i) {
-    int size = sizes[i];
-    int displ = displs[i];
-
-    std::vector<std::pair<int, int>> group;
-    group.reserve(size);
-
-    int end = displ + size;
-    if (end > static_cast<int>(total_indices)) {
-      end = total_indices;
-    }
-
-    for (int index = displ; index < end; ++index) {
-      group.push_back(indices[index]);
-    }
-
-    result.push_back(std::move(group));
-  }
-
-  return result;
-}
-
-void vasilev_s_gaus3x3_mpi::calculateMatrixSizesDispls(const std::vector<std::vector<std::pair<int, int>>>& matrix,
-                                                       int cols, std::vector<int>& sizes, std::vector<int>& displs) {
-  sizes.reserve(matrix.size());
-  displs.reserve(matrix.size());
-
-  for (const auto& vector_pairs : matrix) {
-    if (vector_pairs.empty()) {
-      displs.push_back(0);
-      sizes.push_back(0);
-    } else {
-      int r1 = vector_pairs.front().first;
-      int c1 = vector_pairs.front().second;
-      int r2 = vector_pairs.back().first;
-      int c2 = vector_pairs.back().second;
-
-      int start_index = (r1 - 1) * cols + (c1 - 1);
-      int end_index = (r2 + 1) * cols + (c2 + 1);
-
-      int size = end_index - start_index + 1;
-
-      displs.push_back(start_index);
-      sizes.push_back(size);
-    }
-  }
-}
-
-std::vector<int> embedValuesWithZeros(const std::vector<int>& values, int rows, int cols) {
-  int resultRows = rows - 2;
-  int resultCols = cols - 2;
-  std::vector<int> result(rows * cols, 0);
-
-  for (int i = 0; i < resultRows; ++i) {
-    int src_offset = i * resultCols;
-    int dst_offset = (i + 1) * cols + 1;
-    std::copy(values.begin() + src_offset, values.begin() + src_offset + resultCols, result.begin() + dst_offset);
-  }
-  return result;
+void vasilev_s_gaus3x3_mpi::smoothRows(const int* src, int src_first_row, int* dst, int first_row, int last_row,
+                                       int rows, int cols) {
+  // Integer binomial weights sum to 16, so the window sum is exact and rounds once at the end
+  ppc::util::ConvolutionOptions options;
+  options.border = ppc::util::BorderMode::kValid;
+  ppc::util::convolve(
+      src, src_first_row, dst, first_row, last_row, {cols, rows, 1},
+      ppc::util::ConvolutionKernel<int>::outer({1, 2, 1}, {1, 2, 1}),
+      [](int sum, int, int) { return std::clamp(static_cast<int>(std::round(sum / 16.0)), 0, 255); }, options);
 }
 
 bool vasilev_s_gaus3x3_mpi::Gaus3x3ParallelMPI::validation() {
@@ -155,14 +52,7 @@ bool vasilev_s_gaus3x3_mpi::Gaus3x3ParallelMPI::pre_processing() {
 
     matrix.assign(matrix_data, matrix_data + matrix_size);
 
-    result_vector.resize((rows - 2) * (cols - 2), 0);
-
-    indices = vasilev_s_gaus3x3_mpi::generateIndicesProcessedElements(rows, cols);
-
-    calculateIndicesSizesDispls((rows - 2) * (cols - 2), 1, world.size(), indices_sizes, indices_displs);
-
-    auto worker_indicies = makeWorkersIndices(indices, indices_sizes, indices_displs);
-    calculateMatrixSizesDispls(worker_indicies, cols, worker_sizes, worker_displs);
+    result_vector.resize(rows * cols, 0);
   }
 
   return true;
@@ -171,46 +61,39 @@ bool vasilev_s_gaus3x3_mpi::Gaus3x3ParallelMPI::pre_processing() {
 bool vasilev_s_gaus3x3_mpi::Gaus3x3ParallelMPI::run() {
   internal_order_test();
 
+  boost::mpi::broadcast(world, rows, 0);
   boost::mpi::broadcast(world, cols, 0);
-  boost::mpi::broadcast(world, worker_sizes, 0);
-  boost::mpi::broadcast(world, worker_displs, 0);
-  boost::mpi::broadcast(world, indices_sizes, 0);
 
-  int local_vector_size = worker_sizes[world.rank()];
-  int local_indices_size = indices_sizes[world.rank()];
-  std::vector<int> local_vector(local_vector_size);
-  std::vector<std::pair<int, int>> local_indecies(local_indices_size);
+  // Contiguous row bands, each sent with one ghost row above and below; the frame rows and columns come back
+  // as the zeros the local results start with
+  std::vector<int> halo_counts(world.size());
+  std::vector<int> halo_displs(world.size());
+  std::vector<int> band_counts(world.size());
+  std::vector<int> band_displs(world.size());
+  for (int p = 0; p < world.size(); p++) {
+    auto band = ppc::util::row_band(rows, p, world.size(), 1);
+    halo_counts[p] = band.halo_rows() * cols;
+    halo_displs[p] = band.halo_first * cols;
+    band_counts[p] = band.rows() * cols;
+    band_displs[p] = band.first * cols;
+  }
+  auto band = ppc::util::row_band(rows, world.rank(), world.size(), 1);
 
+  local_input.resize(halo_counts[world.rank()]);
+  local_result.assign(band_counts[world.rank()], 0);
   if (world.rank() == 0) {
-    boost::mpi::scatterv(world, matrix.data(), worker_sizes, worker_displs, local_vector.data(),
-                         worker_sizes[world.rank()], 0);
-    boost::mpi::scatterv(world, indices.data(), indices_sizes, indices_displs, local_indecies.data(),
-                         indices_sizes[world.rank()], 0);
+    boost::mpi::scatterv(world, matrix.data(), halo_counts, halo_displs, local_input.data(), halo_counts[0], 0);
   } else {
-    boost::mpi::scatterv(world, local_vector.data(), worker_sizes[world.rank()], 0);
-    boost::mpi::scatterv(world, local_indecies.data(), indices_sizes[world.rank()], 0);
+    boost::mpi::scatterv(world, local_input.data(), halo_counts[world.rank()], 0);
   }
 
-  std::vector<int> local_result(indices_sizes[world.rank()]);
-  for (int i = 0; i < indices_sizes[world.rank()]; i++) {
-    auto [r, c] = local_indecies[i];
-    int ind = (r - 1) * cols + (c - 1) - worker_displs[world.rank()];
-    std::vector<int> process_vector(9);
-    for (int j = 0; j < 3; j++) {
-      process_vector[3 * j] = local_vector[ind + cols * j];
-      process_vector[3 * j + 1] = local_vector[ind + cols * j + 1];
-      process_vector[3 * j + 2] = local_vector[ind + cols * j + 2];
-    }
-    int res = applyGaussianKernel(process_vector);
-
-    local_result[i] = res;
-  }
+  smoothRows(local_input.data(), band.halo_first, local_result.data(), band.first, band.last, rows, cols);
 
   if (world.rank() == 0) {
-    boost::mpi::gatherv(world, local_result.data(), local_result.size(), result_vector.data(), indices_sizes,
-                        indices_displs, 0);
+    boost::mpi::gatherv(world, local_result.data(), band_counts[0], result_vector.data(), band_counts, band_displs,
+                        0);
   } else {
-    boost::mpi::gatherv(world, local_result.data(), local_result.size(), 0);
+    boost::mpi::gatherv(world, local_result.data(), band_counts[world.rank()], 0);
   }
 
   return true;
@@ -221,8 +104,7 @@ bool vasilev_s_gaus3x3_mpi::Gaus3x3ParallelMPI::post_processing() {
 
   if (world.rank() == 0) {
     auto* output_data = reinterpret_cast<int*>(taskData->outputs[0]);
-    std::vector<int> result = embedValuesWithZeros(result_vector, rows, cols);
-    std::copy(result.begin(), result.end(), output_data);
+    std::copy(result_vector.begin(), result_vector.end(), output_data);
   }
 
   return true;
@@ -263,24 +145,7 @@ bool vasilev_s_gaus3x3_mpi::Gaus3x3SequentialMPI::pre_processing() {
 bool vasilev_s_gaus3x3_mpi::Gaus3x3SequentialMPI::run() {
   internal_order_test();
 
-  for (int row = 1; row < rows - 1; ++row) {
-    for (int col = 1; col < cols - 1; ++col) {
-      int baseIndex = row * cols + col;
-
-      double result = 0;                                // Тут ошибка
-      result += matrix[baseIndex - cols - 1] * 0.0625;  // Top-left
-      result += matrix[baseIndex - cols] * 0.125;       // Top-center
-      result += matrix[baseIndex - cols + 1] * 0.0625;  // Top-right
-      result += matrix[baseIndex - 1] * 0.125;          // Middle-left
-      result += matrix[baseIndex] * 0.25;               // Center
-      result += matrix[baseIndex + 1] * 0.125;          // Middle-right
-      result += matrix[baseIndex + cols - 1] * 0.0625;  // Bottom-left
-      result += matrix[baseIndex + cols] * 0.125;       // Bottom-center
-      result += matrix[baseIndex + cols + 1] * 0.0625;  // Bottom-right
-      int finalResult = static_cast<int>(std::round(result));
-      result_vector[baseIndex] = std::clamp(finalResult, 0, 255);
-    }
-  }
+  smoothRows(matrix.data(), 0, result_vector.data(), 0, rows, rows, cols);
 
   return true;
 }
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/transport/include/transport.hpp"
 
 namespace vasilev_s_nearest_neighbor_elements_mpi {
 
@@ -73,3 +74,6 @@ class FindClosestNeighborsParallelMPI : public ppc::core::Task {
 };
 
 }  // namespace vasilev_s_nearest_neighbor_elements_mpi
+
+// Partial results are reduced as their raw bytes
+PPC_MPI_RAW_DATATYPE(vasilev_s_nearest_neighbor_elements_mpi::LocalResult)
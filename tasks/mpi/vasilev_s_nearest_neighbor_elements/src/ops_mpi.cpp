@@ -117,8 +117,8 @@ bool vasilev_s_nearest_neighbor_elements_mpi::FindClosestNeighborsParallelMPI::r
 
   boost::mpi::broadcast(world, amount, 0);
 
-  boost::mpi::broadcast(world, displacement, 0);
-  boost::mpi::broadcast(world, distribution, 0);
+  ppc::util::broadcast(world, displacement, 0);
+  ppc::util::broadcast(world, distribution, 0);
 
   rank_offset_ = displacement[world.rank()];
 
@@ -9,9 +9,13 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/contrast/include/contrast.hpp"
 
 namespace vavilov_v_contrast_enhancement_mpi {
 
+// Linear stretch of [p_min, p_max] onto [0, 255]; a flat image maps to 0
+ppc::util::ContrastLut stretchLut(uint8_t p_min, uint8_t p_max);
+
 class TestMPITaskSequential : public ppc::core::Task {
  public:
   explicit TestMPITaskSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
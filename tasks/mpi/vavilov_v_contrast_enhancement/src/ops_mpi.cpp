@@ -1,5 +1,13 @@
 #include "mpi/vavilov_v_contrast_enhancement/include/ops_mpi.hpp"
 
+ppc::util::ContrastLut vavilov_v_contrast_enhancement_mpi::stretchLut(uint8_t p_min, uint8_t p_max) {
+  if (p_max == p_min) {
+    return ppc::util::make_lut([](uint8_t) { return 0; });
+  }
+  return ppc::util::make_lut(
+      [=](uint8_t v) { return static_cast<int>(static_cast<double>(v - p_min) * 255 / (p_max - p_min)); });
+}
+
 bool vavilov_v_contrast_enhancement_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
 
@@ -22,17 +30,10 @@ bool vavilov_v_contrast_enhancement_mpi::TestMPITaskSequential::validation() {
 bool vavilov_v_contrast_enhancement_mpi::TestMPITaskSequential::run() {
   internal_order_test();
 
-  p_min_ = *std::min_element(input_.begin(), input_.end());
-  p_max_ = *std::max_element(input_.begin(), input_.end());
-
-  if (p_max_ == p_min_) {
-    std::fill(output_.begin(), output_.end(), 0);
-    return true;
-  }
-
-  for (size_t i = 0; i < input_.size(); ++i) {
-    output_[i] = static_cast<uint8_t>(static_cast<double>(input_[i] - p_min_) * 255 / (p_max_ - p_min_));
-  }
+  auto stats = ppc::util::channel_stats(input_.data(), input_.size());
+  p_min_ = stats.min;
+  p_max_ = stats.max;
+  ppc::util::apply_lut(stretchLut(p_min_, p_max_), input_.data(), output_.data(), input_.size());
   return true;
 }
 
@@ -87,19 +88,18 @@ bool vavilov_v_contrast_enhancement_mpi::TestMPITaskParallel::run() {
 
   boost::mpi::scatterv(world, input_.data(), counts, displs, local_input_.data(), local_size, 0);
 
-  p_min_local_ = *std::min_element(local_input_.begin(), local_input_.end());
-  p_max_local_ = *std::max_element(local_input_.begin(), local_input_.end());
-
-  boost::mpi::all_reduce(world, p_min_local_, p_min_global_, [](int a, int b) { return std::min(a, b); });
-  boost::mpi::all_reduce(world, p_max_local_, p_max_global_, [](int a, int b) { return std::max(a, b); });
-
-  if (p_max_global_ == p_min_global_) {
-    std::fill(local_input_.begin(), local_input_.end(), 0);
-  } else {
-    for (auto& pixel : local_input_) {
-      pixel = static_cast<uint8_t>(static_cast<double>(pixel - p_min_global_) * 255 / (p_max_global_ - p_min_global_));
-    }
-  }
+  // min and max in a single reduction, as the minimum of {min, -max}
+  auto stats = ppc::util::channel_stats(local_input_.data(), local_input_.size());
+  p_min_local_ = stats.min;
+  p_max_local_ = stats.max;
+  int local_bounds[2]{p_min_local_, -p_max_local_};
+  int bounds[2];
+  boost::mpi::all_reduce(world, local_bounds, 2, bounds, boost::mpi::minimum<int>());
+  p_min_global_ = bounds[0];
+  p_max_global_ = -bounds[1];
+
+  ppc::util::apply_lut(stretchLut(p_min_global_, p_max_global_), local_input_.data(), local_input_.data(),
+                       local_input_.size());
 
   if (world.rank() == 0) {
     output_.resize(total_size, 0);
@@ -12,9 +12,14 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/convolution/include/convolution.hpp"
 
 namespace vershinina_a_image_smoothing {
 
+// Mean over the in-image part of each 3x3 window for output rows [first_row, last_row) of a rows x cols
+// image; src holds the image from row src_first_row on, dst starts at row first_row
+void smoothRows(const int *src, int src_first_row, int *dst, int first_row, int last_row, int rows, int cols);
+
 class TestMPITaskSequential : public ppc::core::Task {
  public:
   explicit TestMPITaskSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
@@ -38,14 +43,9 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
   int rows{};
-  int local_rows{};
   int cols{};
-  int global_res{};
-  int rows_per_proc;
-  int remainder;
   std::vector<int> local_input_;
   std::vector<int> local_output_;
-  std::vector<int> local_input_sizes;
 
  private:
   std::vector<int> output_;
@@ -26,19 +26,7 @@ bool vershinina_a_image_smoothing::TestMPITaskSequential::validation() {
 
 bool vershinina_a_image_smoothing::TestMPITaskSequential::run() {
   internal_order_test();
-  for (int i = 0; i < rows; ++i) {
-    for (int j = 0; j < cols; ++j) {
-      int sum = 0;
-      int c = 0;
-      for (int row = std::max(0, i - 1); row <= std::min(i + 1, rows - 1); row++) {
-        for (int col = std::max(0, j - 1); col <= std::min(j + 1, cols - 1); col++) {
-          sum += input_[row * cols + col];
-          c++;
-        }
-      }
-      output_[i * cols + j] = sum / c;
-    }
-  }
+  smoothRows(input_, 0, output_.data(), 0, rows, rows, cols);
   return true;
 }
 
@@ -71,98 +59,40 @@ bool vershinina_a_image_smoothing::TestMPITaskParallel::run() {
   if (world.rank() == 0) {
     rows = taskData->inputs_count[0];
     cols = taskData->inputs_count[1];
-    rows_per_proc = rows / std::min(world.size(), rows);
-    remainder = rows % world.size();
   }
-
   broadcast(world, rows, 0);
   broadcast(world, cols, 0);
-  broadcast(world, local_rows, 0);
-  broadcast(world, rows_per_proc, 0);
-  broadcast(world, remainder, 0);
 
-  local_input_sizes.resize(world.size(), 0);
-  std::vector<int> send(world.size(), 0);
-
-  if (world.rank() == 0) {
-    if (world.size() > 1) {
-      if (rows >= world.size()) {
-        for (int i = 0; i < std::min(world.size(), rows); i++) {
-          if (i == world.size() - 1) {
-            local_input_sizes[i] = (rows_per_proc + 1 + remainder) * cols;
-          } else if (i == 0) {
-            local_input_sizes[i] = (rows_per_proc + 1) * cols;
-          } else {
-            local_input_sizes[i] = (rows_per_proc + 2) * cols;
-          }
-        }
-      } else {
-        for (int i = 0; i < std::min(world.size(), rows); i++) {
-          if ((i == 0) || (i == rows - 1)) {
-            local_input_sizes[i] = (rows_per_proc + 1) * cols;
-          } else {
-            local_input_sizes[i] = (rows_per_proc + 2) * cols;
-          }
-        }
-      }
-    } else {
-      local_input_sizes[0] = rows * cols;
-    }
-    if (world.size() > 1) {
-      for (int i = 1; i < std::min(world.size(), rows); i++) {
-        send[i] = i * rows_per_proc * cols - 1 * cols;
-      }
-    }
+  // Contiguous row bands, each sent with one ghost row above and below
+  std::vector<int> halo_counts(world.size());
+  std::vector<int> halo_displs(world.size());
+  std::vector<int> band_counts(world.size());
+  std::vector<int> band_displs(world.size());
+  for (int p = 0; p < world.size(); p++) {
+    auto band = ppc::util::row_band(rows, p, world.size(), 1);
+    halo_counts[p] = band.halo_rows() * cols;
+    halo_displs[p] = band.halo_first * cols;
+    band_counts[p] = band.rows() * cols;
+    band_displs[p] = band.first * cols;
   }
+  auto band = ppc::util::row_band(rows, world.rank(), world.size(), 1);
 
-  broadcast(world, local_input_sizes.data(), local_input_sizes.size(), 0);
-  local_input_.resize(local_input_sizes[world.rank()]);
-  boost::mpi::scatterv(world, input_.data(), local_input_sizes, send, local_input_.data(),
-                       local_input_sizes[world.rank()], 0);
-  local_rows = local_input_sizes[world.rank()] / cols;
-
+  local_input_.resize(halo_counts[world.rank()]);
+  local_output_.resize(band_counts[world.rank()]);
   if (world.rank() == 0) {
     output_.resize(rows * cols);
+    boost::mpi::scatterv(world, input_.data(), halo_counts, halo_displs, local_input_.data(), halo_counts[0], 0);
+  } else {
+    boost::mpi::scatterv(world, local_input_.data(), halo_counts[world.rank()], 0);
   }
 
-  int offset_top = (world.rank() == 0) ? 0 : 1;
-  int offset_bottom = (world.rank() == std::min(world.size(), rows) - 1) ? 0 : 1;
-
-  if (world.size() == 1) {
-    offset_top = 0;
-    offset_bottom = 0;
-  }
-
-  if (local_input_sizes[world.rank()] != 0) {
-    local_output_.resize((local_rows - offset_top - offset_bottom) * cols);
-  }
-
-  for (int i = offset_top; i < local_rows - offset_bottom; ++i) {
-    for (int j = 0; j < cols; ++j) {
-      int sum = 0;
-      int c = 0;
-      for (int row = std::max(0, i - 1); row <= std::min(i + 1, local_rows - 1); row++) {
-        for (int col = std::max(0, j - 1); col <= std::min(j + 1, cols - 1); col++) {
-          sum += local_input_[row * cols + col];
-          c++;
-        }
-      }
-      local_output_[(i - offset_top) * cols + j] = sum / c;
-    }
-  }
-
-  int* output_data = output_.data();
-  int* local_output_data = local_output_.data();
+  smoothRows(local_input_.data(), band.halo_first, local_output_.data(), band.first, band.last, rows, cols);
 
-  for (int i = 0; i < std::min(world.size(), rows); i++) {
-    if (i == world.size() - 1) {
-      local_input_sizes[i] = (rows_per_proc + remainder) * cols;
-    } else {
-      local_input_sizes[i] = rows_per_proc * cols;
-    }
+  if (world.rank() == 0) {
+    boost::mpi::gatherv(world, local_output_.data(), band_counts[0], output_.data(), band_counts, band_displs, 0);
+  } else {
+    boost::mpi::gatherv(world, local_output_.data(), band_counts[world.rank()], 0);
   }
-
-  boost::mpi::gatherv(world, local_output_data, local_output_.size(), output_data, local_input_sizes, 0);
   return true;
 }
 
@@ -173,3 +103,18 @@ bool vershinina_a_image_smoothing::TestMPITaskParallel::post_processing() {
   }
   return true;
 }
+
+void vershinina_a_image_smoothing::smoothRows(const int* src, int src_first_row, int* dst, int first_row,
+                                              int last_row, int rows, int cols) {
+  if (first_row == last_row) return;
+  // 3x3 box sum with zero padding, divided by the number of window pixels inside the image
+  ppc::util::ConvolutionOptions options;
+  options.border = ppc::util::BorderMode::kZero;
+  auto mean = [&](int sum, int x, int y) {
+    int window_rows = std::min(y + 1, rows - 1) - std::max(y - 1, 0) + 1;
+    int window_cols = std::min(x + 1, cols - 1) - std::max(x - 1, 0) + 1;
+    return sum / (window_rows * window_cols);
+  };
+  ppc::util::convolve(src, src_first_row, dst, first_row, last_row, {cols, rows, 1},
+                      ppc::util::ConvolutionKernel<int>(1, std::vector(9, 1)), mean, options);
+}
@@ -145,4 +145,47 @@ TEST(vershinina_a_integration_the_monte_carlo_method, Test_3) {
 
     EXPECT_NEAR(reference_res[0], global_res[0], 1);
   }
-}
\ No newline at end of file
+}
+
+TEST(vershinina_a_integration_the_monte_carlo_method, Test_same_estimate_for_any_process_count) {
+  boost::mpi::communicator world;
+  std::vector<double> in{0.0, 1.0, 0.0, 1.0, 200000};
+  std::vector<double> global_res(1, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskDataPar->inputs_count.emplace_back(in.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_res.data()));
+    taskDataPar->outputs_count.emplace_back(global_res.size());
+  }
+
+  vershinina_a_integration_the_monte_carlo_method::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+  testMpiTaskParallel.p = [](double x) { return x * x; };
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+
+  if (world.rank() == 0) {
+    std::vector<double> reference_res(1, 0);
+
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskDataSeq->inputs_count.emplace_back(in.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(reference_res.data()));
+    taskDataSeq->outputs_count.emplace_back(reference_res.size());
+
+    vershinina_a_integration_the_monte_carlo_method::TestMPITaskSequential testMpiTaskSequential(taskDataSeq);
+    testMpiTaskSequential.p = [](double x) { return x * x; };
+    ASSERT_EQ(testMpiTaskSequential.validation(), true);
+    testMpiTaskSequential.pre_processing();
+    testMpiTaskSequential.run();
+    testMpiTaskSequential.post_processing();
+
+    // Samples are indexed globally, so splitting them between processes changes nothing
+    EXPECT_DOUBLE_EQ(reference_res[0], global_res[0]);
+    EXPECT_NEAR(global_res[0], 1.0 / 3.0, 1e-2);
+  }
+}
@@ -3,6 +3,7 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -11,6 +12,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/rng/include/hit_or_miss.hpp"
 
 namespace vershinina_a_integration_the_monte_carlo_method {
 
@@ -24,6 +26,7 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
   std::function<double(double)> p;
+  uint64_t seed = 2024;
 
  private:
   double xmin{};
@@ -43,12 +46,12 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
   std::function<double(double)> p;
+  uint64_t seed = 2024;
   double xmin{};
   double xmax{};
   double ymin{};
   double ymax{};
   double iter_count{};
-  double local_total;
   double local_inBox;
 
  private:
@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <functional>
-#include <random>
 #include <string>
 #include <vector>
 
@@ -24,25 +23,9 @@ bool vershinina_a_integration_the_monte_carlo_method::TestMPITaskSequential::val
 
 bool vershinina_a_integration_the_monte_carlo_method::TestMPITaskSequential::run() {
   internal_order_test();
-  int count;
-  double total = 0;
-  double inBox = 0;
-  reference_res = 0;
-  for (count = 0; count < iter_count; count++) {
-    double u1 = (double)rand() / (double)RAND_MAX;
-    double u2 = (double)rand() / (double)RAND_MAX;
-
-    double xcoord = ((xmax - xmin) * u1) + xmin;
-    double ycoord = ((ymax - ymin) * u2) + ymin;
-    double val = p(xcoord);
-
-    ++total;
-
-    if (val > ycoord) {
-      ++inBox;
-    }
-  }
-  double density = inBox / total;
+  auto samples = static_cast<int64_t>(iter_count);
+  double inBox = static_cast<double>(ppc::util::count_hits(p, seed, 0, samples, xmin, xmax, ymin, ymax));
+  double density = inBox / static_cast<double>(samples);
 
   reference_res = (xmax - xmin) * (ymax - ymin) * density;
   return true;
@@ -84,31 +67,14 @@ bool vershinina_a_integration_the_monte_carlo_method::TestMPITaskParallel::run()
   ymax = input_[3];
   iter_count = static_cast<int>(input_[4]);
   global_res = 0;
-  int count;
-  local_total = 0;
-  local_inBox = 0;
-  double total = 0;
+  auto samples = static_cast<int64_t>(iter_count);
+  int64_t begin = samples * world.rank() / world.size();
+  int64_t end = samples * (world.rank() + 1) / world.size();
+  local_inBox = static_cast<double>(ppc::util::count_hits(p, seed, begin, end, xmin, xmax, ymin, ymax));
   double inBox = 0;
-  auto tgt = (iter_count / world.size()) * (world.rank() + 1);
-  for (count = (iter_count / world.size()) * world.rank(); count < tgt; count++) {
-    double u1 = (double)rand() / (double)RAND_MAX;
-    double u2 = (double)rand() / (double)RAND_MAX;
-
-    double xcoord = ((xmax - xmin) * u1) + xmin;
-    double ycoord = ((ymax - ymin) * u2) + ymin;
-
-    double val = p(xcoord);
-
-    ++local_total;
-
-    if (val > ycoord) {
-      ++local_inBox;
-    }
-  }
-  reduce(world, local_total, total, std::plus(), 0);
   reduce(world, local_inBox, inBox, std::plus(), 0);
 
-  double density = inBox / total;
+  double density = inBox / static_cast<double>(samples);
   global_res = (xmax - xmin) * (ymax - ymin) * density;
 
   return true;
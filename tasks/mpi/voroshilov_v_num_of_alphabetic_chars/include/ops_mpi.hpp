@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace voroshilov_v_num_of_alphabetic_chars_mpi {
 
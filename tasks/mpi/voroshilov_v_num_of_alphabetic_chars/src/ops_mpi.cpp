@@ -26,11 +26,7 @@ bool voroshilov_v_num_of_alphabetic_chars_mpi::AlphabetCharsTaskSequential::pre_
 
 bool voroshilov_v_num_of_alphabetic_chars_mpi::AlphabetCharsTaskSequential::run() {
   internal_order_test();
-  for (size_t i = 0; i < input_.size(); i++) {
-    if (std::isalpha(input_[i]) != 0) {  // Check if it is alphabetic character
-      res_++;
-    }
-  }
+  res_ = static_cast<int>(ppc::util::count_class(input_.data(), input_.size(), ppc::util::ByteClass::ascii_alpha()));
   return true;
 }
 
@@ -87,12 +83,8 @@ bool voroshilov_v_num_of_alphabetic_chars_mpi::AlphabetCharsTaskParallel::run()
     world.recv(0, 0, local_input_.data(), part);
   }
 
-  int local_res = 0;
-  for (size_t i = 0; i < local_input_.size(); i++) {
-    if (std::isalpha(local_input_[i]) != 0) {  // Check if it is alphabetic character
-      local_res++;
-    }
-  }
+  int local_res = static_cast<int>(
+      ppc::util::count_class(local_input_.data(), local_input_.size(), ppc::util::ByteClass::ascii_alpha()));
   boost::mpi::reduce(world, local_res, res_, std::plus(), 0);
   return true;
 }
@@ -10,6 +10,7 @@
 #include <utility>
 
 #include "core/task/include/task.hpp"
+#include "util/convolution/include/convolution.hpp"
 
 namespace zolotareva_a_smoothing_image_mpi {
 
@@ -21,10 +22,10 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
   static std::vector<float> create_gaussian_kernel(int radius, float sigma);
-  static void convolve_rows(const std::vector<uint8_t>& input, int height, int width, const std::vector<float>& kernel,
-                            std::vector<float>& temp);
-  static void convolve_columns(const std::vector<float>& temp, int height, int width, const std::vector<float>& kernel,
-                               std::vector<uint8_t>& output);
+  // Separable Gaussian blur of output rows [first_row, last_row) of a height x width image with edge pixels
+  // repeated; input holds the image from row input_first_row on, output starts at row first_row
+  static void smooth_rows(const uint8_t* input, int input_first_row, uint8_t* output, int first_row, int last_row,
+                          int height, int width);
 
  private:
   std::vector<uint8_t> input_;
@@ -45,11 +46,8 @@ class TestMPITaskParallel : public ppc::core::Task {
   std::vector<uint8_t> input_;
   std::vector<uint8_t> result_;
   std::vector<uint8_t> local_input_;
-  std::vector<int> send_counts;
   int width_{0};
   int height_{0};
-  int size_{0};
-  int local_height_{0};
   boost::mpi::communicator world;
 };
 
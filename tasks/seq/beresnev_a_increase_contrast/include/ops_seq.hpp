@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/contrast/include/contrast.hpp"
 
 namespace beresnev_a_increase_contrast_seq {
 
@@ -68,12 +68,14 @@ bool beresnev_a_increase_contrast_seq::TestTaskSequential::validation() {
 
 bool beresnev_a_increase_contrast_seq::TestTaskSequential::run() {
   internal_order_test();
-  for (size_t i = 0; i < pixel_data_size; ++i) {
-    double normalized = inp_[i] / 255.0;
+  // Tabulated once for the 256 byte values instead of evaluated per byte
+  auto lut = ppc::util::make_lut([this](uint8_t v) {
+    double normalized = v / 255.0;
     normalized = (normalized - 0.5) * factor + 0.5;
     normalized = std::clamp(normalized, 0.0, 1.0);
-    res_[i] = static_cast<uint8_t>(normalized * 255);
-  }
+    return static_cast<uint8_t>(normalized * 255);
+  });
+  ppc::util::apply_lut(lut, inp_.data(), res_.data(), pixel_data_size);
   return true;
 }
 
@@ -3,19 +3,16 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/geometry/include/geometry.hpp"
 
 namespace beskhmelnova_k_jarvis_march_seq {
 
 template <typename DataType>
-DataType crossProduct(const std::vector<DataType>& p1, const std::vector<DataType>& p2,
-                      const std::vector<DataType>& p3);
+using Point = ppc::util::Point2<DataType>;
 
+// Gift wrapping counter-clockwise from the lexicographically smallest point, without collinear points
 template <typename DataType>
-bool isLeftAngle(const std::vector<DataType>& p1, const std::vector<DataType>& p2, const std::vector<DataType>& p3);
-
-template <typename DataType>
-void jarvisMarch(int& num_points, std::vector<std::vector<DataType>>& input, std::vector<DataType>& res_x,
-                 std::vector<DataType>& res_y);
+std::vector<Point<DataType>> jarvisMarch(const std::vector<Point<DataType>>& points);
 
 template <typename DataType>
 class TestTaskSequential : public ppc::core::Task {
@@ -27,10 +24,8 @@ class TestTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  int num_points{};
-  std::vector<std::vector<DataType>> input;
-  std::vector<DataType> res_x;
-  std::vector<DataType> res_y;
+  ppc::util::PointCloud<DataType> input;
+  std::vector<Point<DataType>> hull;
 };
 
 }  // namespace beskhmelnova_k_jarvis_march_seq
\ No newline at end of file
@@ -1,66 +1,42 @@
 #include "seq/beskhmelnova_k_jarvis_march/include/jarvis_march.hpp"
 
-#include <random>
-
-using namespace std::chrono_literals;
+#include <algorithm>
+#include <vector>
 
 template <typename DataType>
-DataType beskhmelnova_k_jarvis_march_seq::crossProduct(const std::vector<DataType>& p1, const std::vector<DataType>& p2,
-                                                       const std::vector<DataType>& p3) {
-  return ((p2[1] - p1[1]) * (p3[2] - p1[2]) - (p3[1] - p1[1]) * (p2[2] - p1[2]));
-}
-
-template <typename DataType>
-bool beskhmelnova_k_jarvis_march_seq::isLeftAngle(const std::vector<DataType>& p1, const std::vector<DataType>& p2,
-                                                  const std::vector<DataType>& p3) {
-  return cross_product(p1, p2, p3) > 0;
-}
-
-template <typename DataType>
-void beskhmelnova_k_jarvis_march_seq::jarvisMarch(int& num_points, std::vector<std::vector<DataType>>& input,
-                                                  std::vector<DataType>& res_x, std::vector<DataType>& res_y) {
-  int leftmost_index = 0;
-  for (int i = 1; i < num_points; i++)
-    if (input[i][1] < input[leftmost_index][1] ||
-        (input[i][1] == input[leftmost_index][1] && input[i][2] < input[leftmost_index][2]))
-      leftmost_index = i;
-  std::swap(input[0], input[leftmost_index]);
-  std::vector<std::vector<DataType>> hull;
-  int current = 0;
+std::vector<beskhmelnova_k_jarvis_march_seq::Point<DataType>> beskhmelnova_k_jarvis_march_seq::jarvisMarch(
+    const std::vector<Point<DataType>>& points) {
+  const Point<DataType> start = *std::min_element(points.begin(), points.end(), ppc::util::lex_less<DataType>);
+  auto squared_distance = [](const Point<DataType>& a, const Point<DataType>& b) {
+    const double dx = static_cast<double>(a.x) - b.x;
+    const double dy = static_cast<double>(a.y) - b.y;
+    return dx * dx + dy * dy;
+  };
+  std::vector<Point<DataType>> hull;
+  Point<DataType> current = start;
   do {
-    hull.push_back(input[current]);
-    int next = (current + 1) % num_points;
-    for (int i = 0; i < num_points; ++i) {
-      auto cross_product =
-          beskhmelnova_k_jarvis_march_seq::crossProduct<DataType>(input[current], input[next], input[i]);
-      if (cross_product < 0 || (cross_product == 0 &&
-                                std::hypot(input[i][1] - input[current][1], input[i][2] - input[current][2]) >
-                                    std::hypot(input[next][1] - input[current][1], input[next][2] - input[current][2])))
-        next = i;
+    hull.push_back(current);
+    Point<DataType> next = current;
+    for (const auto& p : points) {
+      // Exact turns: a rounded one may skip a vertex or never return to the start
+      const int turn = ppc::util::orientation(current, next, p);
+      if (next == current || turn < 0 ||
+          (turn == 0 && squared_distance(current, p) > squared_distance(current, next))) {
+        next = p;
+      }
     }
     current = next;
-  } while (current != 0);
-  num_points = static_cast<int>(hull.size());
-  res_x.resize(num_points);
-  res_y.resize(num_points);
-  for (int i = 0; i < num_points; ++i) {
-    res_x[i] = hull[i][1];
-    res_y[i] = hull[i][2];
-  }
-  input = hull;
+  } while (!(current == start));
+  return hull;
 }
 
 template <typename DataType>
 bool beskhmelnova_k_jarvis_march_seq::TestTaskSequential<DataType>::pre_processing() {
   internal_order_test();
-  num_points = (int)taskData->inputs_count[0];
-  input = std::vector<std::vector<DataType>>(num_points, std::vector<DataType>(3, 0));
   auto* ptr_x = reinterpret_cast<DataType*>(taskData->inputs[0]);
   auto* ptr_y = reinterpret_cast<DataType*>(taskData->inputs[1]);
-  for (int i = 0; i < num_points; i++) {
-    input[i][1] = ptr_x[i];
-    input[i][2] = ptr_y[i];
-  }
+  input.x.assign(ptr_x, ptr_x + taskData->inputs_count[0]);
+  input.y.assign(ptr_y, ptr_y + taskData->inputs_count[0]);
   return true;
 }
 
@@ -73,17 +49,18 @@ bool beskhmelnova_k_jarvis_march_seq::TestTaskSequential<DataType>::validation()
 template <typename DataType>
 bool beskhmelnova_k_jarvis_march_seq::TestTaskSequential<DataType>::run() {
   internal_order_test();
-  jarvisMarch(num_points, input, res_x, res_y);
+  // Points strictly inside the Akl-Toussaint octagon are never wrapped, so each step scans few candidates
+  hull = jarvisMarch(ppc::util::akl_toussaint(input));
   return true;
 }
 
 template <typename DataType>
 bool beskhmelnova_k_jarvis_march_seq::TestTaskSequential<DataType>::post_processing() {
   internal_order_test();
-  reinterpret_cast<int*>(taskData->outputs[0])[0] = num_points;
-  for (int i = 0; i < num_points; i++) {
-    reinterpret_cast<DataType*>(taskData->outputs[1])[i] = input[i][1];
-    reinterpret_cast<DataType*>(taskData->outputs[2])[i] = input[i][2];
+  reinterpret_cast<int*>(taskData->outputs[0])[0] = static_cast<int>(hull.size());
+  for (size_t i = 0; i < hull.size(); i++) {
+    reinterpret_cast<DataType*>(taskData->outputs[1])[i] = hull[i].x;
+    reinterpret_cast<DataType*>(taskData->outputs[2])[i] = hull[i].y;
   }
   return true;
 }
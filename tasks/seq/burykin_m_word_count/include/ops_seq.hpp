@@ -5,6 +5,7 @@
 #include <string>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace burykin_m_word_count {
 
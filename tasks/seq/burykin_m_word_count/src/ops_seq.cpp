@@ -2,6 +2,13 @@
 
 namespace burykin_m_word_count {
 
+namespace {
+
+// Letters and apostrophes, so "don't" is one word
+ppc::util::ByteClass word_characters() { return ppc::util::ByteClass::ascii_alpha() | ppc::util::ByteClass::of("'"); }
+
+}  // namespace
+
 bool TestTaskSequential::pre_processing() {
   internal_order_test();
   if (taskData->inputs[0] != nullptr && taskData->inputs_count[0] > 0) {
@@ -30,37 +37,10 @@ bool TestTaskSequential::post_processing() {
   return true;
 }
 
-bool TestTaskSequential::is_word_character(char c) {
-  return std::isalpha(static_cast<unsigned char>(c)) != 0 || c == '\'';
-}
+bool TestTaskSequential::is_word_character(char c) { return word_characters().contains(c); }
 
 int TestTaskSequential::count_words(const std::string& text) {
-  int count = 0;
-  bool in_word = false;
-
-  for (size_t i = 0; i < text.length(); ++i) {
-    char c = text[i];
-
-    if (is_word_character(c)) {
-      if (!in_word) {
-        count++;
-        in_word = true;
-      }
-    } else {
-      in_word = false;
-    }
-
-    if (c == '\'' && i > 0 && i < text.length() - 1) {
-      if ((std::isalpha(text[i - 1]) != 0) && (std::isalpha(text[i + 1]) != 0)) {
-        in_word = true;
-      }
-    }
-
-    // std::cout << "Символ: " << c << ", in_word: " << in_word << ", count: " << count << std::endl;
-  }
-
-  // std::cout << "Итоговый счет слов: " << count << std::endl;
-  return count;
+  return static_cast<int>(ppc::util::count_runs(text.data(), text.size(), word_characters()));
 }
 
 }  // namespace burykin_m_word_count
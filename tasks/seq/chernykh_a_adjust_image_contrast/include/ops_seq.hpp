@@ -5,6 +5,7 @@
 
 #include "core/task/include/task.hpp"
 #include "seq/chernykh_a_adjust_image_contrast/include/pixel.hpp"
+#include "util/contrast/include/contrast.hpp"
 
 namespace chernykh_a_adjust_image_contrast_seq {
 
@@ -4,6 +4,8 @@
 
 namespace chernykh_a_adjust_image_contrast_seq {
 
+static_assert(sizeof(Pixel) == 3, "pixels are handled as interleaved RGB bytes");
+
 bool SequentialTask::validation() {
   internal_order_test();
   return contrast_factor >= 0.0 && contrast_factor <= 2.0 &&       // Contrast factor within [0.0, 2.0]
@@ -23,8 +25,10 @@ bool SequentialTask::pre_processing() {
 
 bool SequentialTask::run() {
   internal_order_test();
-  std::transform(input.begin(), input.end(), result.begin(),
-                 [this](const Pixel& p) { return p.with_contrast(contrast_factor); });
+  // The adjustment depends on the byte value alone, so every channel of every pixel goes through one table
+  auto lut = ppc::util::make_lut([this](uint8_t v) { return Pixel::adjust_channel(v, contrast_factor); });
+  ppc::util::apply_lut(lut, reinterpret_cast<const uint8_t*>(input.data()), reinterpret_cast<uint8_t*>(result.data()),
+                       3 * input.size());
   return true;
 }
 
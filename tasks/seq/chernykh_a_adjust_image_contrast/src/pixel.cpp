@@ -14,13 +14,13 @@ Pixel Pixel::from_hex_color(uint32_t hex_color) {
   return Pixel((hex_color >> 16) & 0xFF, (hex_color >> 8) & 0xFF, hex_color & 0xFF);
 }
 
-Pixel Pixel::with_contrast(float factor) const {
-  auto adjust = [factor](uint8_t value) {
-    auto new_value = 128 + int(std::round(factor * float(value - 128)));
-    return uint8_t(std::clamp(new_value, 0, 255));
-  };
+uint8_t Pixel::adjust_channel(uint8_t value, float factor) {
+  auto new_value = 128 + int(std::round(factor * float(value - 128)));
+  return uint8_t(std::clamp(new_value, 0, 255));
+}
 
-  return Pixel(adjust(r), adjust(g), adjust(b));
+Pixel Pixel::with_contrast(float factor) const {
+  return Pixel(adjust_channel(r, factor), adjust_channel(g, factor), adjust_channel(b, factor));
 }
 
 bool Pixel::operator==(const Pixel& other) const { return r == other.r && g == other.g && b == other.b; }
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/labeling/include/labeling.hpp"
 
 namespace chistov_a_convex_hull_image_seq {
 struct Point {
@@ -48,69 +48,27 @@ int cross(const Point& p1, const Point& p2, const Point& p3) {
   return (p2.x - p1.x) * (p3.y - p1.y) - (p2.y - p1.y) * (p3.x - p1.x);
 }
 
-void labelingFirstPass(std::vector<int>& labeled_image, int width, int height) {
-  int mark = 2;
-
-  for (int i = 0; i < height; ++i) {
-    for (int j = 0; j < width; ++j) {
-      int current = labeled_image[i * width + j];
-      int left = (j == 0) ? 0 : labeled_image[i * width + (j - 1)];
-      int upper = (i == 0) ? 0 : labeled_image[(i - 1) * width + j];
-
-      if (current == 0) continue;
-
-      if (left == 0 && upper == 0) {
-        labeled_image[i * width + j] = mark++;
-      } else {
-        labeled_image[i * width + j] = std::max(left, upper);
-      }
-    }
-  }
-}
-
-void labelingSecondPass(std::vector<int>& labeled_image, int width, int height) {
-  for (int i = height - 1; i >= 0; --i) {
-    for (int j = width - 1; j >= 0; --j) {
-      int current = labeled_image[i * width + j];
-      int right = (j == width - 1) ? 0 : labeled_image[i * width + (j + 1)];
-      int lower = (i == height - 1) ? 0 : labeled_image[(i + 1) * width + j];
-
-      if (current == 0 || (right == 0 && lower == 0)) continue;
-
-      labeled_image[i * width + j] = std::max(right, lower);
-    }
-  }
-}
-
-std::vector<std::vector<Point>> processLabeledImage(const std::vector<int>& labeled_image, int width, int height) {
-  std::vector<int> component_indices;
-  std::vector<std::vector<Point>> components;
-
-  for (int i = 0; i < height; i++) {
-    for (int j = 0; j < width; j++) {
-      if (labeled_image[i * width + j] == 0) continue;
-
-      int component_label = labeled_image[i * width + j];
-
-      if (static_cast<size_t>(component_label) < component_indices.size() && component_indices[component_label] != -1) {
-        components[component_indices[component_label]].push_back(Point{j, i});
-      } else {
-        component_indices.resize(std::max(component_indices.size(), static_cast<size_t>(component_label + 1)), -1);
-        component_indices[component_label] = components.size();
-        components.push_back({Point{j, i}});
-      }
+// Boundary pixels of every component: the leftmost and rightmost pixel of each of its rows. Every hull vertex
+// is among them, so a component of n rows gives the hull at most 2n points, however many pixels it has.
+std::vector<std::vector<Point>> componentBoundaries(const ppc::util::BandLabels& band) {
+  std::vector<std::vector<Point>> components(band.count);
+  for (const auto& run : band.runs) {
+    auto& points = components[run.label];
+    // Runs of a row arrive left to right: a later run of the same row only moves the right end
+    if (points.size() >= 2 && points.back().y == run.row && points[points.size() - 2].y == run.row) {
+      points.back().x = run.last;
+    } else if (!points.empty() && points.back().y == run.row) {
+      points.push_back(Point{run.last, run.row});
+    } else {
+      points.push_back(Point{run.first, run.row});
+      if (run.last != run.first) points.push_back(Point{run.last, run.row});
     }
   }
   return components;
 }
 
 std::vector<std::vector<Point>> labeling(const std::vector<int>& image, int width, int height) {
-  std::vector<int> labeled_image(width * height);
-
-  std::copy(image.begin(), image.end(), labeled_image.begin());
-  labelingFirstPass(labeled_image, width, height);
-  labelingSecondPass(labeled_image, width, height);
-  return processLabeledImage(labeled_image, width, height);
+  return componentBoundaries(ppc::util::label_band(image.data(), width, 0, height));
 }
 
 std::vector<Point> graham(std::vector<Point> points) {
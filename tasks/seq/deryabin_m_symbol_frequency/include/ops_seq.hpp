@@ -3,6 +3,7 @@
 #include <string>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace deryabin_m_symbol_frequency_seq {
 
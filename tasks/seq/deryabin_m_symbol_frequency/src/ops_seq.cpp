@@ -22,11 +22,8 @@ bool deryabin_m_symbol_frequency_seq::SymbolFrequencyTaskSequential::validation(
 
 bool deryabin_m_symbol_frequency_seq::SymbolFrequencyTaskSequential::run() {
   internal_order_test();
-  for (char i : input_str_) {
-    if (i == input_symbol_) {
-      frequency_++;
-    }
-  }
+  frequency_ = static_cast<int>(ppc::util::count_class(input_str_.data(), input_str_.size(),
+                                                        ppc::util::ByteClass::of({&input_symbol_, 1})));
   return true;
 }
 
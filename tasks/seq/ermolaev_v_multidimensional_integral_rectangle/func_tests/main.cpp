@@ -97,14 +97,14 @@ TEST(ermolaev_v_multidimensional_integral_rectangle_seq, advanced_triple_integra
 }
 
 TEST(ermolaev_v_multidimensional_integral_rectangle_seq, advanced_double_integral_two_variables) {
-  erm_integral_seq::testBody({{-0.5, 0.8}, {-2, 2}}, -1.44106, erm_integral_seq::advancedTwoVar);
+  erm_integral_seq::testBody({{-0.5, 0.8}, {-2, 2}}, -1.44095, erm_integral_seq::advancedTwoVar);
 }
 TEST(ermolaev_v_multidimensional_integral_rectangle_seq, advanced_triple_integral_two_variables) {
-  erm_integral_seq::testBody({{-0.5, 0.8}, {-2, 2}, {2.5, 2.6}}, -0.14421, erm_integral_seq::advancedTwoVar);
+  erm_integral_seq::testBody({{-0.5, 0.8}, {-2, 2}, {2.5, 2.6}}, -0.14409, erm_integral_seq::advancedTwoVar);
 }
 
 TEST(ermolaev_v_multidimensional_integral_rectangle_seq, advanced_triple_integral_three_variables) {
-  erm_integral_seq::testBody({{-0.5, 0.8}, {-2, 2}, {2.5, 2.6}}, -6.18355, erm_integral_seq::advancedThreeVar);
+  erm_integral_seq::testBody({{-0.5, 0.8}, {-2, 2}, {2.5, 2.6}}, -6.18376, erm_integral_seq::advancedThreeVar);
 }
 
 TEST(ermolaev_v_multidimensional_integral_rectangle_seq, validation) {
@@ -2,18 +2,31 @@
 #pragma once
 
 #include <cmath>
-#include <deque>
 #include <functional>
+#include <utility>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/cubature/include/adaptive_cubature.hpp"
 
 namespace ermolaev_v_multidimensional_integral_rectangle_seq {
 using function = std::function<double(std::vector<double>& args)>;
+using limits_t = std::vector<std::pair<double, double>>;
 
-double integrateImpl(std::deque<std::pair<double, double>>& limits, std::vector<double>& args, const function& func,
-                     double eps);
-double integrate(std::deque<std::pair<double, double>> limits, double eps, const function& func);
+// Adaptive cubature to an absolute error of eps; F is any callable taking std::vector<double>& and is
+// inlined into the cubature rule when it is not a type-erased function
+template <class F>
+double integrate(const limits_t& limits, double eps, F&& func) {
+  std::vector<double> lower;
+  std::vector<double> upper;
+  for (const auto& [a, b] : limits) {
+    lower.push_back(a);
+    upper.push_back(b);
+  }
+  ppc::util::CubatureOptions options;
+  options.epsilon = eps;
+  return ppc::util::adaptive_cubature(func, lower, upper, options).value;
+}
 
 class TestTaskSequential : public ppc::core::Task {
  public:
@@ -25,7 +38,7 @@ class TestTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::deque<std::pair<double, double>> limits_;
+  limits_t limits_;
   function function_;
   double eps_{};
   double res_{};
@@ -145,3 +145,19 @@ TEST(gusev_n_trapezoidal_rule_seq, test_set_function) {
   double expected_result = 4.0;
   ASSERT_EQ(func(x), expected_result);
 }
+
+TEST(gusev_n_trapezoidal_rule_seq, test_validation_rejects_non_positive_n) {
+  for (int n : {0, -5}) {
+    std::vector<double> in = {0.0, 1.0, static_cast<double>(n)};
+    std::vector<double> out(1, 0.0);
+
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    taskDataSeq->inputs_count.emplace_back(in.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    taskDataSeq->outputs_count.emplace_back(out.size());
+
+    gusev_n_trapezoidal_rule_seq::TrapezoidalIntegrationSequential testTaskSequential(taskDataSeq);
+    ASSERT_FALSE(testTaskSequential.validation());
+  }
+}
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 
 namespace gusev_n_trapezoidal_rule_seq {
 
@@ -19,16 +20,18 @@ class TrapezoidalIntegrationSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
-  void set_function(const std::function<double(double)>& func);
+  // Any double(double) callable; a lambda is inlined into the batched quadrature loop
+  template <ppc::util::ScalarIntegrand F>
+  void set_function(F func) {
+    func_ = ppc::util::make_batch_integrand(std::move(func));
+  }
 
  private:
-  static double integrate(const std::function<double(double)>& f, double a, double b, int n);
-
   double a_{};
   double b_{};
   int n_{};
   double result_{};
-  std::function<double(double)> func_;
+  ppc::util::BatchIntegrand func_;
 };
 
 }  // namespace gusev_n_trapezoidal_rule_seq
\ No newline at end of file
@@ -2,6 +2,11 @@
 #define _USE_MATH_DEFINES
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
 #include <random>
 #include <vector>
 
@@ -90,3 +95,55 @@ TEST(gusev_n_trapezoidal_rule_seq, test_task_run) {
 
   ASSERT_NEAR(out[0], expected_result, 1e-3);
 }
+
+// Integrand evaluations per second: the per-point std::function loop the task used to run, against the
+// quadrature library fed the same std::function and fed the lambda itself
+TEST(gusev_n_trapezoidal_rule_seq, evaluations_per_second) {
+  const double a = 0.0;
+  const double b = 1.0;
+  const int n = 20000000;
+  auto f = [](double x) { return x * x * (1.0 - x) + 0.5 * x; };
+  const double expected_result = 1.0 / 12.0 + 0.25;
+
+  auto seconds_since = [](std::chrono::high_resolution_clock::time_point t0) {
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+  };
+  auto report = [&](const char* name, double evaluations, double result, double seconds) {
+    std::cout << std::left << std::setw(36) << name << std::setw(10) << std::setprecision(4)
+              << evaluations / seconds / 1e6 << "Meval/s  " << seconds * 1e3 << " ms\n";
+    EXPECT_NEAR(result, expected_result, 1e-9);
+  };
+
+  std::function<double(double)> erased = f;
+  auto t0 = std::chrono::high_resolution_clock::now();
+  const double h = (b - a) / n;
+  double sum = 0.0;
+  for (int i = 0; i < n; ++i) {
+    sum += (erased(a + i * h) + erased(a + (i + 1) * h)) * h / 2.0;
+  }
+  // Every interior node was evaluated twice
+  report("std::function per point (before)", 2.0 * n, sum, seconds_since(t0));
+
+  auto run_task = [&](auto func) {
+    std::vector<double> in = {a, b, static_cast<double>(n)};
+    std::vector<double> out(1, 0.0);
+    auto taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    gusev_n_trapezoidal_rule_seq::TrapezoidalIntegrationSequential task(taskData);
+    task.set_function(func);
+    EXPECT_TRUE(task.validation());
+    task.pre_processing();
+    task.run();
+    task.post_processing();
+    return out[0];
+  };
+  t0 = std::chrono::high_resolution_clock::now();
+  double erased_result = run_task(erased);
+  report("std::function through batches", n + 2.0, erased_result, seconds_since(t0));
+  t0 = std::chrono::high_resolution_clock::now();
+  double inlined_result = run_task(f);
+  report("inlined lambda through batches", n + 2.0, inlined_result, seconds_since(t0));
+}
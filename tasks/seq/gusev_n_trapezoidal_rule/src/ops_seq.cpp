@@ -18,13 +18,14 @@ bool gusev_n_trapezoidal_rule_seq::TrapezoidalIntegrationSequential::pre_process
 
 bool gusev_n_trapezoidal_rule_seq::TrapezoidalIntegrationSequential::validation() {
   internal_order_test();
-  return taskData->inputs_count[0] == 3 && taskData->outputs_count[0] == 1;
+  return taskData->inputs_count[0] == 3 && taskData->outputs_count[0] == 1 &&
+         static_cast<int>(reinterpret_cast<double*>(taskData->inputs[0])[2]) > 0;
 }
 
 bool gusev_n_trapezoidal_rule_seq::TrapezoidalIntegrationSequential::run() {
   internal_order_test();
 
-  result_ = integrate(func_, a_, b_, n_);
+  result_ = ppc::util::composite_quadrature(func_, a_, b_, n_, ppc::util::QuadratureRule::kTrapezoid);
 
   return true;
 }
@@ -35,22 +36,3 @@ bool gusev_n_trapezoidal_rule_seq::TrapezoidalIntegrationSequential::post_proces
   reinterpret_cast<double*>(taskData->outputs[0])[0] = result_;
   return true;
 }
-
-double gusev_n_trapezoidal_rule_seq::TrapezoidalIntegrationSequential::integrate(const std::function<double(double)>& f,
-                                                                                 double a, double b, int n) {
-  double step = (b - a) / n;
-  double area = 0.0;
-
-  for (int i = 0; i < n; ++i) {
-    double x0 = a + i * step;
-    double x1 = a + (i + 1) * step;
-    area += (f(x0) + f(x1)) * step / 2.0;
-  }
-
-  return area;
-}
-
-void gusev_n_trapezoidal_rule_seq::TrapezoidalIntegrationSequential::set_function(
-    const std::function<double(double)>& func) {
-  func_ = func;
-}
\ No newline at end of file
@@ -358,4 +358,31 @@ TEST(ivanov_m_integration_trapezoid_seq_func_test, cosinus_result_less_than_zero
   testTaskSequential.run();
   testTaskSequential.post_processing();
   ASSERT_NEAR(res, out[0], 1e-3);
-}
\ No newline at end of file
+}
+
+TEST(ivanov_m_integration_trapezoid_seq_func_test, romberg_reaches_tolerance) {
+  const double a = 0;
+  const double b = 3;
+  const int n = 1 << 20;
+  const double res = std::exp(3.0) - 1.0;
+
+  std::vector<double> in = {a, b, static_cast<double>(n)};
+  std::vector<double> out(1, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskDataSeq->inputs_count.emplace_back(in.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  // Here n only caps the refinement; the iteration stops far earlier
+  ivanov_m_integration_trapezoid_seq::TestTaskSequential testTaskSequential(taskDataSeq);
+  testTaskSequential.add_function([](double x) { return std::exp(x); });
+  testTaskSequential.set_tolerance(1e-10);
+
+  ASSERT_EQ(testTaskSequential.validation(), true);
+  testTaskSequential.pre_processing();
+  testTaskSequential.run();
+  testTaskSequential.post_processing();
+  ASSERT_NEAR(res, out[0], 1e-9);
+}
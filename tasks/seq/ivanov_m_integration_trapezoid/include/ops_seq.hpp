@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 
 namespace ivanov_m_integration_trapezoid_seq {
 
@@ -16,12 +17,20 @@ class TestTaskSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
-  void add_function(const ::std::function<double(double)>& f);
+  template <ppc::util::ScalarIntegrand F>
+  void add_function(F f) {
+    f_ = ppc::util::make_batch_integrand(std::move(f));
+  }
+
+  // Switches run() to Romberg refinement: the step is halved until successive extrapolations agree
+  // to epsilon, and n becomes the cap on the number of subintervals
+  void set_tolerance(double epsilon) { epsilon_ = epsilon; }
 
  private:
   double a_{}, b_{}, result_{};
   int n_{};
-  std::function<double(double)> f_;
+  double epsilon_{};
+  ppc::util::BatchIntegrand f_;
 };
 
-}  // namespace ivanov_m_integration_trapezoid_seq
\ No newline at end of file
+}  // namespace ivanov_m_integration_trapezoid_seq
@@ -1,7 +1,9 @@
 // Copyright 2024 Ivanov Mike
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <functional>
+#include <iostream>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
@@ -89,4 +91,48 @@ TEST(ivanov_m_integration_trapezoid_seq_perf_test, test_task_run) {
   auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testTaskSequential);
   perfAnalyzer->task_run(perfAttr, perfResults);
   ppc::core::Perf::print_perf_statistic(perfResults);
-}
\ No newline at end of file
+}
+
+// Integrand evaluations needed for an error below 1e-10 on the integral of e^x over [0, 3]: one fixed-n
+// trapezoid pass against Romberg refinement, which evaluates only the new midpoints of each level
+TEST(ivanov_m_integration_trapezoid_seq_perf_test, evaluations_to_tolerance) {
+  const double exact = std::exp(3.0) - 1.0;
+  const double epsilon = 1e-10;
+
+  auto solve = [&](int n, double tolerance, size_t &evaluations) {
+    std::vector<double> in = {0.0, 3.0, static_cast<double>(n)};
+    std::vector<double> out(1, 0);
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    taskDataSeq->inputs_count.emplace_back(in.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    taskDataSeq->outputs_count.emplace_back(out.size());
+
+    ivanov_m_integration_trapezoid_seq::TestTaskSequential task(taskDataSeq);
+    evaluations = 0;
+    task.add_function([&evaluations](double x) {
+      evaluations++;
+      return std::exp(x);
+    });
+    task.set_tolerance(tolerance);
+    task.validation();
+    task.pre_processing();
+    task.run();
+    task.post_processing();
+    return out[0];
+  };
+
+  // The trapezoid error is (b - a) h^2 max|f''| / 12, so this n is just enough
+  auto n = static_cast<int>(std::ceil(std::sqrt(27.0 * std::exp(3.0) / (12.0 * epsilon))));
+  size_t fixed_evaluations;
+  double fixed = solve(n, 0.0, fixed_evaluations);
+  size_t romberg_evaluations;
+  double romberg = solve(1 << 24, epsilon, romberg_evaluations);
+
+  std::cout << "fixed trapezoid: " << fixed_evaluations << " evaluations, |error| " << std::abs(fixed - exact) << '\n';
+  std::cout << "romberg:         " << romberg_evaluations << " evaluations, |error| " << std::abs(romberg - exact)
+            << '\n';
+  EXPECT_NEAR(fixed, exact, epsilon);
+  EXPECT_NEAR(romberg, exact, epsilon);
+  EXPECT_LT(romberg_evaluations * 1000, fixed_evaluations);
+}
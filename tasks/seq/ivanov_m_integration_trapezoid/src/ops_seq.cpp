@@ -3,8 +3,9 @@
 
 bool ivanov_m_integration_trapezoid_seq::TestTaskSequential::validation() {
   internal_order_test();
-  // Check count elements of output
-  return taskData->inputs_count[0] == 3 && taskData->outputs_count[0] == 1;
+  // Check count elements of output and the number of intervals
+  return taskData->inputs_count[0] == 3 && taskData->outputs_count[0] == 1 &&
+         static_cast<int>(reinterpret_cast<double*>(taskData->inputs[0])[2]) > 0;
 }
 
 bool ivanov_m_integration_trapezoid_seq::TestTaskSequential::pre_processing() {
@@ -22,9 +23,14 @@ bool ivanov_m_integration_trapezoid_seq::TestTaskSequential::pre_processing() {
 bool ivanov_m_integration_trapezoid_seq::TestTaskSequential::run() {
   internal_order_test();
   if (a_ == b_) return true;
-  double step_ = (b_ - a_) / n_;
-  for (int i = 0; i < n_; i++) result_ += (f_(a_ + i * step_) + f_(a_ + (i + 1) * step_));
-  result_ = result_ / 2 * step_;
+  if (epsilon_ > 0) {
+    ppc::util::RombergOptions options;
+    options.epsilon = epsilon_;
+    options.max_intervals = static_cast<size_t>(n_);
+    result_ = ppc::util::romberg(f_, a_, b_, options).value;
+    return true;
+  }
+  result_ = ppc::util::composite_quadrature(f_, a_, b_, static_cast<size_t>(n_), ppc::util::QuadratureRule::kTrapezoid);
   return true;
 }
 
@@ -33,7 +39,3 @@ bool ivanov_m_integration_trapezoid_seq::TestTaskSequential::post_processing() {
   reinterpret_cast<double*>(taskData->outputs[0])[0] = result_;
   return true;
 }
-
-void ivanov_m_integration_trapezoid_seq::TestTaskSequential::add_function(const std::function<double(double)>& f) {
-  f_ = f;
-}
\ No newline at end of file
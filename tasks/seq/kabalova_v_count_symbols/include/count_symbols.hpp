@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace kabalova_v_count_symbols_seq {
 
@@ -21,6 +22,7 @@ class TestTaskSequential : public ppc::core::Task {
  private:
   std::string input_{};
   int result{};
+  ppc::util::ByteHistogram histogram_;
 };
 
 }  // namespace kabalova_v_count_symbols_seq
\ No newline at end of file
@@ -8,13 +8,8 @@
 using namespace std::chrono_literals;
 
 int kabalova_v_count_symbols_seq::countSymbols(std::string& str) {
-  int result = 0;
-  for (size_t i = 0; i < str.size(); i++) {
-    if (isalpha(str[i]) != 0) {
-      result++;
-    }
-  }
-  return result;
+  const ppc::util::ByteHistogram histogram(str.data(), str.size());
+  return static_cast<int>(histogram.count(ppc::util::ByteClass::ascii_alpha()));
 }
 
 bool kabalova_v_count_symbols_seq::TestTaskSequential::pre_processing() {
@@ -33,7 +28,9 @@ bool kabalova_v_count_symbols_seq::TestTaskSequential::validation() {
 
 bool kabalova_v_count_symbols_seq::TestTaskSequential::run() {
   internal_order_test();
-  result = countSymbols(input_);
+  // Letters are read from the histogram, which answers any other character class without a rescan
+  histogram_ = ppc::util::ByteHistogram(input_.data(), input_.size());
+  result = static_cast<int>(histogram_.count(ppc::util::ByteClass::ascii_alpha()));
   return true;
 }
 
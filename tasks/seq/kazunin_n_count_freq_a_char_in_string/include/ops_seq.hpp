@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace kazunin_n_count_freq_a_char_in_string_seq {
 
@@ -20,5 +21,6 @@ class CountFreqCharTaskSequential : public ppc::core::Task {
   char target_character_{};
   int frequency_count_ = 0;
   std::string input_string_;
+  ppc::util::ByteHistogram histogram_;
 };
 }  // namespace kazunin_n_count_freq_a_char_in_string_seq
@@ -21,11 +21,9 @@ bool kazunin_n_count_freq_a_char_in_string_seq::CountFreqCharTaskSequential::val
 
 bool kazunin_n_count_freq_a_char_in_string_seq::CountFreqCharTaskSequential::run() {
   internal_order_test();
-  for (const auto& ch : input_string_) {
-    if (ch == target_character_) {
-      ++frequency_count_;
-    }
-  }
+  // One pass counts every character; the target is then a lookup, as any further character would be
+  histogram_ = ppc::util::ByteHistogram(input_string_.data(), input_string_.size());
+  frequency_count_ = static_cast<int>(histogram_.count(target_character_));
   return true;
 }
 
@@ -18,12 +18,8 @@ bool CountSentencesSequential::validation() {
 
 bool CountSentencesSequential::run() {
   internal_order_test();
-  for (size_t i = 0; i < text.size(); i++) {
-    char c = text[i];
-    if (c == '.' || c == '?' || c == '!') {
-      sentence_count++;
-    }
-  }
+  sentence_count =
+      static_cast<int>(ppc::util::count_class(text.data(), text.size(), ppc::util::ByteClass::sentence_end()));
   return true;
 }
 
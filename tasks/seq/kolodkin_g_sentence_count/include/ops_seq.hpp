@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace kolodkin_g_sentence_count_seq {
 
@@ -17,12 +17,8 @@ bool kolodkin_g_sentence_count_seq::TestTaskSequential::validation() {
 
 bool kolodkin_g_sentence_count_seq::TestTaskSequential::run() {
   internal_order_test();
-  for (unsigned long i = 0; i < input_.length(); i++) {
-    if ((input_[i] == '.' || input_[i] == '!' || input_[i] == '?') &&
-        ((input_[i + 1] != '.' && input_[i + 1] != '!' && input_[i + 1] != '?') || i + 1 == input_.length())) {
-      res++;
-    }
-  }
+  // "?!" or "..." ends one sentence: count runs of terminators, not terminators
+  res = static_cast<int>(ppc::util::count_runs(input_.data(), input_.size(), ppc::util::ByteClass::sentence_end()));
   return true;
 }
 
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/contrast/include/contrast.hpp"
 
 namespace kondratev_ya_contrast_adjustment_seq {
 
@@ -1,6 +1,8 @@
 // Copyright 2024 Nesterov Alexander
 #include "seq/kondratev_ya_contrast_adjustment/include/ops_seq.hpp"
 
+static_assert(sizeof(kondratev_ya_contrast_adjustment_seq::Pixel) == 3, "pixels are read as interleaved RGB bytes");
+
 double kondratev_ya_contrast_adjustment_seq::getContrast(
     std::vector<kondratev_ya_contrast_adjustment_seq::Pixel>& array) {
   auto [min, max] = std::minmax_element(array.begin(), array.end(), [](auto a, auto b) { return a.red < b.red; });
@@ -30,21 +32,15 @@ bool kondratev_ya_contrast_adjustment_seq::TestTaskSequential::validation() {
 bool kondratev_ya_contrast_adjustment_seq::TestTaskSequential::run() {
   internal_order_test();
 
-  double average[3]{0, 0, 0};  // RGB
-
-  for (auto& pixel : input_) {
-    average[0] += pixel.red;
-    average[1] += pixel.green;
-    average[2] += pixel.blue;
-  }
-
-  for (uint32_t i = 0; i < 3; i++) average[i] /= input_.size();
-
-  for (uint32_t i = 0; i < input_.size(); i++) {
-    res_[i].red = std::clamp((int32_t)(contrast_ * (input_[i].red - average[0]) + average[0]), 0, 255);
-    res_[i].green = std::clamp((int32_t)(contrast_ * (input_[i].green - average[1]) + average[1]), 0, 255);
-    res_[i].blue = std::clamp((int32_t)(contrast_ * (input_[i].blue - average[2]) + average[2]), 0, 255);
+  // Channel means in one pass over planar channels, then a table per channel replaces the per-pixel arithmetic
+  ppc::util::PlanarImage image;
+  auto stats = image.load(reinterpret_cast<const uint8_t*>(input_.data()), input_.size(), 3);
+  std::vector<ppc::util::ContrastLut> luts;
+  for (const auto& channel : stats) {
+    double average = channel.mean();
+    luts.push_back(ppc::util::make_lut([&](uint8_t v) { return (int32_t)(contrast_ * (v - average) + average); }));
   }
+  image.apply(luts, reinterpret_cast<uint8_t*>(res_.data()));
 
   return true;
 }
@@ -2,52 +2,8 @@
 #include "seq/kondratev_ya_radix_sort_batcher_merge/include/ops_seq.hpp"
 
 void kondratev_ya_radix_sort_batcher_merge_seq::radixSortDouble(std::vector<double>& arr, int start, int end) {
-  const int byte_size = 8;
-  const int double_bit_size = byte_size * sizeof(double);
-  const int full_byte_bit_mask = 0xFF;
-  const int byte_range = std::pow(2, byte_size);
-  const uint64_t sign_bit_mask = 1ULL << (double_bit_size - 1);
-
-  int size = end - start + 1;
-  std::vector<double> temp(size);
-
-  // uint64_t because sizeof(uint64_t) == sizeof(double)
-  auto* bits = reinterpret_cast<uint64_t*>(arr.data() + start);
-
-  // Invert the sign bit for negative numbers
-  for (int i = 0; i < size; i++) {
-    if ((bool)(bits[i] >> (double_bit_size - 1))) {
-      bits[i] = ~bits[i];
-    } else {
-      bits[i] |= sign_bit_mask;
-    }
-  }
-
-  // Sorting by bits
-  for (int shift = 0; shift < double_bit_size; shift += byte_size) {
-    std::vector<int> count(byte_range, 0);
-    for (int i = 0; i < size; i++) {
-      count[(bits[i] >> shift) & full_byte_bit_mask]++;
-    }
-
-    std::partial_sum(count.begin(), count.end(), count.begin());
-
-    for (int i = size - 1; i >= 0; i--) {
-      int bucket = (bits[i] >> shift) & full_byte_bit_mask;
-      temp[count[bucket] - 1] = arr[start + i];
-      count[bucket]--;
-    }
-    std::copy(temp.begin(), temp.end(), arr.begin() + start);
-  }
-
-  // Restore inverted signs
-  for (int i = 0; i < size; i++) {
-    if (!(bool)(bits[i] & sign_bit_mask)) {
-      bits[i] = ~bits[i];
-    } else {
-      bits[i] &= ~sign_bit_mask;
-    }
-  }
+  if (end <= start) return;
+  ppc::util::radix_sort(arr.data() + start, arr.data() + end + 1);
 }
 
 bool kondratev_ya_radix_sort_batcher_merge_seq::TestTaskSequential::pre_processing() {
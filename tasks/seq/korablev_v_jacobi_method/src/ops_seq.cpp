@@ -33,17 +33,6 @@ bool korablev_v_jacobi_method_seq::JacobiMethodSequential::isNonSingular(const s
   return true;
 }
 
-bool korablev_v_jacobi_method_seq::JacobiMethodSequential::isNeedToComplete(const std::vector<double>& x_old,
-                                                                            const std::vector<double>& x_new) const {
-  double sum_up = 0;
-  double sum_low = 0;
-  for (size_t k = 0; k < x_old.size(); k++) {
-    sum_up += (x_new[k] - x_old[k]) * (x_new[k] - x_old[k]);
-    sum_low += x_new[k] * x_new[k];
-  }
-  return (sqrt(sum_up / sum_low) < epsilon_);
-}
-
 bool korablev_v_jacobi_method_seq::JacobiMethodSequential::pre_processing() {
   internal_order_test();
   size_t n = *reinterpret_cast<size_t*>(taskData->inputs[0]);
@@ -108,8 +97,11 @@ bool korablev_v_jacobi_method_seq::JacobiMethodSequential::run() {
   size_t numberOfIter = 0;
 
   while (numberOfIter < maxIterations_) {
-    std::copy(x_.begin(), x_.end(), x_prev.begin());
+    x_prev.swap(x_);
 
+    // The relative update norm is accumulated during the sweep, so the stopping test costs O(1)
+    double sum_up = 0;
+    double sum_low = 0;
     for (size_t k = 0; k < n; k++) {
       double S = 0;
       for (size_t j = 0; j < n; j++) {
@@ -118,9 +110,11 @@ bool korablev_v_jacobi_method_seq::JacobiMethodSequential::run() {
         }
       }
       x_[k] = (b_[k] - S) / A_[k * n + k];
+      sum_up += (x_[k] - x_prev[k]) * (x_[k] - x_prev[k]);
+      sum_low += x_[k] * x_[k];
     }
 
-    if (isNeedToComplete(x_prev, x_)) break;
+    if (sqrt(sum_up / sum_low) < epsilon_) break;
     numberOfIter++;
   }
 
@@ -4,10 +4,15 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/geometry/include/geometry.hpp"
 
 namespace kurakin_m_graham_scan_seq {
 
-bool isLeftAngle(std::vector<double>& p1, std::vector<double>& p2, std::vector<double>& p3);
+using Point = ppc::util::Point2<double>;
+
+// Hull including points in the middle of its edges, counter-clockwise from the lowest point (the rightmost
+// of equally low ones)
+std::vector<Point> grahamScan(const std::vector<Point>& points);
 
 class TestTaskSequential : public ppc::core::Task {
  public:
@@ -19,7 +24,7 @@ class TestTaskSequential : public ppc::core::Task {
 
  private:
   int count_point{};
-  std::vector<std::vector<double>> input_;
+  std::vector<Point> input_;
 };
 
 }  // namespace kurakin_m_graham_scan_seq
\ No newline at end of file
@@ -1,26 +1,32 @@
 #include "seq/kurakin_m_graham_scan/include/kurakin_graham_scan_ops_seq.hpp"
 
 #include <algorithm>
-#include <cmath>
-#include <functional>
-#include <random>
-#include <thread>
 #include <vector>
 
-bool kurakin_m_graham_scan_seq::isLeftAngle(std::vector<double>& p1, std::vector<double>& p2, std::vector<double>& p3) {
-  return ((p2[0] - p1[0]) * (p3[1] - p1[1]) - (p3[0] - p1[0]) * (p2[1] - p1[1])) < 0;
+std::vector<kurakin_m_graham_scan_seq::Point> kurakin_m_graham_scan_seq::grahamScan(const std::vector<Point>& points) {
+  // Interior points never reach the scan; Andrew's monotone chain is the Graham scan over x-sorted points
+  auto candidates = ppc::util::akl_toussaint(points);
+  auto hull = ppc::util::monotone_chain(candidates, true);
+  auto start = std::min_element(hull.begin(), hull.end(),
+                                [](const Point& a, const Point& b) { return a.y < b.y || (a.y == b.y && a.x > b.x); });
+  std::rotate(hull.begin(), start, hull.end());
+
+  // Repeated input points stay in the answer, each copy next to the others
+  std::sort(candidates.begin(), candidates.end(), ppc::util::lex_less<double>);
+  std::vector<Point> res;
+  for (const auto& p : hull) {
+    auto [first, last] = std::equal_range(candidates.begin(), candidates.end(), p, ppc::util::lex_less<double>);
+    res.insert(res.end(), first, last);
+  }
+  return res;
 }
 
 bool kurakin_m_graham_scan_seq::TestTaskSequential::pre_processing() {
   internal_order_test();
 
   count_point = (int)taskData->inputs_count[0] / 2;
-  input_ = std::vector<std::vector<double>>(count_point, std::vector<double>(2, 0));
-  auto* tmp_ptr = reinterpret_cast<double*>(taskData->inputs[0]);
-  for (int i = 0; i < count_point * 2; i += 2) {
-    input_[i / 2][0] = tmp_ptr[i];
-    input_[i / 2][1] = tmp_ptr[i + 1];
-  }
+  auto* tmp_ptr = reinterpret_cast<Point*>(taskData->inputs[0]);
+  input_.assign(tmp_ptr, tmp_ptr + count_point);
 
   return true;
 }
@@ -36,24 +42,8 @@ bool kurakin_m_graham_scan_seq::TestTaskSequential::validation() {
 bool kurakin_m_graham_scan_seq::TestTaskSequential::run() {
   internal_order_test();
 
-  int ind_min_y = std::min_element(input_.begin(), input_.end(),
-                                   [&](std::vector<double> a, std::vector<double> b) {
-                                     return a[1] < b[1] || (a[1] == b[1] && a[0] > b[0]);
-                                   }) -
-                  input_.begin();
-  std::swap(input_[0], input_[ind_min_y]);
-  std::sort(input_.begin() + 1, input_.end(),
-            [&](std::vector<double> a, std::vector<double> b) { return isLeftAngle(a, input_[0], b); });
-
-  int k = 1;
-  for (int i = 2; i < count_point; i++) {
-    while (k > 0 && isLeftAngle(input_[k - 1], input_[k], input_[i])) {
-      k--;
-    }
-    std::swap(input_[i], input_[k + 1]);
-    k++;
-  }
-  count_point = k + 1;
+  input_ = grahamScan(input_);
+  count_point = static_cast<int>(input_.size());
 
   return true;
 }
@@ -62,10 +52,7 @@ bool kurakin_m_graham_scan_seq::TestTaskSequential::post_processing() {
   internal_order_test();
 
   reinterpret_cast<int*>(taskData->outputs[0])[0] = count_point;
-  for (int i = 0; i < count_point * 2; i += 2) {
-    reinterpret_cast<double*>(taskData->outputs[1])[i] = input_[i / 2][0];
-    reinterpret_cast<double*>(taskData->outputs[1])[i + 1] = input_[i / 2][1];
-  }
+  std::copy(input_.begin(), input_.end(), reinterpret_cast<Point*>(taskData->outputs[1]));
 
   return true;
 }
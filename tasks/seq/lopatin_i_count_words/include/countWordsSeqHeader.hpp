@@ -6,6 +6,7 @@
 #include <sstream>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace lopatin_i_count_words_seq {
 std::vector<char> generateLongString(int n);
@@ -35,23 +35,8 @@ bool lopatin_i_count_words_seq::TestTaskSequential::validation() {
 bool lopatin_i_count_words_seq::TestTaskSequential::run() {
   internal_order_test();
 
-  wordCount = 0;
-  bool inWord = false;
-
-  for (size_t i = 0; i < input_.size(); ++i) {
-    if (input_[i] == ' ') {
-      if (inWord) {
-        wordCount++;
-        inWord = false;
-      }
-    } else if (!inWord) {
-      inWord = true;
-    }
-  }
-
-  if (inWord) {
-    wordCount++;
-  }
+  // Words are the runs of anything but spaces
+  wordCount = static_cast<int>(ppc::util::count_runs(input_.data(), input_.size(), ~ppc::util::ByteClass::of(" ")));
 
   return true;
 }
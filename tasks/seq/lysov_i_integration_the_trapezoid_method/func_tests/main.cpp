@@ -192,4 +192,23 @@ TEST(lysov_i_integration_the_trapezoid_method_seq, OutputSizeMoreThan1) {
   taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(&result2));
   lysov_i_integration_the_trapezoid_method_seq::TestTaskSequential testTaskSequential(taskDataSeq);
   ASSERT_FALSE(testTaskSequential.validation());
-}
\ No newline at end of file
+}
+TEST(lysov_i_integration_the_trapezoid_method_seq, EpsilonWiderThanInterval) {
+  // One trapezoid, even for an empty interval
+  for (double b : {1.0, 0.0}) {
+    double a = 0.0;
+    double epsilon = 2.0;
+    auto taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.push_back(reinterpret_cast<uint8_t *>(&a));
+    taskData->inputs.push_back(reinterpret_cast<uint8_t *>(&b));
+    taskData->inputs.push_back(reinterpret_cast<uint8_t *>(&epsilon));
+    double output = -1.0;
+    taskData->outputs.push_back(reinterpret_cast<uint8_t *>(&output));
+    lysov_i_integration_the_trapezoid_method_seq::TestTaskSequential task(taskData);
+    ASSERT_TRUE(task.validation());
+    task.pre_processing();
+    task.run();
+    task.post_processing();
+    ASSERT_NEAR(output, b / 2, 1e-12);
+  }
+}
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 namespace lysov_i_integration_the_trapezoid_method_seq {
 class TestTaskSequential : public ppc::core::Task {
  public:
@@ -15,7 +16,6 @@ class TestTaskSequential : public ppc::core::Task {
   static double function_square(double x) { return x * x; }
 
  private:
-  std::vector<double> input_;
   double res{};
 };
 }  // namespace lysov_i_integration_the_trapezoid_method_seq
\ No newline at end of file
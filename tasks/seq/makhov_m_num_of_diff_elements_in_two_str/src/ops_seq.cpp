@@ -1,14 +1,10 @@
 // Copyright 2024 Nesterov Alexander
 #include "seq/makhov_m_num_of_diff_elements_in_two_str/include/ops_seq.hpp"
 
+#include "util/text/include/text.hpp"
+
 int makhov_m_num_of_diff_elements_in_two_str_seq::countDiffElem(const std::string &str1_, const std::string &str2_) {
-  int count = 0;
-  int sizeDiff = std::abs(((int)str1_.size() - (int)str2_.size()));
-  size_t minSize = std::min(str1_.size(), str2_.size());
-  for (size_t i = 0; i < minSize; i++) {
-    if (str1_[i] != str2_[i]) count++;
-  }
-  return count + sizeDiff;
+  return static_cast<int>(ppc::util::hamming_distance(str1_.data(), str1_.size(), str2_.data(), str2_.size()));
 }
 
 bool makhov_m_num_of_diff_elements_in_two_str_seq::TestTaskSequential::validation() {
@@ -9,14 +9,16 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 
 namespace malyshev_v_monte_carlo_integration {
 
 class TestMPITaskSequential : public ppc::core::Task {
  public:
-  explicit TestMPITaskSequential(std::shared_ptr<ppc::core::TaskData> taskData_,
-                                 std::function<double(double)> func = function_square)
-      : Task(std::move(taskData_)), function(std::move(func)) {}
+  // Any double(double) callable; a lambda is inlined into the batched quadrature loop
+  template <ppc::util::ScalarIntegrand F = double (*)(double)>
+  explicit TestMPITaskSequential(std::shared_ptr<ppc::core::TaskData> taskData_, F func = function_square)
+      : Task(std::move(taskData_)), function(ppc::util::make_batch_integrand(std::move(func))) {}
 
   bool pre_processing() override;
   bool validation() override;
@@ -32,7 +34,7 @@ class TestMPITaskSequential : public ppc::core::Task {
 
  private:
   double res{};
-  std::function<double(double)> function;
+  ppc::util::BatchIntegrand function;
 };
 
 }  // namespace malyshev_v_monte_carlo_integration
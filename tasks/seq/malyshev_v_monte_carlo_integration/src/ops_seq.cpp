@@ -6,7 +6,8 @@ namespace malyshev_v_monte_carlo_integration {
 
 bool TestMPITaskSequential::validation() {
   internal_order_test();
-  return (taskData->inputs.size() == 3 && taskData->outputs.size() == 1);
+  return (taskData->inputs.size() == 3 && taskData->outputs.size() == 1 &&
+          *reinterpret_cast<double*>(taskData->inputs[2]) > 0);
 }
 
 bool TestMPITaskSequential::pre_processing() {
@@ -26,14 +27,7 @@ bool TestMPITaskSequential::pre_processing() {
 
 bool TestMPITaskSequential::run() {
   internal_order_test();
-  double h = (b - a) / num_samples;
-  double sum = (function(a) + function(b)) / 2.0;
-
-  for (int i = 1; i < num_samples; ++i) {
-    sum += function(a + i * h);
-  }
-
-  res = h * sum;
+  res = ppc::util::composite_quadrature(function, a, b, num_samples, ppc::util::QuadratureRule::kTrapezoid);
   return true;
 }
 
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace muradov_m_count_alpha_chars_seq {
 
@@ -21,8 +21,8 @@ bool muradov_m_count_alpha_chars_seq::AlphaCharCountTaskSequential::validation()
 
 bool muradov_m_count_alpha_chars_seq::AlphaCharCountTaskSequential::run() {
   internal_order_test();
-  alpha_count_ = std::count_if(input_str_.begin(), input_str_.end(),
-                               [](char c) { return std::isalpha(static_cast<unsigned char>(c)); });
+  alpha_count_ = static_cast<int>(
+      ppc::util::count_class(input_str_.data(), input_str_.size(), ppc::util::ByteClass::ascii_alpha()));
   return true;
 }
 
@@ -213,4 +213,30 @@ TEST(nikolaev_r_trapezoidal_integral_seq, test_int_mixed_func) {
   testTaskSequential->run();
   testTaskSequential->post_processing();
   ASSERT_NEAR(expected, out[0], 0.01);
-}
\ No newline at end of file
+}
+
+TEST(nikolaev_r_trapezoidal_integral_seq, test_int_mixed_func_romberg) {
+  const double a = 1;
+  const double b = 3;
+  const int n = 1 << 16;
+  const double expected = 26.0 + (std::pow(5, 3) - 5) / std::log(5) - (std::exp(3) - std::exp(1));
+
+  std::vector<double> in = {a, b, static_cast<double>(n)};
+  std::vector<double> out(1, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskDataSeq->inputs_count.emplace_back(in.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  auto testTaskSequential =
+      std::make_shared<nikolaev_r_trapezoidal_integral_seq::TrapezoidalIntegralSequential>(taskDataSeq);
+  testTaskSequential->set_function([](double x) { return 3 * x * x + std::pow(5, x) - std::exp(x); });
+  testTaskSequential->set_tolerance(1e-9);
+  ASSERT_EQ(testTaskSequential->validation(), true);
+  testTaskSequential->pre_processing();
+  testTaskSequential->run();
+  testTaskSequential->post_processing();
+  ASSERT_NEAR(expected, out[0], 1e-8);
+}
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 
 namespace nikolaev_r_trapezoidal_integral_seq {
 
@@ -15,11 +16,17 @@ class TrapezoidalIntegralSequential : public ppc::core::Task {
   bool validation() override;
   bool run() override;
   bool post_processing() override;
-  void set_function(std::function<double(double)> f);
+  // Any double(double) callable; a lambda is inlined into the batched quadrature loop
+  template <ppc::util::ScalarIntegrand F>
+  void set_function(F f) {
+    function_ = ppc::util::make_batch_integrand(std::move(f));
+  }
+  // Romberg refinement to epsilon instead of a single pass; n becomes the cap on the number of subintervals
+  void set_tolerance(double epsilon) { epsilon_ = epsilon; }
 
  private:
   double a_{}, b_{}, n_{}, res_{};
-  std::function<double(double)> function_;
-  static double integrate_function(double a, double b, int n, const std::function<double(double)>& f);
+  double epsilon_{};
+  ppc::util::BatchIntegrand function_;
 };
 }  // namespace nikolaev_r_trapezoidal_integral_seq
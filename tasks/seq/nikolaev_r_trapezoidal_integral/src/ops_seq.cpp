@@ -14,12 +14,21 @@ bool nikolaev_r_trapezoidal_integral_seq::TrapezoidalIntegralSequential::pre_pro
 
 bool nikolaev_r_trapezoidal_integral_seq::TrapezoidalIntegralSequential::validation() {
   internal_order_test();
-  return taskData->inputs_count[0] == 3 && taskData->outputs_count[0] == 1;
+  return taskData->inputs_count[0] == 3 && taskData->outputs_count[0] == 1 &&
+         static_cast<int>(reinterpret_cast<double*>(taskData->inputs[0])[2]) > 0;
 }
 
 bool nikolaev_r_trapezoidal_integral_seq::TrapezoidalIntegralSequential::run() {
   internal_order_test();
-  res_ = integrate_function(a_, b_, n_, function_);
+  if (epsilon_ > 0) {
+    ppc::util::RombergOptions options;
+    options.epsilon = epsilon_;
+    options.max_intervals = static_cast<size_t>(n_);
+    res_ = ppc::util::romberg(function_, a_, b_, options).value;
+    return true;
+  }
+  res_ = ppc::util::composite_quadrature(function_, a_, b_, static_cast<size_t>(n_),
+                                        ppc::util::QuadratureRule::kTrapezoid);
   return true;
 }
 
@@ -28,22 +37,3 @@ bool nikolaev_r_trapezoidal_integral_seq::TrapezoidalIntegralSequential::post_pr
   reinterpret_cast<double*>(taskData->outputs[0])[0] = res_;
   return true;
 }
-
-void nikolaev_r_trapezoidal_integral_seq::TrapezoidalIntegralSequential::set_function(std::function<double(double)> f) {
-  function_ = std::move(f);
-}
-
-double nikolaev_r_trapezoidal_integral_seq::TrapezoidalIntegralSequential::integrate_function(
-    double a, double b, int n, const std::function<double(double)>& f) {
-  const double width = (b - a) / n;
-
-  double result = 0.0;
-  for (int step = 0; step < n; step++) {
-    const double x1 = a + step * width;
-    const double x2 = a + (step + 1) * width;
-
-    result += 0.5 * (x2 - x1) * (f(x1) + f(x2));
-  }
-
-  return result;
-}
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/convolution/include/convolution.hpp"
 
 namespace oturin_a_image_smoothing_seq {
 
@@ -26,7 +27,8 @@ const int INFO_HEADER_SIZE = 40;
 // https://stackoverflow.com/questions/9296059
 std::vector<uint8_t> ReadBMP(const char* filename, int& w, int& h);
 
-int clamp(int n, int lo, int hi);
+// 3x3 Gaussian with sigma 1.5, normalized to unit sum
+ppc::util::ConvolutionKernel<float> CreateKernel(int radius);
 
 class TestTaskSequential : public ppc::core::Task {
  public:
@@ -36,16 +38,12 @@ class TestTaskSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
-  void CreateKernel();
-  void SmoothPixel(int x, int y);
-
  private:
   int width = 0;
   int height = 0;
   std::vector<uint8_t> input;
   std::vector<uint8_t> result;
   int radius = 1;  // do not change
-  float* kernel;
 };
 
 }  // namespace oturin_a_image_smoothing_seq
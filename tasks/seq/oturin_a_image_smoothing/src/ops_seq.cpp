@@ -18,34 +18,31 @@ bool oturin_a_image_smoothing_seq::TestTaskSequential::pre_processing() {
   input = std::vector<uint8_t>(tmp_ptr, tmp_ptr + width * height * 3);
   // Init values for output
   result = std::vector<uint8_t>(width * height * 3);
-  CreateKernel();
   return true;
 }
 
 bool oturin_a_image_smoothing_seq::TestTaskSequential::run() {
   internal_order_test();
-
-  for (int y = 0; y < height; y++) {
-    for (int x = 0; x < width; x++) {
-      SmoothPixel(x, y);
-    }
-  }
-
+  ppc::util::ConvolutionOptions options;
+  // The reference images were produced by the 2D sum, which the separable passes do not reproduce bit for bit
+  options.use_separable = false;
+  ppc::util::convolve(
+      input.data(), result.data(), {width, height, BYTES_PER_PIXEL}, CreateKernel(radius),
+      [](float sum, int, int) { return static_cast<uint8_t>(sum); }, options);
   return true;
 }
 
 bool oturin_a_image_smoothing_seq::TestTaskSequential::post_processing() {
   internal_order_test();
-  delete[] kernel;
   auto* result_ptr = reinterpret_cast<uint8_t*>(taskData->outputs[0]);
   std::copy(result.begin(), result.end(), result_ptr);
   return true;
 }
 
-// must be used before image processing
-void oturin_a_image_smoothing_seq::TestTaskSequential::CreateKernel() {
+// Normalized Gaussian kernel (sigma 1.5) of the given radius
+ppc::util::ConvolutionKernel<float> oturin_a_image_smoothing_seq::CreateKernel(int radius) {
   int size = 2 * radius + 1;
-  kernel = new float[size * size]{0};
+  std::vector<float> kernel(size * size);
   float sigma = 1.5;
   float norm = 0;
 
@@ -57,32 +54,10 @@ void oturin_a_image_smoothing_seq::TestTaskSequential::CreateKernel() {
   }
 
   for (int i = 0; i < size * size; i++) {
-    kernel[i] /= norm;  // NOLINT: supressed false-positive uninitialized memory warning
+    kernel[i] /= norm;
   }
-}
 
-void oturin_a_image_smoothing_seq::TestTaskSequential::SmoothPixel(int x, int y) {
-  int stride = width * 3;
-  size_t sizek = 2 * radius + 1;
-  float outR = 0.0f;
-  float outG = 0.0f;
-  float outB = 0.0f;
-  for (int ry = -radius; ry <= radius; ry++) {
-    for (int rx = -radius; rx <= radius; rx++) {
-      int idX = clamp(x + rx, 0, width - 1);
-      int idY = clamp(y + ry, 0, height - 1);
-      int pos = idY * stride + idX * 3;
-      int kernelPos = (ry + radius) * sizek + rx + radius;
-
-      outR += input[pos] * kernel[kernelPos];
-      outG += input[pos + 1] * kernel[kernelPos];
-      outB += input[pos + 2] * kernel[kernelPos];
-    }
-  }
-  int pos = y * stride + x * 3;
-  result[pos] = (uint8_t)outR;
-  result[pos + 1] = (uint8_t)outG;
-  result[pos + 2] = (uint8_t)outB;
+  return {radius, std::move(kernel)};
 }
 
 #if defined(_WIN32) || defined(WIN32)
@@ -136,5 +111,3 @@ std::vector<uint8_t> oturin_a_image_smoothing_seq::ReadBMP(const char* filename,
 
   return data;
 }
-
-int oturin_a_image_smoothing_seq::clamp(int n, int lo, int hi) { return std::min(std::max(n, lo), hi); }
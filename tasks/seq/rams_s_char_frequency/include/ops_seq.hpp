@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace rams_s_char_frequency_seq {
 
@@ -20,6 +21,7 @@ class CharFrequencyTaskSequential : public ppc::core::Task {
   std::string input_;
   char target_;
   int res;
+  ppc::util::ByteHistogram histogram_;
 };
 
 }  // namespace rams_s_char_frequency_seq
@@ -23,7 +23,8 @@ bool rams_s_char_frequency_seq::CharFrequencyTaskSequential::validation() {
 
 bool rams_s_char_frequency_seq::CharFrequencyTaskSequential::run() {
   internal_order_test();
-  res = std::count(input_.begin(), input_.end(), target_);
+  histogram_ = ppc::util::ByteHistogram(input_.data(), input_.size());
+  res = static_cast<int>(histogram_.count(target_));
   return true;
 }
 
@@ -1,5 +1,7 @@
 #include "seq/sarafanov_m_num_of_mismatch_characters_of_two_strings/include/ops_seq.hpp"
 
+#include "util/text/include/text.hpp"
+
 bool sarafanov_m_num_of_mismatch_characters_of_two_strings_seq::SequentialTask::validation() {
   internal_order_test();
   return taskData->inputs_count[0] == taskData->inputs_count[1] && taskData->outputs_count[0] == 1;
@@ -15,11 +17,7 @@ bool sarafanov_m_num_of_mismatch_characters_of_two_strings_seq::SequentialTask::
 
 bool sarafanov_m_num_of_mismatch_characters_of_two_strings_seq::SequentialTask::run() {
   internal_order_test();
-  for (size_t i = 0; i < input_a_.size(); ++i) {
-    if (input_a_[i] != input_b_[i]) {
-      result_++;
-    }
-  }
+  result_ = static_cast<int>(ppc::util::count_mismatches(input_a_.data(), input_b_.data(), input_a_.size()));
   return true;
 }
 
@@ -20,12 +20,15 @@ bool ContrastTaskSequential::validation() {
 
 bool ContrastTaskSequential::run() {
   internal_order_test();
-  uint8_t min_val = *std::min_element(input_.begin(), input_.end());
-  uint8_t max_val = *std::max_element(input_.begin(), input_.end());
-
-  for (size_t i = 0; i < input_.size(); ++i) {
-    output_[i] = static_cast<uint8_t>((input_[i] - min_val) * 255.0 / (max_val - min_val));
-  }
+  auto stats = ppc::util::channel_stats(input_.data(), input_.size());
+  uint8_t min_val = stats.min;
+  uint8_t max_val = stats.max;
+
+  // A flat image has no range to stretch and stays mid-grey, as in the parallel version
+  auto lut = ppc::util::make_lut([=](uint8_t v) {
+    return max_val == min_val ? 128 : static_cast<int>((v - min_val) * 255.0 / (max_val - min_val));
+  });
+  ppc::util::apply_lut(lut, input_.data(), output_.data(), input_.size());
   return true;
 }
 
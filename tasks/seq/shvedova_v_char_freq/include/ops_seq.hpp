@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace shvedova_v_char_frequency_seq {
 
@@ -19,6 +20,7 @@ class CharFrequencyTaskSequential : public ppc::core::Task {
   std::string input_str_;
   char target_char_;
   int frequency_ = 0;
+  ppc::util::ByteHistogram histogram_;
 };
 
 }  // namespace shvedova_v_char_frequency_seq
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/quadrature/include/quadrature.hpp"
 
 namespace smirnov_i_integration_by_rectangles {
 class TestMPITaskSequential : public ppc::core::Task {
@@ -14,13 +15,17 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
   void set_function(double (*func)(double));
+  // Other double(double) callables, inlined into the batched quadrature loop
+  template <ppc::util::ScalarIntegrand F>
+  void set_function(F func) {
+    f = ppc::util::make_batch_integrand(std::move(func));
+  }
 
  private:
   double res{};
   double left_{};
   double right_{};
   int n_{};
-  double seq_integrate_rect(double (*func)(double), double left, double right, int n);
-  double (*f)(double) = nullptr;
+  ppc::util::BatchIntegrand f;
 };
 }  // namespace smirnov_i_integration_by_rectangles
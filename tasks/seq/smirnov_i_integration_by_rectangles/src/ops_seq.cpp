@@ -18,11 +18,14 @@ bool smirnov_i_integration_by_rectangles::TestMPITaskSequential::pre_processing(
 
 bool smirnov_i_integration_by_rectangles::TestMPITaskSequential::validation() {
   internal_order_test();
-  return taskData->outputs_count[0] == 1;
+  return taskData->outputs_count[0] == 1 && *reinterpret_cast<int*>(taskData->inputs[2]) > 0;
 }
 bool smirnov_i_integration_by_rectangles::TestMPITaskSequential::run() {
   internal_order_test();
-  res = seq_integrate_rect(f, left_, right_, n_);
+  if (!f) {
+    throw std::logic_error("func is nullptr");
+  }
+  res = ppc::util::composite_quadrature(f, left_, right_, n_, ppc::util::QuadratureRule::kMidpoint);
   return true;
 }
 
@@ -31,22 +34,6 @@ bool smirnov_i_integration_by_rectangles::TestMPITaskSequential::post_processing
   reinterpret_cast<double*>(taskData->outputs[0])[0] = res;
   return true;
 }
-void smirnov_i_integration_by_rectangles::TestMPITaskSequential::set_function(double (*func)(double)) { f = func; }
-
-double smirnov_i_integration_by_rectangles::TestMPITaskSequential::seq_integrate_rect(double (*func)(double),
-                                                                                      double left, double right,
-                                                                                      int n) {
-  if (func == nullptr) {
-    throw std::logic_error("func is nullptr");
-  }
-  double res_integr = 0;
-  const double self_left = left;
-  const double self_right = right;
-  const double len_of_rect = (self_right - self_left) / n;
-  for (int i = 0; i < n; i++) {
-    const double left_rect = self_left + i * len_of_rect;
-    res_integr += f(left_rect + len_of_rect / 2);
-  }
-  res_integr *= len_of_rect;
-  return res_integr;
+void smirnov_i_integration_by_rectangles::TestMPITaskSequential::set_function(double (*func)(double)) {
+  f = func != nullptr ? ppc::util::make_batch_integrand(func) : nullptr;
 }
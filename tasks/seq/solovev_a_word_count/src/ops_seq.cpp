@@ -18,11 +18,7 @@ bool solovev_a_word_count_seq::TestTaskSequential::validation() {
 
 bool solovev_a_word_count_seq::TestTaskSequential::run() {
   internal_order_test();
-  for (char symbol : input_) {
-    if (symbol == ' ' || symbol == '.') {
-      res++;
-    }
-  }
+  res = static_cast<int>(ppc::util::count_class(input_.data(), input_.size(), ppc::util::ByteClass::of(" .")));
   return true;
 }
 
@@ -3,6 +3,7 @@
 #include <string>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace tyurin_m_count_sentences_in_string_seq {
 
@@ -17,9 +18,6 @@ class SentenceCountTaskSequential : public ppc::core::Task {
  private:
   std::string input_str_;
   int sentence_count_ = 0;
-
-  static bool is_sentence_end(char c);
-  static bool is_whitespace(char c);
 };
 
 }  // namespace tyurin_m_count_sentences_in_string_seq
@@ -19,18 +19,11 @@ bool tyurin_m_count_sentences_in_string_seq::SentenceCountTaskSequential::valida
 bool tyurin_m_count_sentences_in_string_seq::SentenceCountTaskSequential::run() {
   internal_order_test();
 
-  bool inside_sentence = false;
-
-  for (char c : input_str_) {
-    if (is_sentence_end(c)) {
-      if (inside_sentence) {
-        sentence_count_++;
-        inside_sentence = false;
-      }
-    } else if (!is_whitespace(c)) {
-      inside_sentence = true;
-    }
-  }
+  // A terminator ends a sentence when the closest non-blank character before it is text, not a terminator
+  const auto ends = ppc::util::ByteClass::sentence_end();
+  const auto blanks = ppc::util::ByteClass::of(" \n\t");
+  sentence_count_ =
+      static_cast<int>(ppc::util::count_preceded(input_str_.data(), input_str_.size(), ends, ~(ends | blanks), blanks));
 
   return true;
 }
@@ -40,11 +33,3 @@ bool tyurin_m_count_sentences_in_string_seq::SentenceCountTaskSequential::post_p
   *reinterpret_cast<int*>(taskData->outputs[0]) = sentence_count_;
   return true;
 }
-
-bool tyurin_m_count_sentences_in_string_seq::SentenceCountTaskSequential::is_sentence_end(char c) {
-  return c == '.' || c == '!' || c == '?';
-}
-
-bool tyurin_m_count_sentences_in_string_seq::SentenceCountTaskSequential::is_whitespace(char c) {
-  return c == ' ' || c == '\n' || c == '\t';
-}
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/text/include/text.hpp"
 
 namespace vasenkov_a_char_frequency_seq {
 
@@ -18,6 +19,7 @@ class CharFrequencyTaskSequential : public ppc::core::Task {
  private:
   char target_char_;
   int frequency_ = 0;
+  ppc::util::ByteHistogram histogram_;
   std::string str_input_;
 };
 
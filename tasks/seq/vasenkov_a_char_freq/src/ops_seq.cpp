@@ -21,7 +21,8 @@ bool vasenkov_a_char_frequency_seq::CharFrequencyTaskSequential::validation() {
 
 bool vasenkov_a_char_frequency_seq::CharFrequencyTaskSequential::run() {
   internal_order_test();
-  frequency_ = std::count(str_input_.begin(), str_input_.end(), target_char_);
+  histogram_ = ppc::util::ByteHistogram(str_input_.data(), str_input_.size());
+  frequency_ = static_cast<int>(histogram_.count(target_char_));
   return true;
 }
 
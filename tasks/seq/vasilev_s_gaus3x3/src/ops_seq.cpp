@@ -40,24 +40,14 @@ bool vasilev_s_gaus3x3_seq::Gaus3x3Sequential::pre_processing() {
 bool vasilev_s_gaus3x3_seq::Gaus3x3Sequential::run() {
   internal_order_test();
 
-  for (int row = 1; row < rows - 1; ++row) {
-    for (int col = 1; col < cols - 1; ++col) {
-      int baseIndex = row * cols + col;
-
-      double result = 0.0;
-      result += matrix[baseIndex - cols - 1] * 0.0625;  // Top-left
-      result += matrix[baseIndex - cols] * 0.125;       // Top-center
-      result += matrix[baseIndex - cols + 1] * 0.0625;  // Top-right
-      result += matrix[baseIndex - 1] * 0.125;          // Middle-left
-      result += matrix[baseIndex] * 0.25;               // Center
-      result += matrix[baseIndex + 1] * 0.125;          // Middle-right
-      result += matrix[baseIndex + cols - 1] * 0.0625;  // Bottom-left
-      result += matrix[baseIndex + cols] * 0.125;       // Bottom-center
-      result += matrix[baseIndex + cols + 1] * 0.0625;  // Bottom-right
-
-      result_vector[baseIndex] = result;
-    }
-  }
+  // [1 2 1] / 4 in both directions; the one-pixel frame keeps its zeros
+  const std::vector<double> binomial{0.25, 0.5, 0.25};
+  ppc::util::ConvolutionOptions options;
+  options.border = ppc::util::BorderMode::kValid;
+  ppc::util::convolve(
+      matrix.data(), result_vector.data(), {cols, rows, 1},
+      ppc::util::ConvolutionKernel<double>::outer(binomial, binomial), [](double sum, int, int) { return sum; },
+      options);
 
   return true;
 }
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/convolution/include/convolution.hpp"
 
 namespace vershinina_a_image_smoothing {
 
@@ -26,19 +26,16 @@ bool vershinina_a_image_smoothing::TestTaskSequential::validation() {
 
 bool vershinina_a_image_smoothing::TestTaskSequential::run() {
   internal_order_test();
-  for (int i = 0; i < rows; ++i) {
-    for (int j = 0; j < cols; ++j) {
-      int sum = 0;
-      int c = 0;
-      for (int row = std::max(0, i - 1); row <= std::min(i + 1, rows - 1); row++) {
-        for (int col = std::max(0, j - 1); col <= std::min(j + 1, cols - 1); col++) {
-          sum += input_[row * cols + col];
-          c++;
-        }
-      }
-      output_[i * cols + j] = sum / c;
-    }
-  }
+  // 3x3 box sum with zero padding, divided by the number of window pixels inside the image
+  ppc::util::ConvolutionOptions options;
+  options.border = ppc::util::BorderMode::kZero;
+  auto mean = [&](int sum, int x, int y) {
+    int window_rows = std::min(y + 1, rows - 1) - std::max(y - 1, 0) + 1;
+    int window_cols = std::min(x + 1, cols - 1) - std::max(x - 1, 0) + 1;
+    return sum / (window_rows * window_cols);
+  };
+  ppc::util::convolve(input_, output_.data(), {cols, rows, 1}, ppc::util::ConvolutionKernel<int>(1, std::vector(9, 1)),
+                      mean, options);
   return true;
 }
 
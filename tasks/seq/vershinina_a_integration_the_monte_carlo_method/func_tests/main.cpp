@@ -134,4 +134,27 @@ TEST(vershinina_a_integration_the_monte_carlo_method, test5) {
   testTaskSequential.post_processing();
   another_res[0] = (cos(xmax) - cos(xmin));
   EXPECT_NEAR(another_res[0], reference_res[0], 10);
-}
\ No newline at end of file
+}
+TEST(vershinina_a_integration_the_monte_carlo_method, test_seed_controls_samples) {
+  std::vector<double> in{0.0, 1.0, 0.0, 1.0, 100000};
+  std::vector<double> res(3, 0);
+
+  for (int run = 0; run < 3; run++) {
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    taskDataSeq->inputs_count.emplace_back(in.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(&res[run]));
+    taskDataSeq->outputs_count.emplace_back(1);
+
+    vershinina_a_integration_the_monte_carlo_method::TestTaskSequential testTaskSequential(taskDataSeq);
+    testTaskSequential.p = [](double x) { return x * x; };
+    testTaskSequential.seed = run < 2 ? 1 : 2;
+    ASSERT_EQ(testTaskSequential.validation(), true);
+    testTaskSequential.pre_processing();
+    testTaskSequential.run();
+    testTaskSequential.post_processing();
+    EXPECT_NEAR(res[run], 1.0 / 3.0, 1e-2);
+  }
+  EXPECT_EQ(res[0], res[1]);
+  EXPECT_NE(res[0], res[2]);
+}
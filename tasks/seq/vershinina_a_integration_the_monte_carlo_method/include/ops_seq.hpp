@@ -1,9 +1,11 @@
 #pragma once
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/rng/include/hit_or_miss.hpp"
 
 namespace vershinina_a_integration_the_monte_carlo_method {
 std::vector<double> getRandomVector();
@@ -15,6 +17,7 @@ class TestTaskSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
   std::function<double(double)> p;
+  uint64_t seed = 2024;
 
  private:
   double xmin{};
@@ -18,6 +18,7 @@ TEST(vershinina_a_integration_the_monte_carlo_method, test_pipeline_run) {
 
   auto testTaskSequential =
       std::make_shared<vershinina_a_integration_the_monte_carlo_method::TestTaskSequential>(taskDataSeq);
+  testTaskSequential->p = [](double x) { return exp(sqrt(pow(x, 2) * 2 + x + 1)); };
 
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
   perfAttr->num_running = 10;
@@ -48,6 +49,7 @@ TEST(vershinina_a_integration_the_monte_carlo_method, test_task_run) {
 
   auto testTaskSequential =
       std::make_shared<vershinina_a_integration_the_monte_carlo_method::TestTaskSequential>(taskDataSeq);
+  testTaskSequential->p = [](double x) { return exp(sqrt(pow(x, 2) * 2 + x + 1)); };
 
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
   perfAttr->num_running = 10;
@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <functional>
-#include <random>
 #include <string>
 #include <vector>
 
@@ -24,25 +23,9 @@ bool vershinina_a_integration_the_monte_carlo_method::TestTaskSequential::valida
 
 bool vershinina_a_integration_the_monte_carlo_method::TestTaskSequential::run() {
   internal_order_test();
-  int count;
-  double total = 0;
-  double inBox = 0;
-  reference_res = 0;
-  for (count = 0; count < iter_count; count++) {
-    double u1 = (double)rand() / (double)RAND_MAX;
-    double u2 = (double)rand() / (double)RAND_MAX;
-
-    double xcoord = ((xmax - xmin) * u1) + xmin;
-    double ycoord = ((ymax - ymin) * u2) + ymin;
-    double val = p(xcoord);
-
-    ++total;
-
-    if (val > ycoord) {
-      ++inBox;
-    }
-  }
-  double density = inBox / total;
+  auto samples = static_cast<int64_t>(iter_count);
+  double inBox = static_cast<double>(ppc::util::count_hits(p, seed, 0, samples, xmin, xmax, ymin, ymax));
+  double density = inBox / static_cast<double>(samples);
 
   reference_res = (xmax - xmin) * (ymax - ymin) * density;
   return true;
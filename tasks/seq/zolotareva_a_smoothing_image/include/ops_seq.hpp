@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "util/convolution/include/convolution.hpp"
 
 namespace zolotareva_a_smoothing_image_seq {
 
@@ -30,12 +30,11 @@ bool zolotareva_a_smoothing_image_seq::TestTaskSequential::run() {
   internal_order_test();
   int radius = 1;
   float sigma = 1.0f;
-  std::vector<float> horizontal_kernel = create_gaussian_kernel(radius, sigma);
-  std::vector<float>& vertical_kernel = horizontal_kernel;
-  std::vector<float> temp(height_ * width_, 0.0f);
-
-  convolve_rows(input_, height_, width_, horizontal_kernel, temp);
-  convolve_columns(temp, height_, width_, vertical_kernel, result_);
+  std::vector<float> kernel = create_gaussian_kernel(radius, sigma);
+  // Row pass, then column pass, over a sliding window of rows instead of a full-image float buffer
+  ppc::util::convolve(
+      input_.data(), result_.data(), {width_, height_, 1}, ppc::util::ConvolutionKernel<float>::outer(kernel, kernel),
+      [](float sum, int, int) { return static_cast<uint8_t>(std::clamp(static_cast<int>(std::round(sum)), 0, 255)); });
   return true;
 }
 